@@ -9,10 +9,21 @@ LOCAL_ARM_MODE := arm
 
 LOCAL_SRC_FILES += $(SRC_DIR)/RenderAPI.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/RenderingPlugin.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/MemorySubAllocator.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/BlockCompression.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/GLUploadThread.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/DebugMessages.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/ShaderCache.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/MemoryStats.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/ChromeTrace.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/PluginProfiler.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/FrameTrace.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/RenderAPI_Null.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/VirtualTexture.cpp
 
 # OpenGL ES
 LOCAL_SRC_FILES += $(SRC_DIR)/RenderAPI_OpenGLCoreES.cpp
-LOCAL_LDLIBS += -lGLESv2
+LOCAL_LDLIBS += -lGLESv3
 LOCAL_CPPFLAGS += -DSUPPORT_OPENGL_ES=1
 
 # Vulkan (optional)
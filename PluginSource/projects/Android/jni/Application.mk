@@ -1,5 +1,5 @@
 APP_ABI := armeabi-v7a arm64-v8a x86 x86_64
-APP_PLATFORM := android-9
+APP_PLATFORM := android-18
 APP_STL := gnustl_static
 APP_CPPFLAGS += -std=c++11
 NDK_TOOLCHAIN_VERSION := clang
@@ -0,0 +1,649 @@
+#include "BlockCompression.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define BLOCK_COMPRESSION_SSE2 1
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#	define BLOCK_COMPRESSION_NEON 1
+#	include <arm_neon.h>
+#endif
+
+// Block encoders; see BlockCompression.h.
+
+
+size_t GetBlockCompressedSize(TextureBlockFormat format, int width, int height)
+{
+	if (format <= kBlockFormatNone || format >= kBlockFormatCount)
+		return 0;
+	return (size_t)GetBlockCountX(width) * GetBlockCountY(height) * kBlockBytes;
+}
+
+
+// --------------------------------------------------------------------------
+// Shared helpers. A block is 16 RGBA8 texels, row by row.
+
+static void FetchBlock(const unsigned char* src, int width, int height, int rowPitch, int blockX, int blockY, unsigned char block[64])
+{
+	const int x0 = blockX * kBlockSize;
+	const int y0 = blockY * kBlockSize;
+	for (int y = 0; y < kBlockSize; ++y)
+	{
+		const int sy = y0 + y < height ? y0 + y : height - 1;
+		const unsigned char* row = src + (size_t)sy * rowPitch;
+		if (x0 + kBlockSize <= width)
+		{
+			memcpy(block + y * 16, row + x0 * 4, 16);
+			continue;
+		}
+		for (int x = 0; x < kBlockSize; ++x)
+		{
+			const int sx = x0 + x < width ? x0 + x : width - 1;
+			memcpy(block + y * 16 + x * 4, row + sx * 4, 4);
+		}
+	}
+}
+
+
+// Per channel minimum and maximum over the block
+static void GetBlockBounds(const unsigned char block[64], unsigned char outMin[4], unsigned char outMax[4])
+{
+#if BLOCK_COMPRESSION_SSE2
+	const __m128i r0 = _mm_loadu_si128((const __m128i*)(block + 0));
+	const __m128i r1 = _mm_loadu_si128((const __m128i*)(block + 16));
+	const __m128i r2 = _mm_loadu_si128((const __m128i*)(block + 32));
+	const __m128i r3 = _mm_loadu_si128((const __m128i*)(block + 48));
+	__m128i mn = _mm_min_epu8(_mm_min_epu8(r0, r1), _mm_min_epu8(r2, r3));
+	__m128i mx = _mm_max_epu8(_mm_max_epu8(r0, r1), _mm_max_epu8(r2, r3));
+	// Down from four texels to one
+	mn = _mm_min_epu8(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(1, 0, 3, 2)));
+	mx = _mm_max_epu8(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(1, 0, 3, 2)));
+	mn = _mm_min_epu8(mn, _mm_shuffle_epi32(mn, _MM_SHUFFLE(2, 3, 0, 1)));
+	mx = _mm_max_epu8(mx, _mm_shuffle_epi32(mx, _MM_SHUFFLE(2, 3, 0, 1)));
+	const int packedMin = _mm_cvtsi128_si32(mn);
+	const int packedMax = _mm_cvtsi128_si32(mx);
+	memcpy(outMin, &packedMin, 4);
+	memcpy(outMax, &packedMax, 4);
+#elif BLOCK_COMPRESSION_NEON
+	const uint8x16_t r0 = vld1q_u8(block + 0);
+	const uint8x16_t r1 = vld1q_u8(block + 16);
+	const uint8x16_t r2 = vld1q_u8(block + 32);
+	const uint8x16_t r3 = vld1q_u8(block + 48);
+	const uint8x16_t mn4 = vminq_u8(vminq_u8(r0, r1), vminq_u8(r2, r3));
+	const uint8x16_t mx4 = vmaxq_u8(vmaxq_u8(r0, r1), vmaxq_u8(r2, r3));
+	// Down from four texels to two, then one
+	uint8x8_t mn = vmin_u8(vget_low_u8(mn4), vget_high_u8(mn4));
+	uint8x8_t mx = vmax_u8(vget_low_u8(mx4), vget_high_u8(mx4));
+	mn = vmin_u8(mn, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(mn))));
+	mx = vmax_u8(mx, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(mx))));
+	const uint32_t packedMin = vget_lane_u32(vreinterpret_u32_u8(mn), 0);
+	const uint32_t packedMax = vget_lane_u32(vreinterpret_u32_u8(mx), 0);
+	memcpy(outMin, &packedMin, 4);
+	memcpy(outMax, &packedMax, 4);
+#else
+	for (int c = 0; c < 4; ++c)
+	{
+		outMin[c] = 255;
+		outMax[c] = 0;
+	}
+	for (int i = 0; i < 16; ++i)
+	{
+		for (int c = 0; c < 4; ++c)
+		{
+			const unsigned char v = block[i * 4 + c];
+			outMin[c] = v < outMin[c] ? v : outMin[c];
+			outMax[c] = v > outMax[c] ? v : outMax[c];
+		}
+	}
+#endif
+}
+
+
+static inline int ClampInt(int v, int lo, int hi)
+{
+	return v < lo ? lo : v > hi ? hi : v;
+}
+
+// ETC and EAC blocks are big endian 64 bit words, with texels numbered column by column
+static inline int EtcTexelIndex(int x, int y)
+{
+	return x * 4 + y;
+}
+
+static void StoreBigEndian64(unsigned long long bits, unsigned char* out)
+{
+	for (int i = 0; i < 8; ++i)
+		out[i] = (unsigned char)(bits >> (56 - i * 8));
+}
+
+
+// --------------------------------------------------------------------------
+// BC1: two RGB565 endpoints and a 2 bit index per texel, in four color mode. Endpoints are the
+// block's bounding box diagonal, inset a little since the corners are rarely hit exactly.
+
+static unsigned short PackRGB565(const int c[3])
+{
+	return (unsigned short)((((c[0] * 31 + 127) / 255) << 11) | (((c[1] * 63 + 127) / 255) << 5) | ((c[2] * 31 + 127) / 255));
+}
+
+static void UnpackRGB565(unsigned short packed, int out[3])
+{
+	const int r = packed >> 11, g = (packed >> 5) & 63, b = packed & 31;
+	out[0] = (r << 3) | (r >> 2);
+	out[1] = (g << 2) | (g >> 4);
+	out[2] = (b << 3) | (b >> 2);
+}
+
+static void EncodeBC1(const unsigned char block[64], unsigned char* out)
+{
+	unsigned char mn[4], mx[4];
+	GetBlockBounds(block, mn, mx);
+
+	// The min to max diagonal fits channels that rise together; a channel that falls while the
+	// widest one rises takes the other diagonal
+	int lo[3], hi[3];
+	int ref = 0;
+	for (int c = 0; c < 3; ++c)
+	{
+		lo[c] = mn[c];
+		hi[c] = mx[c];
+		if (mx[c] - mn[c] > mx[ref] - mn[ref])
+			ref = c;
+	}
+	const int refCenter = (mn[ref] + mx[ref]) >> 1;
+	for (int c = 0; c < 3; ++c)
+	{
+		if (c == ref)
+			continue;
+		const int center = (mn[c] + mx[c]) >> 1;
+		int covariance = 0;
+		for (int i = 0; i < 16; ++i)
+			covariance += (block[i * 4 + ref] - refCenter) * (block[i * 4 + c] - center);
+		if (covariance < 0)
+		{
+			lo[c] = mx[c];
+			hi[c] = mn[c];
+		}
+	}
+	for (int c = 0; c < 3; ++c)
+	{
+		const int inset = (hi[c] - lo[c]) / 16;
+		hi[c] -= inset;
+		lo[c] += inset;
+	}
+
+	unsigned short color0 = PackRGB565(hi);
+	unsigned short color1 = PackRGB565(lo);
+	unsigned int indices = 0;
+	if (color0 != color1)
+	{
+		// Four color mode needs color0 > color1
+		if (color0 < color1)
+		{
+			const unsigned short t = color0;
+			color0 = color1;
+			color1 = t;
+		}
+		int c0[3], c1[3];
+		UnpackRGB565(color0, c0);
+		UnpackRGB565(color1, c1);
+
+		// Project each texel onto the endpoint line and round to the nearest of its four points:
+		// steps 0..3 from color1 to color0 are indices 1, 3, 2, 0
+		static const unsigned int kStepToIndex[4] = { 1, 3, 2, 0 };
+		const int axis[3] = { c0[0] - c1[0], c0[1] - c1[1], c0[2] - c1[2] };
+		const int lengthSq = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+		for (int i = 0; i < 16; ++i)
+		{
+			const unsigned char* t = block + i * 4;
+			const int dot = (t[0] - c1[0]) * axis[0] + (t[1] - c1[1]) * axis[1] + (t[2] - c1[2]) * axis[2];
+			const int step = ClampInt((dot * 6 + lengthSq) / (lengthSq * 2), 0, 3);
+			indices |= kStepToIndex[step] << (i * 2);
+		}
+	}
+
+	out[0] = (unsigned char)color0;
+	out[1] = (unsigned char)(color0 >> 8);
+	out[2] = (unsigned char)color1;
+	out[3] = (unsigned char)(color1 >> 8);
+	out[4] = (unsigned char)indices;
+	out[5] = (unsigned char)(indices >> 8);
+	out[6] = (unsigned char)(indices >> 16);
+	out[7] = (unsigned char)(indices >> 24);
+}
+
+
+// --------------------------------------------------------------------------
+// BC4: the channel's minimum and maximum as endpoints, in eight value mode, and a 3 bit index per
+// texel rounded to the nearest of the evenly spaced values.
+
+static void EncodeBC4(const unsigned char block[64], unsigned char* out)
+{
+	unsigned char mn[4], mx[4];
+	GetBlockBounds(block, mn, mx);
+
+	unsigned long long indices = 0;
+	const int range = mx[0] - mn[0];
+	if (range > 0)
+	{
+		// Steps 0..7 from min to max; index 0 is max, 1 is min, 2..7 go from max down
+		for (int i = 0; i < 16; ++i)
+		{
+			const int step = ((block[i * 4] - mn[0]) * 14 + range) / (range * 2);
+			const unsigned long long index = step == 7 ? 0 : step == 0 ? 1 : 8 - step;
+			indices |= index << (i * 3);
+		}
+	}
+
+	out[0] = mx[0];
+	out[1] = mn[0];
+	for (int i = 0; i < 6; ++i)
+		out[2 + i] = (unsigned char)(indices >> (i * 8));
+}
+
+
+// --------------------------------------------------------------------------
+// ETC2 RGB, in the differential and individual modes it shares with ETC1. The block is split in
+// two halves, side by side or on top of each other, each with a base color and an intensity table;
+// every texel adds one of the table's four modifiers to all channels of its half's base color.
+// Both splits are tried, the base color is the half's average, and since the modifier is the same
+// for every channel the best one follows from the texel's mean difference to the base.
+
+static const int kEtcModifiers[8][2] =
+{
+	{ 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 },
+};
+
+// Texel indices 0..3 pick modifiers small, large, -small, -large
+struct EtcHalf
+{
+	int error;
+	int table;
+	unsigned int msb;	// bit per texel, at EtcTexelIndex
+	unsigned int lsb;
+};
+
+static EtcHalf EncodeEtcHalf(const unsigned char block[64], int flip, int half, const int base[3])
+{
+	const int x0 = flip ? 0 : half * 2, x1 = flip ? 4 : half * 2 + 2;
+	const int y0 = flip ? half * 2 : 0, y1 = flip ? half * 2 + 2 : 4;
+
+	// Three times the mean difference of each texel to the base color
+	int diff[8];
+	int position[8];
+	int n = 0;
+	for (int y = y0; y < y1; ++y)
+	{
+		for (int x = x0; x < x1; ++x, ++n)
+		{
+			const unsigned char* t = block + (y * 4 + x) * 4;
+			diff[n] = (t[0] - base[0]) + (t[1] - base[1]) + (t[2] - base[2]);
+			position[n] = EtcTexelIndex(x, y);
+		}
+	}
+
+	// The sign of each texel's modifier doesn't depend on the table, and the table is picked on
+	// error alone; the large/small bits are only worked out for the winner
+	int magnitude[8];
+	unsigned int msb = 0;
+	for (int i = 0; i < 8; ++i)
+	{
+		magnitude[i] = abs(diff[i]);
+		msb |= (diff[i] < 0 ? 1u : 0u) << position[i];
+	}
+	int bestError = INT_MAX, bestTable = 0;
+	for (int table = 0; table < 8; ++table)
+	{
+		const int small3 = kEtcModifiers[table][0] * 3;
+		const int large3 = kEtcModifiers[table][1] * 3;
+		const int threshold = (small3 + large3) / 2;
+		int error = 0;
+		for (int i = 0; i < 8; ++i)
+		{
+			const int e = (magnitude[i] > threshold ? large3 : small3) - magnitude[i];
+			error += e * e;
+		}
+		bestTable = error < bestError ? table : bestTable;
+		bestError = error < bestError ? error : bestError;
+	}
+
+	EtcHalf best = { bestError, bestTable, msb, 0 };
+	const int threshold = (kEtcModifiers[bestTable][0] + kEtcModifiers[bestTable][1]) * 3 / 2;
+	for (int i = 0; i < 8; ++i)
+		best.lsb |= (magnitude[i] > threshold ? 1u : 0u) << position[i];
+	return best;
+}
+
+static void EncodeETC2RGB(const unsigned char block[64], unsigned char* out)
+{
+	unsigned long long bestBits = 0;
+	int bestError = INT_MAX;
+	for (int flip = 0; flip < 2; ++flip)
+	{
+		int average[2][3] = {};
+		for (int y = 0; y < 4; ++y)
+		{
+			for (int x = 0; x < 4; ++x)
+			{
+				const int half = flip ? y / 2 : x / 2;
+				for (int c = 0; c < 3; ++c)
+					average[half][c] += block[(y * 4 + x) * 4 + c];
+			}
+		}
+		for (int half = 0; half < 2; ++half)
+		{
+			for (int c = 0; c < 3; ++c)
+				average[half][c] = (average[half][c] + 4) / 8;
+		}
+
+		// Differential mode stores 5 bit colors, the second one as a 3 bit delta; when the halves
+		// are too far apart for that, individual mode stores two 4 bit colors
+		int base[2][3];
+		unsigned int high = 0;
+		int color5[2][3];
+		bool differential = true;
+		for (int c = 0; c < 3; ++c)
+		{
+			color5[0][c] = (average[0][c] * 31 + 127) / 255;
+			color5[1][c] = (average[1][c] * 31 + 127) / 255;
+			const int delta = color5[1][c] - color5[0][c];
+			differential = differential && delta >= -4 && delta <= 3;
+		}
+		if (differential)
+		{
+			for (int c = 0; c < 3; ++c)
+			{
+				base[0][c] = (color5[0][c] << 3) | (color5[0][c] >> 2);
+				base[1][c] = (color5[1][c] << 3) | (color5[1][c] >> 2);
+				high |= (unsigned int)color5[0][c] << (27 - c * 8);
+				high |= (unsigned int)((color5[1][c] - color5[0][c]) & 7) << (24 - c * 8);
+			}
+			high |= 2;
+		}
+		else
+		{
+			for (int c = 0; c < 3; ++c)
+			{
+				const int color4a = (average[0][c] * 15 + 127) / 255;
+				const int color4b = (average[1][c] * 15 + 127) / 255;
+				base[0][c] = color4a * 17;
+				base[1][c] = color4b * 17;
+				high |= (unsigned int)color4a << (28 - c * 8);
+				high |= (unsigned int)color4b << (24 - c * 8);
+			}
+		}
+		high |= (unsigned int)flip;
+
+		const EtcHalf first = EncodeEtcHalf(block, flip, 0, base[0]);
+		const EtcHalf second = EncodeEtcHalf(block, flip, 1, base[1]);
+		if (first.error + second.error >= bestError)
+			continue;
+		bestError = first.error + second.error;
+		high |= (unsigned int)first.table << 5;
+		high |= (unsigned int)second.table << 2;
+		const unsigned int low = ((first.msb | second.msb) << 16) | first.lsb | second.lsb;
+		bestBits = ((unsigned long long)high << 32) | low;
+	}
+	StoreBigEndian64(bestBits, out);
+}
+
+
+// --------------------------------------------------------------------------
+// EAC R11: an 8 bit base, a multiplier and one of sixteen modifier tables, and a 3 bit modifier
+// index per texel, decoded at 11 bits. Scaled to the block's range, each table covers it with a
+// different spread of values; how well a table fits only depends on where texels fall within the
+// range, which is looked up in a precomputed error table instead of trying every modifier.
+
+static const int kEacModifiers[16][8] =
+{
+	{ -3, -6, -9, -15, 2, 5, 8, 14 },
+	{ -3, -7, -10, -13, 2, 6, 9, 12 },
+	{ -2, -5, -8, -13, 1, 4, 7, 12 },
+	{ -2, -4, -6, -13, 1, 3, 5, 12 },
+	{ -3, -6, -8, -12, 2, 5, 7, 11 },
+	{ -3, -7, -9, -11, 2, 6, 8, 10 },
+	{ -4, -7, -8, -11, 3, 6, 7, 10 },
+	{ -3, -5, -8, -11, 2, 4, 7, 10 },
+	{ -2, -6, -8, -10, 1, 5, 7, 9 },
+	{ -2, -5, -8, -10, 1, 4, 7, 9 },
+	{ -2, -4, -8, -10, 1, 3, 7, 9 },
+	{ -2, -5, -7, -10, 1, 4, 6, 9 },
+	{ -3, -4, -7, -10, 2, 3, 6, 9 },
+	{ -1, -2, -3, -10, 0, 1, 2, 9 },
+	{ -4, -6, -8, -9, 3, 5, 7, 8 },
+	{ -3, -5, -7, -9, 2, 4, 6, 8 },
+};
+
+// Each table spans from modifier 3 (its lowest) to modifier 7 (its highest)
+enum { kEacFitBuckets = 32 };
+struct EacFitTable
+{
+	// Squared distance to the closest modifier, for texels in each bucket of the range; tables
+	// innermost, so a texel's errors for all of them add up in one vectorizable loop
+	unsigned int error[kEacFitBuckets][16];
+	EacFitTable()
+	{
+		for (int table = 0; table < 16; ++table)
+		{
+			const int* modifiers = kEacModifiers[table];
+			const float span = float(modifiers[7] - modifiers[3]);
+			for (int bucket = 0; bucket < kEacFitBuckets; ++bucket)
+			{
+				const float position = modifiers[3] + (bucket + 0.5f) * span / kEacFitBuckets;
+				float closest = span;
+				for (int i = 0; i < 8; ++i)
+				{
+					const float d = modifiers[i] > position ? modifiers[i] - position : position - modifiers[i];
+					closest = d < closest ? d : closest;
+				}
+				error[bucket][table] = (unsigned int)(closest / span * closest / span * 65535.0f);
+			}
+		}
+	}
+};
+static const EacFitTable s_EacFit;
+
+static void EncodeEACR11(const unsigned char block[64], unsigned char* out)
+{
+	unsigned char mn[4], mx[4];
+	GetBlockBounds(block, mn, mx);
+	const int lo = (mn[0] * 2047 + 127) / 255;
+	const int hi = (mx[0] * 2047 + 127) / 255;
+	const int range = hi - lo;
+
+	int target[16];
+	for (int y = 0; y < 4; ++y)
+	{
+		for (int x = 0; x < 4; ++x)
+			target[EtcTexelIndex(x, y)] = (block[(y * 4 + x) * 4] * 2047 + 127) / 255;
+	}
+
+	int table = 13;		// the one with a zero modifier, for flat blocks
+	int multiplier = 1;
+	if (range > 0)
+	{
+		unsigned int error[16] = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			const unsigned int* bucketError = s_EacFit.error[(target[i] - lo) * kEacFitBuckets / (range + 1)];
+			for (int t = 0; t < 16; ++t)
+				error[t] += bucketError[t];
+		}
+		unsigned int bestError = UINT_MAX;
+		for (int t = 0; t < 16; ++t)
+		{
+			if (error[t] < bestError)
+			{
+				bestError = error[t];
+				table = t;
+			}
+		}
+		const int span = kEacModifiers[table][7] - kEacModifiers[table][3];
+		multiplier = ClampInt((range + span * 4) / (span * 8), 1, 15);
+	}
+
+	// Center the table's values on the range; decoded value = base * 8 + 4 + modifier * multiplier * 8
+	const int* modifiers = kEacModifiers[table];
+	const int center = (lo + hi) / 2 - (modifiers[3] + modifiers[7]) * multiplier * 4 - 4;
+	const int base = ClampInt((center + 4) / 8, 0, 255);
+	int decoded[8];
+	for (int i = 0; i < 8; ++i)
+		decoded[i] = ClampInt(base * 8 + 4 + modifiers[i] * multiplier * 8, 0, 2047);
+
+	unsigned long long bits = ((unsigned long long)base << 56) | ((unsigned long long)multiplier << 52) | ((unsigned long long)table << 48);
+	for (int p = 0; p < 16; ++p)
+	{
+		int bestIndex = 0;
+		int bestDistance = INT_MAX;
+		for (int i = 0; i < 8; ++i)
+		{
+			const int distance = abs(decoded[i] - target[p]);
+			bestIndex = distance < bestDistance ? i : bestIndex;
+			bestDistance = distance < bestDistance ? distance : bestDistance;
+		}
+		bits |= (unsigned long long)bestIndex << (45 - p * 3);
+	}
+	StoreBigEndian64(bits, out);
+}
+
+
+typedef void (*BlockEncodeFunc)(const unsigned char block[64], unsigned char* out);
+
+static const BlockEncodeFunc kBlockEncoders[kBlockFormatCount] =
+{
+	NULL,
+	EncodeBC1,
+	EncodeBC4,
+	EncodeETC2RGB,
+	EncodeEACR11,
+};
+
+
+// --------------------------------------------------------------------------
+// BlockCompressor
+
+// Waking the workers costs more than a few rows of blocks take to encode
+static const int kMinBlockRowsPerThread = 4;
+
+BlockCompressor::BlockCompressor()
+	: m_JobGeneration(0)
+	, m_BusyWorkers(0)
+	, m_StopRequested(false)
+	, m_NextBlockRow(0)
+	, m_ThreadCount(1)
+{
+	memset(&m_Job, 0, sizeof(m_Job));
+	const unsigned hardwareThreads = std::thread::hardware_concurrency();
+	SetThreadCount(hardwareThreads > 0 ? (int)hardwareThreads : 1);
+}
+
+
+void BlockCompressor::SetThreadCount(int count)
+{
+	m_ThreadCount = ClampInt(count, 1, 4);
+}
+
+
+void BlockCompressor::Compress(TextureBlockFormat format, const unsigned char* src, int width, int height, int rowPitch, unsigned char* dst)
+{
+	assert(format > kBlockFormatNone && format < kBlockFormatCount);
+	Job job = { format, src, width, height, rowPitch, dst };
+	m_NextBlockRow = 0;
+
+	const int workerCount = m_ThreadCount - 1;
+	if (workerCount <= 0 || GetBlockCountY(height) < kMinBlockRowsPerThread * 2)
+	{
+		CompressRows(job);
+		return;
+	}
+	if ((int)m_Workers.size() != workerCount)
+	{
+		Stop();
+		StartWorkers(workerCount);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Job = job;
+		m_BusyWorkers = workerCount;
+		++m_JobGeneration;
+	}
+	m_Wake.notify_all();
+	CompressRows(job);
+
+	// Workers that came late still hold the job; they must be done with it before the next one
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	while (m_BusyWorkers > 0)
+		m_Done.wait(lock);
+}
+
+
+void BlockCompressor::Stop()
+{
+	if (m_Workers.empty())
+		return;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_StopRequested = true;
+	}
+	m_Wake.notify_all();
+	for (size_t i = 0; i < m_Workers.size(); ++i)
+		m_Workers[i].join();
+	m_Workers.clear();
+	m_StopRequested = false;
+}
+
+
+void BlockCompressor::StartWorkers(int count)
+{
+	for (int i = 0; i < count; ++i)
+		m_Workers.push_back(std::thread(&BlockCompressor::WorkerMain, this, m_JobGeneration));
+}
+
+
+// generation is that of the last job before the worker started; it waits for the next one
+void BlockCompressor::WorkerMain(unsigned generation)
+{
+	for (;;)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			while (!m_StopRequested && m_JobGeneration == generation)
+				m_Wake.wait(lock);
+			if (m_StopRequested)
+				return;
+			generation = m_JobGeneration;
+			job = m_Job;
+		}
+		CompressRows(job);
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (--m_BusyWorkers == 0)
+				m_Done.notify_one();
+		}
+	}
+}
+
+
+void BlockCompressor::CompressRows(const Job& job)
+{
+	const BlockEncodeFunc encode = kBlockEncoders[job.format];
+	const int blocksX = GetBlockCountX(job.width);
+	const int blocksY = GetBlockCountY(job.height);
+	const size_t rowBytes = (size_t)blocksX * kBlockBytes;
+	unsigned char block[64];
+	for (int blockY = m_NextBlockRow++; blockY < blocksY; blockY = m_NextBlockRow++)
+	{
+		unsigned char* out = job.dst + blockY * rowBytes;
+		for (int blockX = 0; blockX < blocksX; ++blockX)
+		{
+			FetchBlock(job.src, job.width, job.height, job.rowPitch, blockX, blockY, block);
+			encode(block, out + blockX * kBlockBytes);
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "PlatformBase.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Real-time block compression of RGBA8 texels, for textures the plugin generates every frame.
+// Uploading 4x4 blocks of 8 bytes instead of 64 bytes of RGBA8 cuts upload bandwidth and GPU memory
+// by 8x; the price is the encode, which is built for speed over quality: block bounds with SSE2 or
+// NEON, then a single pass picking indices. No exhaustive endpoint search.
+//
+// Single channel formats encode the red channel.
+
+enum TextureBlockFormat
+{
+	kBlockFormatNone = 0,	// uncompressed RGBA8
+	kBlockFormatBC1,		// DXT1, RGB; desktop
+	kBlockFormatBC4,		// one channel; desktop
+	kBlockFormatETC2RGB,	// RGB; GLES 3 and mobile Vulkan. Only ETC1 modes, so also ETC1 data for GLES 2.
+	kBlockFormatEACR11,		// one channel; GLES 3 and mobile Vulkan
+	kBlockFormatCount
+};
+
+// Every format stores a 4x4 block in 8 bytes; partial blocks at the right and bottom edges are
+// padded with the edge texels.
+enum { kBlockSize = 4, kBlockBytes = 8 };
+
+inline int GetBlockCountX(int width) { return (width + kBlockSize - 1) / kBlockSize; }
+inline int GetBlockCountY(int height) { return (height + kBlockSize - 1) / kBlockSize; }
+// Tightly packed size of a whole mip level; 0 for kBlockFormatNone
+size_t GetBlockCompressedSize(TextureBlockFormat format, int width, int height);
+
+
+// Encodes on the calling thread plus a few worker threads, each taking rows of blocks until none
+// are left. Workers start on first use. One Compress call at a time.
+class BlockCompressor
+{
+public:
+	BlockCompressor();
+	~BlockCompressor() { Stop(); }
+
+	// Threads that encode, the calling one included; 1 encodes on the calling thread only. Default
+	// is the number of hardware threads, at most 4. Takes effect with the next Compress call.
+	void SetThreadCount(int count);
+	int GetThreadCount() const { return m_ThreadCount; }
+
+	// Encode texels, rows rowPitch bytes apart, into tightly packed blocks; dst has to hold
+	// GetBlockCompressedSize bytes. Returns once all blocks are written.
+	void Compress(TextureBlockFormat format, const unsigned char* src, int width, int height, int rowPitch, unsigned char* dst);
+	// End the worker threads; they start again with the next Compress.
+	void Stop();
+
+private:
+	struct Job
+	{
+		TextureBlockFormat format;
+		const unsigned char* src;
+		int width;
+		int height;
+		int rowPitch;
+		unsigned char* dst;
+	};
+
+	void StartWorkers(int count);
+	void WorkerMain(unsigned generation);
+	void CompressRows(const Job& job);
+
+private:
+	std::vector<std::thread> m_Workers;
+	std::mutex m_Mutex;
+	std::condition_variable m_Wake;		// workers wait on this for a job
+	std::condition_variable m_Done;		// and the last one to finish it signals this
+	Job m_Job;
+	unsigned m_JobGeneration;			// bumped for every job the workers get
+	int m_BusyWorkers;
+	bool m_StopRequested;
+	std::atomic<int> m_NextBlockRow;
+	int m_ThreadCount;
+};
@@ -0,0 +1,235 @@
+#include "ChromeTrace.h"
+#include "PluginProfiler.h"
+
+// Chrome trace-event writer; see ChromeTrace.h.
+
+std::atomic<bool> g_ChromeTraceActive(false);
+
+#if SUPPORT_PLUGIN_PROFILER && !UNITY_WEBGL
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+
+// --------------------------------------------------------------------------
+// Event buffer. Recording threads append under a short lock; the writer thread swaps the whole
+// buffer out and formats it without holding the lock.
+
+enum ChromeTraceEventKind
+{
+	kChromeEventCpuScope = 0,	// ts and dur in profiler ticks
+	kChromeEventGpuScope,		// ts and dur in steady_clock nanoseconds
+	kChromeEventInstant,		// ts in profiler ticks
+	kChromeEventCounter,		// ts in profiler ticks
+};
+
+struct ChromeTraceEvent
+{
+	const char* name;
+	int kind;					// ChromeTraceEventKind
+	int tid;
+	unsigned long long ts;
+	unsigned long long dur;
+	double value;
+};
+
+// Tracks in the trace: 0 is the GPU, plugin threads get 1, 2, ... in the order they first record
+enum { kChromeGpuTid = 0 };
+
+// Flush early when this many events are waiting, otherwise every kChromeFlushIntervalMs
+enum { kChromeFlushEvents = 16384, kChromeFlushIntervalMs = 100 };
+
+static std::mutex s_ChromeMutex;
+static std::condition_variable s_ChromeWake;
+static std::vector<ChromeTraceEvent> s_ChromePending;
+static bool s_ChromeStopRequested = false;
+static std::thread s_ChromeThread;
+static FILE* s_ChromeFile = NULL;
+
+static std::atomic<int> s_ChromeNextTid(1);
+static thread_local int t_ChromeTid = 0;
+
+
+static int GetChromeThreadID()
+{
+	if (t_ChromeTid == 0)
+		t_ChromeTid = s_ChromeNextTid++;
+	return t_ChromeTid;
+}
+
+
+static void PushChromeEvent(const ChromeTraceEvent& ev)
+{
+	std::lock_guard<std::mutex> lock(s_ChromeMutex);
+	if (!s_ChromeFile || s_ChromeStopRequested)
+		return;
+	s_ChromePending.push_back(ev);
+	if (s_ChromePending.size() == kChromeFlushEvents)
+		s_ChromeWake.notify_one();
+}
+
+
+// --------------------------------------------------------------------------
+// Writer thread
+
+static void WriteChromeEvents(FILE* file, const std::vector<ChromeTraceEvent>& events, std::vector<bool>& namedThreads)
+{
+	const double usPerTick = GetProfilerNanosecondsPerTick() * 1e-3;
+	for (size_t i = 0; i < events.size(); ++i)
+	{
+		const ChromeTraceEvent& ev = events[i];
+
+		// Thread name metadata the first time a track shows up
+		if (ev.kind != kChromeEventCounter)
+		{
+			if (namedThreads.size() <= (size_t)ev.tid)
+				namedThreads.resize(ev.tid + 1, false);
+			if (!namedThreads[ev.tid])
+			{
+				namedThreads[ev.tid] = true;
+				if (ev.tid == kChromeGpuTid)
+					fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"GPU\"}}", ev.tid);
+				else
+					fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Plugin thread %d\"}}", ev.tid, ev.tid);
+			}
+		}
+
+		switch (ev.kind)
+		{
+		case kChromeEventCpuScope:
+			fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				ev.name, ev.tid, ProfilerTicksToSteadyNs(ev.ts) * 1e-3, ev.dur * usPerTick);
+			break;
+		case kChromeEventGpuScope:
+			fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				ev.name, ev.tid, ev.ts * 1e-3, ev.dur * 1e-3);
+			break;
+		case kChromeEventInstant:
+			fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"args\":{\"value\":%g}}",
+				ev.name, ev.tid, ProfilerTicksToSteadyNs(ev.ts) * 1e-3, ev.value);
+			break;
+		case kChromeEventCounter:
+			fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"value\":%g}}",
+				ev.name, ProfilerTicksToSteadyNs(ev.ts) * 1e-3, ev.value);
+			break;
+		}
+	}
+}
+
+
+static void ChromeTraceThread()
+{
+	std::vector<ChromeTraceEvent> events;
+	std::vector<bool> namedThreads;
+	for (;;)
+	{
+		bool stop;
+		{
+			std::unique_lock<std::mutex> lock(s_ChromeMutex);
+			if (!s_ChromeStopRequested && s_ChromePending.size() < kChromeFlushEvents)
+				s_ChromeWake.wait_for(lock, std::chrono::milliseconds(kChromeFlushIntervalMs));
+			events.swap(s_ChromePending);
+			stop = s_ChromeStopRequested;
+		}
+		WriteChromeEvents(s_ChromeFile, events, namedThreads);
+		events.clear();
+		if (stop)
+			break;
+	}
+}
+
+
+// --------------------------------------------------------------------------
+// Start / stop
+
+bool StartChromeTrace(const char* path)
+{
+	if (!path || IsChromeTraceActive())
+		return false;
+
+	FILE* file = fopen(path, "wb");
+	if (!file)
+		return false;
+
+	// Calibrate the tick conversion here rather than on the first flush
+	ProfilerTicksToSteadyNs(ProfilerTicks());
+
+	fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"RenderingPlugin\"}}");
+
+	{
+		std::lock_guard<std::mutex> lock(s_ChromeMutex);
+		s_ChromeFile = file;
+		s_ChromeStopRequested = false;
+		s_ChromePending.clear();
+		s_ChromePending.reserve(kChromeFlushEvents);
+	}
+	s_ChromeThread = std::thread(ChromeTraceThread);
+	g_ChromeTraceActive = true;
+	return true;
+}
+
+
+void StopChromeTrace()
+{
+	if (!IsChromeTraceActive())
+		return;
+	g_ChromeTraceActive = false;
+
+	{
+		std::lock_guard<std::mutex> lock(s_ChromeMutex);
+		s_ChromeStopRequested = true;
+	}
+	s_ChromeWake.notify_one();
+	s_ChromeThread.join();
+
+	std::lock_guard<std::mutex> lock(s_ChromeMutex);
+	fprintf(s_ChromeFile, "\n]}\n");
+	fclose(s_ChromeFile);
+	s_ChromeFile = NULL;
+	s_ChromePending.clear();
+}
+
+
+// --------------------------------------------------------------------------
+// Recording
+
+void ChromeTraceScope(const char* name, unsigned long long startTicks, unsigned long long durationTicks)
+{
+	ChromeTraceEvent ev = { name, kChromeEventCpuScope, GetChromeThreadID(), startTicks, durationTicks, 0.0 };
+	PushChromeEvent(ev);
+}
+
+void ChromeTraceGpuScope(const char* name, unsigned long long startNs, unsigned long long durationNs)
+{
+	ChromeTraceEvent ev = { name, kChromeEventGpuScope, kChromeGpuTid, startNs, durationNs, 0.0 };
+	PushChromeEvent(ev);
+}
+
+void ChromeTraceInstant(const char* name, double value)
+{
+	ChromeTraceEvent ev = { name, kChromeEventInstant, GetChromeThreadID(), ProfilerTicks(), 0, value };
+	PushChromeEvent(ev);
+}
+
+void ChromeTraceCounter(const char* name, double value)
+{
+	ChromeTraceEvent ev = { name, kChromeEventCounter, 0, ProfilerTicks(), 0, value };
+	PushChromeEvent(ev);
+}
+
+
+#else // #if SUPPORT_PLUGIN_PROFILER && !UNITY_WEBGL
+
+bool StartChromeTrace(const char* path) { return false; }
+void StopChromeTrace() { }
+void ChromeTraceScope(const char* name, unsigned long long startTicks, unsigned long long durationTicks) { }
+void ChromeTraceGpuScope(const char* name, unsigned long long startNs, unsigned long long durationNs) { }
+void ChromeTraceInstant(const char* name, double value) { }
+void ChromeTraceCounter(const char* name, double value) { }
+
+#endif // #if SUPPORT_PLUGIN_PROFILER && !UNITY_WEBGL
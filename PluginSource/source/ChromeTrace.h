@@ -0,0 +1,34 @@
+#pragma once
+
+#include "PlatformBase.h"
+
+#include <atomic>
+
+// Streams plugin activity to a Chrome trace-event JSON file, which chrome://tracing and Perfetto
+// open directly. Profiler scopes (PluginProfiler.h) become slices on the thread that ran them, GPU
+// timer results become slices on a separate "GPU" track, and render events and upload sizes show up
+// as instant and counter events.
+//
+// Timestamps are std::chrono::steady_clock microseconds, which is the clock the Unity profiler uses
+// as well on the desktop platforms, so a capture can be lined up with a Unity profiler capture of
+// the same run.
+//
+// Recording threads only append to an in-memory buffer; formatting and file I/O happen on a
+// background thread. Names passed in must be string literals (or otherwise live forever), they
+// are only stored as pointers. Needs SUPPORT_PLUGIN_PROFILER; without it, or on platforms without
+// threads, StartChromeTrace fails and nothing gets recorded.
+
+bool StartChromeTrace(const char* path);
+void StopChromeTrace();
+
+extern std::atomic<bool> g_ChromeTraceActive;
+inline bool IsChromeTraceActive() { return g_ChromeTraceActive.load(std::memory_order_relaxed); }
+
+// CPU slice on the calling thread; times are ProfilerTicks() values
+void ChromeTraceScope(const char* name, unsigned long long startTicks, unsigned long long durationTicks);
+// Slice on the GPU track; start in steady_clock nanoseconds
+void ChromeTraceGpuScope(const char* name, unsigned long long startNs, unsigned long long durationNs);
+// Instant event on the calling thread, with a value attached
+void ChromeTraceInstant(const char* name, double value);
+// Sample of a counter track
+void ChromeTraceCounter(const char* name, double value);
@@ -0,0 +1,106 @@
+#include "DebugMessages.h"
+#include "ChromeTrace.h"
+
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+
+#if UNITY_WIN
+#include <windows.h>
+#endif
+
+// Driver debug message counters; see DebugMessages.h.
+
+
+#if SUPPORT_DEBUG_MESSAGES
+
+// Atomics: drivers may report from their own threads when debug output is not synchronous, and
+// scripts read stats from the main thread
+struct DebugMessageCounters
+{
+	std::atomic<unsigned long long> total[kDebugMessageTypeCount];
+	std::atomic<unsigned long long> frame[kDebugMessageTypeCount];
+	std::atomic<unsigned long long> lastFrame[kDebugMessageTypeCount];
+	std::atomic<unsigned long long> performanceFrame[kProfileScopeCount + 1];
+	std::atomic<unsigned long long> performanceLastFrame[kProfileScopeCount + 1];
+};
+
+// Zero initialized, being static
+static DebugMessageCounters s_DebugMessageCounters;
+
+// Messages tend to repeat every frame; only the first few go to the log, the rest are just counted
+enum { kMaxLoggedDebugMessages = 64 };
+static std::atomic<int> s_LoggedDebugMessages(0);
+
+static const char* const kDebugMessageTypeNames[kDebugMessageTypeCount] = { "error", "deprecated", "undefined behavior", "portability", "performance", "other" };
+
+
+void RecordDebugMessage(DebugMessageType type, unsigned int id, const char* message, int length)
+{
+	const ProfilerScope scope = GetActiveProfilerScope();
+	DebugMessageCounters& c = s_DebugMessageCounters;
+	++c.total[type];
+	++c.frame[type];
+	if (type == kDebugMessagePerformance)
+	{
+		++c.performanceFrame[scope];
+		if (IsChromeTraceActive())
+			ChromeTraceInstant("DriverPerformanceWarning", id);
+	}
+
+	if (s_LoggedDebugMessages++ >= kMaxLoggedDebugMessages)
+		return;
+	if (!message)
+		message = "";
+	if (length < 0)
+		length = (int)strlen(message);
+	char text[1024];
+	snprintf(text, sizeof(text), "RenderingPlugin: driver %s message %u in %s: %.*s\n",
+		kDebugMessageTypeNames[type], id, scope < kProfileScopeCount ? GetProfilerScopeName(scope) : "Unity", length, message);
+#if UNITY_WIN
+	OutputDebugStringA(text);
+#else
+	fputs(text, stderr);
+#endif
+}
+
+
+void DebugMessagesNextFrame()
+{
+	DebugMessageCounters& c = s_DebugMessageCounters;
+	for (int i = 0; i < kDebugMessageTypeCount; ++i)
+		c.lastFrame[i] = c.frame[i].exchange(0);
+	for (int i = 0; i <= kProfileScopeCount; ++i)
+		c.performanceLastFrame[i] = c.performanceFrame[i].exchange(0);
+}
+
+
+bool GetDebugMessageStats(DebugMessageStats* outStats)
+{
+	if (!outStats)
+		return false;
+	const DebugMessageCounters& c = s_DebugMessageCounters;
+	for (int i = 0; i < kDebugMessageTypeCount; ++i)
+	{
+		outStats->total[i] = c.total[i];
+		outStats->lastFrame[i] = c.lastFrame[i];
+	}
+	for (int i = 0; i <= kProfileScopeCount; ++i)
+		outStats->performanceLastFrame[i] = c.performanceLastFrame[i];
+	return true;
+}
+
+
+#else // #if SUPPORT_DEBUG_MESSAGES
+
+void RecordDebugMessage(DebugMessageType type, unsigned int id, const char* message, int length) { }
+void DebugMessagesNextFrame() { }
+
+bool GetDebugMessageStats(DebugMessageStats* outStats)
+{
+	if (outStats)
+		memset(outStats, 0, sizeof(*outStats));
+	return false;
+}
+
+#endif // #if SUPPORT_DEBUG_MESSAGES
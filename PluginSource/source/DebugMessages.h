@@ -0,0 +1,42 @@
+#pragma once
+
+#include "PlatformBase.h"
+#include "PluginProfiler.h"
+
+// Messages the graphics driver sends about what the plugin does (GL KHR_debug output, and the
+// like): errors, undefined behavior, and above all performance warnings such as implicit syncs or
+// format conversions during uploads, which are otherwise invisible. Backends feed them in with
+// RecordDebugMessage; they get counted per type, and performance warnings additionally per
+// plugin scope (PluginProfiler.h) that was active when the driver reported them.
+//
+// Only compiled into builds that opt in; see SUPPORT_DEBUG_MESSAGES.
+
+enum DebugMessageType
+{
+	kDebugMessageError = 0,
+	kDebugMessageDeprecated,
+	kDebugMessageUndefinedBehavior,
+	kDebugMessagePortability,
+	kDebugMessagePerformance,
+	kDebugMessageOther,
+	kDebugMessageTypeCount
+};
+
+// Plain C layout, so scripts can marshal it directly. A frame ends at each SetTimeFromUnity call.
+struct DebugMessageStats
+{
+	unsigned long long total[kDebugMessageTypeCount];
+	unsigned long long lastFrame[kDebugMessageTypeCount];
+	// Performance warnings of the last frame, in ProfilerScope order; the last entry counts the
+	// ones reported outside of any plugin scope (i.e. about Unity's own rendering)
+	unsigned long long performanceLastFrame[kProfileScopeCount + 1];
+};
+
+// Called by backends from the thread that made the offending call, so the active scope is known.
+// message does not need to be null terminated; length < 0 means it is.
+void RecordDebugMessage(DebugMessageType type, unsigned int id, const char* message, int length);
+
+void DebugMessagesNextFrame();
+
+// Returns false, and zeroes outStats, when debug messages are compiled out. Can be called from any thread.
+bool GetDebugMessageStats(DebugMessageStats* outStats);
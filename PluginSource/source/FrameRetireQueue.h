@@ -0,0 +1,72 @@
+#pragma once
+
+#include <assert.h>
+#include <stddef.h>
+#include <vector>
+
+// Objects the GPU may still use, held until the frame they were last used in is done. The backend
+// numbers its frames and says which one the GPU finished last: Unity's safe frame number on Vulkan,
+// the last signaled fence on GL.
+//
+// A fixed ring of per frame lists, indexed by frame number: pushing and retiring a frame cost the
+// same however many frames are pending, and the lists keep their storage once it has grown to what
+// a frame retires, so steady state allocates nothing. Frames have to come in increasing order. A
+// frame landing on a list its frame kFrames back still holds joins that frame's objects; they then
+// wait for the newer frame, which is later than needed but never too early.
+template <typename T, int kFrames = 8>
+class FrameRetireQueue
+{
+public:
+	explicit FrameRetireQueue(size_t reservePerFrame = 16)
+		: m_Count(0)
+	{
+		for (int i = 0; i < kFrames; ++i)
+		{
+			m_Slots[i].frame = 0;
+			m_Slots[i].items.reserve(reservePerFrame);
+		}
+	}
+
+	void Push(unsigned long long frame, const T& item)
+	{
+		Slot& slot = m_Slots[frame % kFrames];
+		if (slot.items.empty() || slot.frame < frame)
+			slot.frame = frame;
+		slot.items.push_back(item);
+		++m_Count;
+	}
+
+	// Hand the objects of frames up to completedFrame to destroy(const T&)
+	template <typename Destroy>
+	void Retire(unsigned long long completedFrame, Destroy destroy)
+	{
+		for (int i = 0; i < kFrames && m_Count > 0; ++i)
+		{
+			Slot& slot = m_Slots[i];
+			if (slot.items.empty() || slot.frame > completedFrame)
+				continue;
+			for (size_t j = 0; j < slot.items.size(); ++j)
+				destroy(slot.items[j]);
+			assert(m_Count >= slot.items.size());
+			m_Count -= slot.items.size();
+			slot.items.clear();
+		}
+	}
+
+	bool IsEmpty() const { return m_Count == 0; }
+	bool HasFrame(unsigned long long frame) const
+	{
+		const Slot& slot = m_Slots[frame % kFrames];
+		return !slot.items.empty() && slot.frame == frame;
+	}
+
+private:
+	struct Slot
+	{
+		unsigned long long frame;
+		std::vector<T> items;
+	};
+
+	Slot m_Slots[kFrames];
+	size_t m_Count;
+};
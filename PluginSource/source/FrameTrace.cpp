@@ -0,0 +1,327 @@
+#include "FrameTrace.h"
+
+#include <chrono>
+#include <string.h>
+
+#if UNITY_METRO || UNITY_WEBGL
+	// No file mappings here; capture and replay are not available
+	#define FRAME_TRACE_MAPPING 0
+#elif UNITY_WIN
+	#define FRAME_TRACE_MAPPING 1
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#define FRAME_TRACE_MAPPING 1
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+
+// The file grows in steps of this much while capturing, and gets trimmed on close
+static const size_t kTraceGrowSize = 16 * 1024 * 1024;
+
+
+static uint64_t TraceNowNs()
+{
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static size_t AlignRecordSize(size_t size)
+{
+	return (size + 7) & ~(size_t)7;
+}
+
+
+// --------------------------------------------------------------------------
+// FrameTraceWriter
+
+
+FrameTraceWriter::FrameTraceWriter()
+	: m_Base(NULL)
+	, m_Capacity(0)
+	, m_Used(0)
+	, m_StartNs(0)
+#if UNITY_WIN
+	, m_File(INVALID_HANDLE_VALUE)
+	, m_Mapping(NULL)
+#else
+	, m_File(-1)
+#endif
+{
+}
+
+
+bool FrameTraceWriter::Open(const char* path)
+{
+	Close();
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+#if !FRAME_TRACE_MAPPING
+	return false;
+#else
+#	if UNITY_WIN
+	m_File = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m_File == INVALID_HANDLE_VALUE)
+		return false;
+#	else
+	m_File = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (m_File < 0)
+		return false;
+#	endif
+
+	if (!Map(kTraceGrowSize))
+	{
+		Unmap();
+		return false;
+	}
+
+	FrameTraceFileHeader header = { kFrameTraceMagic, kFrameTraceVersion };
+	memcpy(m_Base, &header, sizeof(header));
+	m_Used = sizeof(header);
+	m_StartNs = TraceNowNs();
+	return true;
+#endif // #if FRAME_TRACE_MAPPING
+}
+
+
+void FrameTraceWriter::Close()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	Unmap();
+	m_Used = 0;
+}
+
+
+bool FrameTraceWriter::Map(size_t capacity)
+{
+#if !FRAME_TRACE_MAPPING
+	return false;
+#elif UNITY_WIN
+	if (m_Base)
+	{
+		UnmapViewOfFile(m_Base);
+		CloseHandle(m_Mapping);
+		m_Base = NULL;
+		m_Mapping = NULL;
+	}
+	// Creating a mapping bigger than the file extends the file
+	m_Mapping = CreateFileMappingA(m_File, NULL, PAGE_READWRITE, (DWORD)((unsigned long long)capacity >> 32), (DWORD)capacity, NULL);
+	if (!m_Mapping)
+		return false;
+	m_Base = (unsigned char*)MapViewOfFile(m_Mapping, FILE_MAP_WRITE, 0, 0, capacity);
+	if (!m_Base)
+		return false;
+	m_Capacity = capacity;
+	return true;
+#else
+	if (m_Base)
+	{
+		munmap(m_Base, m_Capacity);
+		m_Base = NULL;
+	}
+	if (ftruncate(m_File, (off_t)capacity) != 0)
+		return false;
+	void* base = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_File, 0);
+	if (base == MAP_FAILED)
+		return false;
+	m_Base = (unsigned char*)base;
+	m_Capacity = capacity;
+	return true;
+#endif
+}
+
+
+void FrameTraceWriter::Unmap()
+{
+#if FRAME_TRACE_MAPPING
+#	if UNITY_WIN
+	if (m_Base)
+		UnmapViewOfFile(m_Base);
+	if (m_Mapping)
+		CloseHandle(m_Mapping);
+	if (m_File != INVALID_HANDLE_VALUE)
+	{
+		// Trim the unused tail of the last growth step
+		LARGE_INTEGER size;
+		size.QuadPart = (LONGLONG)m_Used;
+		SetFilePointerEx(m_File, size, NULL, FILE_BEGIN);
+		SetEndOfFile(m_File);
+		CloseHandle(m_File);
+	}
+	m_Mapping = NULL;
+	m_File = INVALID_HANDLE_VALUE;
+#	else
+	if (m_Base)
+		munmap(m_Base, m_Capacity);
+	if (m_File >= 0)
+	{
+		// Trim the unused tail of the last growth step
+		if (ftruncate(m_File, (off_t)m_Used) != 0)
+		{
+			// nothing sensible to do; the reader stops at the first empty record
+		}
+		close(m_File);
+	}
+	m_File = -1;
+#	endif
+#endif // #if FRAME_TRACE_MAPPING
+	m_Base = NULL;
+	m_Capacity = 0;
+}
+
+
+void FrameTraceWriter::Write(FrameTraceRecordType type, const Part* parts, int partCount)
+{
+	size_t payloadSize = 0;
+	for (int i = 0; i < partCount; ++i)
+		payloadSize += parts[i].size;
+	const size_t recordSize = sizeof(FrameTraceRecordHeader) + AlignRecordSize(payloadSize);
+
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	if (!m_Base)
+		return;
+
+	if (m_Used + recordSize > m_Capacity)
+	{
+		const size_t grow = recordSize > kTraceGrowSize ? AlignRecordSize(recordSize) : kTraceGrowSize;
+		if (!Map(m_Capacity + grow))
+		{
+			// Out of disk or address space; stop capturing but keep what was written so far
+			Unmap();
+			return;
+		}
+	}
+
+	FrameTraceRecordHeader header;
+	header.type = type;
+	header.size = (uint32_t)payloadSize;
+	header.timeNs = TraceNowNs() - m_StartNs;
+
+	unsigned char* dst = m_Base + m_Used;
+	memcpy(dst, &header, sizeof(header));
+	dst += sizeof(header);
+	for (int i = 0; i < partCount; ++i)
+	{
+		if (parts[i].size)
+			memcpy(dst, parts[i].data, parts[i].size);
+		dst += parts[i].size;
+	}
+	memset(dst, 0, AlignRecordSize(payloadSize) - payloadSize);
+	m_Used += recordSize;
+}
+
+
+
+// --------------------------------------------------------------------------
+// FrameTraceReader
+
+
+FrameTraceReader::FrameTraceReader()
+	: m_Base(NULL)
+	, m_Size(0)
+	, m_Offset(0)
+#if UNITY_WIN
+	, m_File(INVALID_HANDLE_VALUE)
+	, m_Mapping(NULL)
+#else
+	, m_File(-1)
+#endif
+{
+}
+
+
+bool FrameTraceReader::Open(const char* path)
+{
+	Close();
+
+#if !FRAME_TRACE_MAPPING
+	return false;
+#else
+#	if UNITY_WIN
+	m_File = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m_File == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(m_File, &size) || size.QuadPart < (LONGLONG)sizeof(FrameTraceFileHeader))
+	{
+		Close();
+		return false;
+	}
+	m_Size = (size_t)size.QuadPart;
+	m_Mapping = CreateFileMappingA(m_File, NULL, PAGE_READONLY, 0, 0, NULL);
+	m_Base = m_Mapping ? (const unsigned char*)MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+#	else
+	m_File = open(path, O_RDONLY);
+	if (m_File < 0)
+		return false;
+	struct stat st;
+	if (fstat(m_File, &st) != 0 || st.st_size < (off_t)sizeof(FrameTraceFileHeader))
+	{
+		Close();
+		return false;
+	}
+	m_Size = (size_t)st.st_size;
+	void* base = mmap(NULL, m_Size, PROT_READ, MAP_PRIVATE, m_File, 0);
+	m_Base = base != MAP_FAILED ? (const unsigned char*)base : NULL;
+#	endif
+
+	FrameTraceFileHeader header;
+	if (m_Base)
+		memcpy(&header, m_Base, sizeof(header));
+	if (!m_Base || header.magic != kFrameTraceMagic || header.version != kFrameTraceVersion)
+	{
+		Close();
+		return false;
+	}
+	m_Offset = sizeof(header);
+	return true;
+#endif // #if FRAME_TRACE_MAPPING
+}
+
+
+void FrameTraceReader::Close()
+{
+#if FRAME_TRACE_MAPPING
+#	if UNITY_WIN
+	if (m_Base)
+		UnmapViewOfFile(m_Base);
+	if (m_Mapping)
+		CloseHandle(m_Mapping);
+	if (m_File != INVALID_HANDLE_VALUE)
+		CloseHandle(m_File);
+	m_Mapping = NULL;
+	m_File = INVALID_HANDLE_VALUE;
+#	else
+	if (m_Base)
+		munmap((void*)m_Base, m_Size);
+	if (m_File >= 0)
+		close(m_File);
+	m_File = -1;
+#	endif
+#endif // #if FRAME_TRACE_MAPPING
+	m_Base = NULL;
+	m_Size = 0;
+	m_Offset = 0;
+}
+
+
+bool FrameTraceReader::Next(Record& outRecord)
+{
+	if (!m_Base || m_Offset + sizeof(FrameTraceRecordHeader) > m_Size)
+		return false;
+
+	FrameTraceRecordHeader header;
+	memcpy(&header, m_Base + m_Offset, sizeof(header));
+	// A zero type is the unwritten tail of a trace that was not closed properly
+	if (header.type == 0 || m_Offset + sizeof(header) + header.size > m_Size)
+		return false;
+
+	outRecord.type = (FrameTraceRecordType)header.type;
+	outRecord.timeNs = header.timeNs;
+	outRecord.payload = m_Base + m_Offset + sizeof(header);
+	outRecord.size = header.size;
+	m_Offset += sizeof(header) + AlignRecordSize(header.size);
+	return true;
+}
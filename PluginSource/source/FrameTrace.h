@@ -0,0 +1,130 @@
+#pragma once
+
+#include "PlatformBase.h"
+
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Binary trace of everything that feeds the plugin from the outside: exported setup calls (with
+// their payloads) and render events. A trace captured in a player can be replayed offline against
+// any backend, which makes performance problems reproducible without the original project.
+//
+// File layout: a FrameTraceFileHeader, then records back to back. Each record is a
+// FrameTraceRecordHeader followed by its payload, padded to 8 bytes. Handles are stored as 64 bit
+// values. The file is written and read through a memory mapping; capture only costs a memcpy.
+
+enum FrameTraceRecordType
+{
+	kTraceSetTime = 1,						// float time
+	kTraceSetTexture,						// TraceSetTexture
+	kTraceSetMeshBuffers,					// TraceSetMeshBuffers, then float3 positions, float3 normals, float2 uvs
+	kTraceRenderEvent,						// int eventID
+	kTraceSetVirtualTexture,				// TraceSetVirtualTexture
+	kTraceRequestVirtualTexturePages,		// unsigned int feedback[]
+	kTraceRequestVirtualTextureRegion,		// TraceRequestVirtualTextureRegion
+	kTraceSetVirtualTextureUploadBudget,	// int bytes per frame
+	kTraceRegisterNullBuffer,				// TraceRegisterNullBuffer
+	kTraceSetTextureBlockFormat,			// int TextureBlockFormat
+};
+
+enum { kFrameTraceMagic = 0x5450524E /* 'NRPT' */, kFrameTraceVersion = 1 };
+
+struct FrameTraceFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+};
+
+struct FrameTraceRecordHeader
+{
+	uint32_t type;			// FrameTraceRecordType
+	uint32_t size;			// payload size in bytes, without padding
+	uint64_t timeNs;		// since the start of the capture
+};
+
+// What a handle passed to the replay's remap callback is
+enum FrameTraceHandleKind
+{
+	kTraceHandleTexture = 0,			// width, height: texture size
+	kTraceHandleVertexBuffer,			// width: vertex count, height: vertex stride
+	kTraceHandleVirtualTextureCache,	// width, height: texture size
+	kTraceHandleVirtualTexturePageTable,// width, height: virtual texture size
+};
+
+struct TraceSetTexture { uint64_t handle; int32_t width; int32_t height; };
+struct TraceSetMeshBuffers { uint64_t handle; int32_t vertexCount; int32_t pad; };
+struct TraceSetVirtualTexture { uint64_t cacheHandle; uint64_t pageTableHandle; int32_t cacheWidth, cacheHeight, virtualWidth, virtualHeight, pageSize, border; };
+struct TraceRequestVirtualTextureRegion { float u0, v0, u1, v1; int32_t mipLevel; };
+struct TraceRegisterNullBuffer { uint64_t handle; int32_t size; int32_t pad; };
+
+
+// Appends records to a trace file. Records can come from any thread.
+class FrameTraceWriter
+{
+public:
+	struct Part { const void* data; size_t size; };
+
+	FrameTraceWriter();
+	~FrameTraceWriter() { Close(); }
+
+	bool Open(const char* path);
+	void Close();
+	bool IsOpen() const { return m_Base != NULL; }
+
+	void Write(FrameTraceRecordType type, const void* payload, size_t size) { Part part = { payload, size }; Write(type, &part, 1); }
+	// Payload gathered from several pieces
+	void Write(FrameTraceRecordType type, const Part* parts, int partCount);
+
+private:
+	bool Map(size_t capacity);
+	void Unmap();
+
+private:
+	std::mutex		m_Mutex;
+	unsigned char*	m_Base;
+	size_t			m_Capacity;
+	size_t			m_Used;
+	uint64_t		m_StartNs;
+#if UNITY_WIN
+	void*			m_File;
+	void*			m_Mapping;
+#else
+	int				m_File;
+#endif
+};
+
+
+// Reads a trace file record by record.
+class FrameTraceReader
+{
+public:
+	struct Record
+	{
+		FrameTraceRecordType type;
+		uint64_t timeNs;
+		const void* payload;
+		size_t size;
+	};
+
+	FrameTraceReader();
+	~FrameTraceReader() { Close(); }
+
+	bool Open(const char* path);
+	void Close();
+
+	// Returns false at the end of the trace, or if the rest of it is truncated.
+	bool Next(Record& outRecord);
+
+private:
+	const unsigned char*	m_Base;
+	size_t					m_Size;
+	size_t					m_Offset;
+#if UNITY_WIN
+	void*					m_File;
+	void*					m_Mapping;
+#else
+	int						m_File;
+#endif
+};
@@ -0,0 +1,47 @@
+#include "GLLoader.h"
+
+// GL entry point lookup for the generated dispatch table; see GLLoader.h.
+
+
+#if SUPPORT_GL_LOADER
+
+#if UNITY_WIN
+
+void* GLLoaderGetProcAddress(const char* name)
+{
+	void* proc = (void*)wglGetProcAddress(name);
+	// Some drivers return small values other than NULL on failure. GL 1.1 functions don't come from
+	// the driver at all, opengl32.dll exports them itself.
+	if ((size_t)proc <= 3 || proc == (void*)-1)
+		proc = (void*)GetProcAddress(GetModuleHandleA("opengl32.dll"), name);
+	return proc;
+}
+
+#else
+
+#include <dlfcn.h>
+
+typedef void* (*GetProcAddressFunc)(const char* name);
+typedef void* (*GetCurrentContextFunc)();
+
+// From whatever libEGL or libGL Unity has loaded; Unity's context is an EGL or a GLX one
+void* GLLoaderGetProcAddress(const char* name)
+{
+	static const GetCurrentContextFunc eglGetCurrentContext = (GetCurrentContextFunc)dlsym(RTLD_DEFAULT, "eglGetCurrentContext");
+	static const GetProcAddressFunc eglGetProcAddress = (GetProcAddressFunc)dlsym(RTLD_DEFAULT, "eglGetProcAddress");
+	static const GetProcAddressFunc glXGetProcAddress = (GetProcAddressFunc)dlsym(RTLD_DEFAULT, "glXGetProcAddressARB");
+
+	void* proc = NULL;
+	if (eglGetProcAddress && eglGetCurrentContext && eglGetCurrentContext())
+		proc = eglGetProcAddress(name);
+	else if (glXGetProcAddress)
+		proc = glXGetProcAddress(name);
+	// Before EGL 1.5, eglGetProcAddress doesn't have to know the core functions; libGL exports those
+	if (!proc)
+		proc = dlsym(RTLD_DEFAULT, name);
+	return proc;
+}
+
+#endif
+
+#endif // if SUPPORT_GL_LOADER
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "PlatformBase.h"
+
+// OpenGL loader for GL Core on Windows and Linux. The gl* functions the plugin calls go through
+// one dispatch table, and each one is resolved the first time it's called; nothing is looked up
+// when the plugin loads, and nothing is left for the dynamic linker to bind. Functions that only
+// exist with some GL versions or extensions are fetched with GLLoaderGetProcAddress once the
+// context says it has them, so the plugin still loads on drivers without them.
+//
+// The table only has what the GL backend calls. It's generated (GLLoaderFunctions.h/.cpp) by
+// tools/GenerateGLLoader.py, which has to run again when the backend calls a GL function it
+// didn't call before.
+
+#if SUPPORT_GL_LOADER
+
+#if UNITY_WIN
+#	include "gl3w/glcorearb.h"
+#else
+// Types and enums only; the prototypes it declares are for the functions libGL exports, which the
+// macros in GLLoaderFunctions.h route around
+#	include <GL/gl.h>
+#endif
+
+// Address of a GL entry point for the current context's driver, NULL when there is none
+void* GLLoaderGetProcAddress(const char* name);
+
+// Point every table entry back at its resolving stub. For a new context: on Windows, entry points
+// can differ between the contexts of different drivers.
+void GLLoaderReset();
+
+#include "GLLoaderFunctions.h"
+
+#endif // if SUPPORT_GL_LOADER
@@ -0,0 +1,521 @@
+// Generated by tools/GenerateGLLoader.py from the GL calls in RenderAPI_OpenGLCoreES.cpp
+// and the prototypes in glcorearb.h; do not edit.
+
+#include "GLLoader.h"
+
+#if SUPPORT_GL_LOADER
+
+#include <assert.h>
+
+
+// Every entry starts out at one of these: it puts the real function in the table and calls it.
+// Threads racing through a stub store the same pointer, so that needs no lock.
+static void APIENTRY Load_glAttachShader(GLuint program, GLuint shader)
+{
+	g_GLDispatch.AttachShader = (GLLoaderProc_glAttachShader)GLLoaderGetProcAddress("glAttachShader");
+	assert(g_GLDispatch.AttachShader);
+	return g_GLDispatch.AttachShader(program, shader);
+}
+
+static void APIENTRY Load_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+{
+	g_GLDispatch.BindAttribLocation = (GLLoaderProc_glBindAttribLocation)GLLoaderGetProcAddress("glBindAttribLocation");
+	assert(g_GLDispatch.BindAttribLocation);
+	return g_GLDispatch.BindAttribLocation(program, index, name);
+}
+
+static void APIENTRY Load_glBindBuffer(GLenum target, GLuint buffer)
+{
+	g_GLDispatch.BindBuffer = (GLLoaderProc_glBindBuffer)GLLoaderGetProcAddress("glBindBuffer");
+	assert(g_GLDispatch.BindBuffer);
+	return g_GLDispatch.BindBuffer(target, buffer);
+}
+
+static void APIENTRY Load_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+{
+	g_GLDispatch.BindFragDataLocation = (GLLoaderProc_glBindFragDataLocation)GLLoaderGetProcAddress("glBindFragDataLocation");
+	assert(g_GLDispatch.BindFragDataLocation);
+	return g_GLDispatch.BindFragDataLocation(program, color, name);
+}
+
+static void APIENTRY Load_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+	g_GLDispatch.BindFramebuffer = (GLLoaderProc_glBindFramebuffer)GLLoaderGetProcAddress("glBindFramebuffer");
+	assert(g_GLDispatch.BindFramebuffer);
+	return g_GLDispatch.BindFramebuffer(target, framebuffer);
+}
+
+static void APIENTRY Load_glBindTexture(GLenum target, GLuint texture)
+{
+	g_GLDispatch.BindTexture = (GLLoaderProc_glBindTexture)GLLoaderGetProcAddress("glBindTexture");
+	assert(g_GLDispatch.BindTexture);
+	return g_GLDispatch.BindTexture(target, texture);
+}
+
+static void APIENTRY Load_glBindVertexArray(GLuint array)
+{
+	g_GLDispatch.BindVertexArray = (GLLoaderProc_glBindVertexArray)GLLoaderGetProcAddress("glBindVertexArray");
+	assert(g_GLDispatch.BindVertexArray);
+	return g_GLDispatch.BindVertexArray(array);
+}
+
+static void APIENTRY Load_glBufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage)
+{
+	g_GLDispatch.BufferData = (GLLoaderProc_glBufferData)GLLoaderGetProcAddress("glBufferData");
+	assert(g_GLDispatch.BufferData);
+	return g_GLDispatch.BufferData(target, size, data, usage);
+}
+
+static void APIENTRY Load_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data)
+{
+	g_GLDispatch.BufferSubData = (GLLoaderProc_glBufferSubData)GLLoaderGetProcAddress("glBufferSubData");
+	assert(g_GLDispatch.BufferSubData);
+	return g_GLDispatch.BufferSubData(target, offset, size, data);
+}
+
+static GLenum APIENTRY Load_glCheckFramebufferStatus(GLenum target)
+{
+	g_GLDispatch.CheckFramebufferStatus = (GLLoaderProc_glCheckFramebufferStatus)GLLoaderGetProcAddress("glCheckFramebufferStatus");
+	assert(g_GLDispatch.CheckFramebufferStatus);
+	return g_GLDispatch.CheckFramebufferStatus(target);
+}
+
+static GLenum APIENTRY Load_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	g_GLDispatch.ClientWaitSync = (GLLoaderProc_glClientWaitSync)GLLoaderGetProcAddress("glClientWaitSync");
+	assert(g_GLDispatch.ClientWaitSync);
+	return g_GLDispatch.ClientWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY Load_glCompileShader(GLuint shader)
+{
+	g_GLDispatch.CompileShader = (GLLoaderProc_glCompileShader)GLLoaderGetProcAddress("glCompileShader");
+	assert(g_GLDispatch.CompileShader);
+	return g_GLDispatch.CompileShader(shader);
+}
+
+static void APIENTRY Load_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+	g_GLDispatch.CompressedTexSubImage2D = (GLLoaderProc_glCompressedTexSubImage2D)GLLoaderGetProcAddress("glCompressedTexSubImage2D");
+	assert(g_GLDispatch.CompressedTexSubImage2D);
+	return g_GLDispatch.CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static GLuint APIENTRY Load_glCreateProgram(void)
+{
+	g_GLDispatch.CreateProgram = (GLLoaderProc_glCreateProgram)GLLoaderGetProcAddress("glCreateProgram");
+	assert(g_GLDispatch.CreateProgram);
+	return g_GLDispatch.CreateProgram();
+}
+
+static GLuint APIENTRY Load_glCreateShader(GLenum type)
+{
+	g_GLDispatch.CreateShader = (GLLoaderProc_glCreateShader)GLLoaderGetProcAddress("glCreateShader");
+	assert(g_GLDispatch.CreateShader);
+	return g_GLDispatch.CreateShader(type);
+}
+
+static void APIENTRY Load_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+	g_GLDispatch.DeleteBuffers = (GLLoaderProc_glDeleteBuffers)GLLoaderGetProcAddress("glDeleteBuffers");
+	assert(g_GLDispatch.DeleteBuffers);
+	return g_GLDispatch.DeleteBuffers(n, buffers);
+}
+
+static void APIENTRY Load_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+	g_GLDispatch.DeleteFramebuffers = (GLLoaderProc_glDeleteFramebuffers)GLLoaderGetProcAddress("glDeleteFramebuffers");
+	assert(g_GLDispatch.DeleteFramebuffers);
+	return g_GLDispatch.DeleteFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY Load_glDeleteProgram(GLuint program)
+{
+	g_GLDispatch.DeleteProgram = (GLLoaderProc_glDeleteProgram)GLLoaderGetProcAddress("glDeleteProgram");
+	assert(g_GLDispatch.DeleteProgram);
+	return g_GLDispatch.DeleteProgram(program);
+}
+
+static void APIENTRY Load_glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+	g_GLDispatch.DeleteQueries = (GLLoaderProc_glDeleteQueries)GLLoaderGetProcAddress("glDeleteQueries");
+	assert(g_GLDispatch.DeleteQueries);
+	return g_GLDispatch.DeleteQueries(n, ids);
+}
+
+static void APIENTRY Load_glDeleteShader(GLuint shader)
+{
+	g_GLDispatch.DeleteShader = (GLLoaderProc_glDeleteShader)GLLoaderGetProcAddress("glDeleteShader");
+	assert(g_GLDispatch.DeleteShader);
+	return g_GLDispatch.DeleteShader(shader);
+}
+
+static void APIENTRY Load_glDeleteSync(GLsync sync)
+{
+	g_GLDispatch.DeleteSync = (GLLoaderProc_glDeleteSync)GLLoaderGetProcAddress("glDeleteSync");
+	assert(g_GLDispatch.DeleteSync);
+	return g_GLDispatch.DeleteSync(sync);
+}
+
+static void APIENTRY Load_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+	g_GLDispatch.DeleteVertexArrays = (GLLoaderProc_glDeleteVertexArrays)GLLoaderGetProcAddress("glDeleteVertexArrays");
+	assert(g_GLDispatch.DeleteVertexArrays);
+	return g_GLDispatch.DeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY Load_glDepthFunc(GLenum func)
+{
+	g_GLDispatch.DepthFunc = (GLLoaderProc_glDepthFunc)GLLoaderGetProcAddress("glDepthFunc");
+	assert(g_GLDispatch.DepthFunc);
+	return g_GLDispatch.DepthFunc(func);
+}
+
+static void APIENTRY Load_glDepthMask(GLboolean flag)
+{
+	g_GLDispatch.DepthMask = (GLLoaderProc_glDepthMask)GLLoaderGetProcAddress("glDepthMask");
+	assert(g_GLDispatch.DepthMask);
+	return g_GLDispatch.DepthMask(flag);
+}
+
+static void APIENTRY Load_glDisable(GLenum cap)
+{
+	g_GLDispatch.Disable = (GLLoaderProc_glDisable)GLLoaderGetProcAddress("glDisable");
+	assert(g_GLDispatch.Disable);
+	return g_GLDispatch.Disable(cap);
+}
+
+static void APIENTRY Load_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	g_GLDispatch.DrawArrays = (GLLoaderProc_glDrawArrays)GLLoaderGetProcAddress("glDrawArrays");
+	assert(g_GLDispatch.DrawArrays);
+	return g_GLDispatch.DrawArrays(mode, first, count);
+}
+
+static void APIENTRY Load_glEnable(GLenum cap)
+{
+	g_GLDispatch.Enable = (GLLoaderProc_glEnable)GLLoaderGetProcAddress("glEnable");
+	assert(g_GLDispatch.Enable);
+	return g_GLDispatch.Enable(cap);
+}
+
+static void APIENTRY Load_glEnableVertexAttribArray(GLuint index)
+{
+	g_GLDispatch.EnableVertexAttribArray = (GLLoaderProc_glEnableVertexAttribArray)GLLoaderGetProcAddress("glEnableVertexAttribArray");
+	assert(g_GLDispatch.EnableVertexAttribArray);
+	return g_GLDispatch.EnableVertexAttribArray(index);
+}
+
+static GLsync APIENTRY Load_glFenceSync(GLenum condition, GLbitfield flags)
+{
+	g_GLDispatch.FenceSync = (GLLoaderProc_glFenceSync)GLLoaderGetProcAddress("glFenceSync");
+	assert(g_GLDispatch.FenceSync);
+	return g_GLDispatch.FenceSync(condition, flags);
+}
+
+static void APIENTRY Load_glFlush(void)
+{
+	g_GLDispatch.Flush = (GLLoaderProc_glFlush)GLLoaderGetProcAddress("glFlush");
+	assert(g_GLDispatch.Flush);
+	return g_GLDispatch.Flush();
+}
+
+static void APIENTRY Load_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+	g_GLDispatch.FramebufferTexture2D = (GLLoaderProc_glFramebufferTexture2D)GLLoaderGetProcAddress("glFramebufferTexture2D");
+	assert(g_GLDispatch.FramebufferTexture2D);
+	return g_GLDispatch.FramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY Load_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+	g_GLDispatch.GenBuffers = (GLLoaderProc_glGenBuffers)GLLoaderGetProcAddress("glGenBuffers");
+	assert(g_GLDispatch.GenBuffers);
+	return g_GLDispatch.GenBuffers(n, buffers);
+}
+
+static void APIENTRY Load_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+	g_GLDispatch.GenFramebuffers = (GLLoaderProc_glGenFramebuffers)GLLoaderGetProcAddress("glGenFramebuffers");
+	assert(g_GLDispatch.GenFramebuffers);
+	return g_GLDispatch.GenFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY Load_glGenQueries(GLsizei n, GLuint *ids)
+{
+	g_GLDispatch.GenQueries = (GLLoaderProc_glGenQueries)GLLoaderGetProcAddress("glGenQueries");
+	assert(g_GLDispatch.GenQueries);
+	return g_GLDispatch.GenQueries(n, ids);
+}
+
+static void APIENTRY Load_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+	g_GLDispatch.GenVertexArrays = (GLLoaderProc_glGenVertexArrays)GLLoaderGetProcAddress("glGenVertexArrays");
+	assert(g_GLDispatch.GenVertexArrays);
+	return g_GLDispatch.GenVertexArrays(n, arrays);
+}
+
+static void APIENTRY Load_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+	g_GLDispatch.GetBufferParameteriv = (GLLoaderProc_glGetBufferParameteriv)GLLoaderGetProcAddress("glGetBufferParameteriv");
+	assert(g_GLDispatch.GetBufferParameteriv);
+	return g_GLDispatch.GetBufferParameteriv(target, pname, params);
+}
+
+static GLenum APIENTRY Load_glGetError(void)
+{
+	g_GLDispatch.GetError = (GLLoaderProc_glGetError)GLLoaderGetProcAddress("glGetError");
+	assert(g_GLDispatch.GetError);
+	return g_GLDispatch.GetError();
+}
+
+static void APIENTRY Load_glGetInteger64v(GLenum pname, GLint64 *params)
+{
+	g_GLDispatch.GetInteger64v = (GLLoaderProc_glGetInteger64v)GLLoaderGetProcAddress("glGetInteger64v");
+	assert(g_GLDispatch.GetInteger64v);
+	return g_GLDispatch.GetInteger64v(pname, params);
+}
+
+static void APIENTRY Load_glGetIntegerv(GLenum pname, GLint *params)
+{
+	g_GLDispatch.GetIntegerv = (GLLoaderProc_glGetIntegerv)GLLoaderGetProcAddress("glGetIntegerv");
+	assert(g_GLDispatch.GetIntegerv);
+	return g_GLDispatch.GetIntegerv(pname, params);
+}
+
+static void APIENTRY Load_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, GLvoid *binary)
+{
+	g_GLDispatch.GetProgramBinary = (GLLoaderProc_glGetProgramBinary)GLLoaderGetProcAddress("glGetProgramBinary");
+	assert(g_GLDispatch.GetProgramBinary);
+	return g_GLDispatch.GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+
+static void APIENTRY Load_glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+	g_GLDispatch.GetProgramiv = (GLLoaderProc_glGetProgramiv)GLLoaderGetProcAddress("glGetProgramiv");
+	assert(g_GLDispatch.GetProgramiv);
+	return g_GLDispatch.GetProgramiv(program, pname, params);
+}
+
+static void APIENTRY Load_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+{
+	g_GLDispatch.GetQueryObjectui64v = (GLLoaderProc_glGetQueryObjectui64v)GLLoaderGetProcAddress("glGetQueryObjectui64v");
+	assert(g_GLDispatch.GetQueryObjectui64v);
+	return g_GLDispatch.GetQueryObjectui64v(id, pname, params);
+}
+
+static void APIENTRY Load_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+	g_GLDispatch.GetQueryObjectuiv = (GLLoaderProc_glGetQueryObjectuiv)GLLoaderGetProcAddress("glGetQueryObjectuiv");
+	assert(g_GLDispatch.GetQueryObjectuiv);
+	return g_GLDispatch.GetQueryObjectuiv(id, pname, params);
+}
+
+static const GLubyte * APIENTRY Load_glGetString(GLenum name)
+{
+	g_GLDispatch.GetString = (GLLoaderProc_glGetString)GLLoaderGetProcAddress("glGetString");
+	assert(g_GLDispatch.GetString);
+	return g_GLDispatch.GetString(name);
+}
+
+static const GLubyte * APIENTRY Load_glGetStringi(GLenum name, GLuint index)
+{
+	g_GLDispatch.GetStringi = (GLLoaderProc_glGetStringi)GLLoaderGetProcAddress("glGetStringi");
+	assert(g_GLDispatch.GetStringi);
+	return g_GLDispatch.GetStringi(name, index);
+}
+
+static void APIENTRY Load_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+{
+	g_GLDispatch.GetTexLevelParameteriv = (GLLoaderProc_glGetTexLevelParameteriv)GLLoaderGetProcAddress("glGetTexLevelParameteriv");
+	assert(g_GLDispatch.GetTexLevelParameteriv);
+	return g_GLDispatch.GetTexLevelParameteriv(target, level, pname, params);
+}
+
+static GLint APIENTRY Load_glGetUniformLocation(GLuint program, const GLchar *name)
+{
+	g_GLDispatch.GetUniformLocation = (GLLoaderProc_glGetUniformLocation)GLLoaderGetProcAddress("glGetUniformLocation");
+	assert(g_GLDispatch.GetUniformLocation);
+	return g_GLDispatch.GetUniformLocation(program, name);
+}
+
+static GLboolean APIENTRY Load_glIsEnabled(GLenum cap)
+{
+	g_GLDispatch.IsEnabled = (GLLoaderProc_glIsEnabled)GLLoaderGetProcAddress("glIsEnabled");
+	assert(g_GLDispatch.IsEnabled);
+	return g_GLDispatch.IsEnabled(cap);
+}
+
+static void APIENTRY Load_glLinkProgram(GLuint program)
+{
+	g_GLDispatch.LinkProgram = (GLLoaderProc_glLinkProgram)GLLoaderGetProcAddress("glLinkProgram");
+	assert(g_GLDispatch.LinkProgram);
+	return g_GLDispatch.LinkProgram(program);
+}
+
+static GLvoid* APIENTRY Load_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	g_GLDispatch.MapBufferRange = (GLLoaderProc_glMapBufferRange)GLLoaderGetProcAddress("glMapBufferRange");
+	assert(g_GLDispatch.MapBufferRange);
+	return g_GLDispatch.MapBufferRange(target, offset, length, access);
+}
+
+static void APIENTRY Load_glPixelStorei(GLenum pname, GLint param)
+{
+	g_GLDispatch.PixelStorei = (GLLoaderProc_glPixelStorei)GLLoaderGetProcAddress("glPixelStorei");
+	assert(g_GLDispatch.PixelStorei);
+	return g_GLDispatch.PixelStorei(pname, param);
+}
+
+static void APIENTRY Load_glProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid *binary, GLsizei length)
+{
+	g_GLDispatch.ProgramBinary = (GLLoaderProc_glProgramBinary)GLLoaderGetProcAddress("glProgramBinary");
+	assert(g_GLDispatch.ProgramBinary);
+	return g_GLDispatch.ProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void APIENTRY Load_glProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+	g_GLDispatch.ProgramParameteri = (GLLoaderProc_glProgramParameteri)GLLoaderGetProcAddress("glProgramParameteri");
+	assert(g_GLDispatch.ProgramParameteri);
+	return g_GLDispatch.ProgramParameteri(program, pname, value);
+}
+
+static void APIENTRY Load_glQueryCounter(GLuint id, GLenum target)
+{
+	g_GLDispatch.QueryCounter = (GLLoaderProc_glQueryCounter)GLLoaderGetProcAddress("glQueryCounter");
+	assert(g_GLDispatch.QueryCounter);
+	return g_GLDispatch.QueryCounter(id, target);
+}
+
+static void APIENTRY Load_glShaderSource(GLuint shader, GLsizei count, const GLchar* const *string, const GLint *length)
+{
+	g_GLDispatch.ShaderSource = (GLLoaderProc_glShaderSource)GLLoaderGetProcAddress("glShaderSource");
+	assert(g_GLDispatch.ShaderSource);
+	return g_GLDispatch.ShaderSource(shader, count, string, length);
+}
+
+static void APIENTRY Load_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
+{
+	g_GLDispatch.TexSubImage2D = (GLLoaderProc_glTexSubImage2D)GLLoaderGetProcAddress("glTexSubImage2D");
+	assert(g_GLDispatch.TexSubImage2D);
+	return g_GLDispatch.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY Load_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+	g_GLDispatch.UniformMatrix4fv = (GLLoaderProc_glUniformMatrix4fv)GLLoaderGetProcAddress("glUniformMatrix4fv");
+	assert(g_GLDispatch.UniformMatrix4fv);
+	return g_GLDispatch.UniformMatrix4fv(location, count, transpose, value);
+}
+
+static GLboolean APIENTRY Load_glUnmapBuffer(GLenum target)
+{
+	g_GLDispatch.UnmapBuffer = (GLLoaderProc_glUnmapBuffer)GLLoaderGetProcAddress("glUnmapBuffer");
+	assert(g_GLDispatch.UnmapBuffer);
+	return g_GLDispatch.UnmapBuffer(target);
+}
+
+static void APIENTRY Load_glUseProgram(GLuint program)
+{
+	g_GLDispatch.UseProgram = (GLLoaderProc_glUseProgram)GLLoaderGetProcAddress("glUseProgram");
+	assert(g_GLDispatch.UseProgram);
+	return g_GLDispatch.UseProgram(program);
+}
+
+static void APIENTRY Load_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+	g_GLDispatch.VertexAttribDivisor = (GLLoaderProc_glVertexAttribDivisor)GLLoaderGetProcAddress("glVertexAttribDivisor");
+	assert(g_GLDispatch.VertexAttribDivisor);
+	return g_GLDispatch.VertexAttribDivisor(index, divisor);
+}
+
+static void APIENTRY Load_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer)
+{
+	g_GLDispatch.VertexAttribPointer = (GLLoaderProc_glVertexAttribPointer)GLLoaderGetProcAddress("glVertexAttribPointer");
+	assert(g_GLDispatch.VertexAttribPointer);
+	return g_GLDispatch.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY Load_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	g_GLDispatch.WaitSync = (GLLoaderProc_glWaitSync)GLLoaderGetProcAddress("glWaitSync");
+	assert(g_GLDispatch.WaitSync);
+	return g_GLDispatch.WaitSync(sync, flags, timeout);
+}
+
+
+static const GLLoaderDispatch kLoaders =
+{
+	Load_glAttachShader,
+	Load_glBindAttribLocation,
+	Load_glBindBuffer,
+	Load_glBindFragDataLocation,
+	Load_glBindFramebuffer,
+	Load_glBindTexture,
+	Load_glBindVertexArray,
+	Load_glBufferData,
+	Load_glBufferSubData,
+	Load_glCheckFramebufferStatus,
+	Load_glClientWaitSync,
+	Load_glCompileShader,
+	Load_glCompressedTexSubImage2D,
+	Load_glCreateProgram,
+	Load_glCreateShader,
+	Load_glDeleteBuffers,
+	Load_glDeleteFramebuffers,
+	Load_glDeleteProgram,
+	Load_glDeleteQueries,
+	Load_glDeleteShader,
+	Load_glDeleteSync,
+	Load_glDeleteVertexArrays,
+	Load_glDepthFunc,
+	Load_glDepthMask,
+	Load_glDisable,
+	Load_glDrawArrays,
+	Load_glEnable,
+	Load_glEnableVertexAttribArray,
+	Load_glFenceSync,
+	Load_glFlush,
+	Load_glFramebufferTexture2D,
+	Load_glGenBuffers,
+	Load_glGenFramebuffers,
+	Load_glGenQueries,
+	Load_glGenVertexArrays,
+	Load_glGetBufferParameteriv,
+	Load_glGetError,
+	Load_glGetInteger64v,
+	Load_glGetIntegerv,
+	Load_glGetProgramBinary,
+	Load_glGetProgramiv,
+	Load_glGetQueryObjectui64v,
+	Load_glGetQueryObjectuiv,
+	Load_glGetString,
+	Load_glGetStringi,
+	Load_glGetTexLevelParameteriv,
+	Load_glGetUniformLocation,
+	Load_glIsEnabled,
+	Load_glLinkProgram,
+	Load_glMapBufferRange,
+	Load_glPixelStorei,
+	Load_glProgramBinary,
+	Load_glProgramParameteri,
+	Load_glQueryCounter,
+	Load_glShaderSource,
+	Load_glTexSubImage2D,
+	Load_glUniformMatrix4fv,
+	Load_glUnmapBuffer,
+	Load_glUseProgram,
+	Load_glVertexAttribDivisor,
+	Load_glVertexAttribPointer,
+	Load_glWaitSync,
+};
+
+GLLoaderDispatch g_GLDispatch = kLoaders;
+
+void GLLoaderReset()
+{
+	g_GLDispatch = kLoaders;
+}
+
+#endif // if SUPPORT_GL_LOADER
@@ -0,0 +1,200 @@
+// Generated by tools/GenerateGLLoader.py from the GL calls in RenderAPI_OpenGLCoreES.cpp
+// and the prototypes in glcorearb.h; do not edit.
+
+#pragma once
+
+// Included by GLLoader.h, after the GL headers
+
+typedef void (APIENTRY* GLLoaderProc_glAttachShader)(GLuint program, GLuint shader);
+typedef void (APIENTRY* GLLoaderProc_glBindAttribLocation)(GLuint program, GLuint index, const GLchar *name);
+typedef void (APIENTRY* GLLoaderProc_glBindBuffer)(GLenum target, GLuint buffer);
+typedef void (APIENTRY* GLLoaderProc_glBindFragDataLocation)(GLuint program, GLuint color, const GLchar *name);
+typedef void (APIENTRY* GLLoaderProc_glBindFramebuffer)(GLenum target, GLuint framebuffer);
+typedef void (APIENTRY* GLLoaderProc_glBindTexture)(GLenum target, GLuint texture);
+typedef void (APIENTRY* GLLoaderProc_glBindVertexArray)(GLuint array);
+typedef void (APIENTRY* GLLoaderProc_glBufferData)(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage);
+typedef void (APIENTRY* GLLoaderProc_glBufferSubData)(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data);
+typedef GLenum (APIENTRY* GLLoaderProc_glCheckFramebufferStatus)(GLenum target);
+typedef GLenum (APIENTRY* GLLoaderProc_glClientWaitSync)(GLsync sync, GLbitfield flags, GLuint64 timeout);
+typedef void (APIENTRY* GLLoaderProc_glCompileShader)(GLuint shader);
+typedef void (APIENTRY* GLLoaderProc_glCompressedTexSubImage2D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data);
+typedef GLuint (APIENTRY* GLLoaderProc_glCreateProgram)(void);
+typedef GLuint (APIENTRY* GLLoaderProc_glCreateShader)(GLenum type);
+typedef void (APIENTRY* GLLoaderProc_glDeleteBuffers)(GLsizei n, const GLuint *buffers);
+typedef void (APIENTRY* GLLoaderProc_glDeleteFramebuffers)(GLsizei n, const GLuint *framebuffers);
+typedef void (APIENTRY* GLLoaderProc_glDeleteProgram)(GLuint program);
+typedef void (APIENTRY* GLLoaderProc_glDeleteQueries)(GLsizei n, const GLuint *ids);
+typedef void (APIENTRY* GLLoaderProc_glDeleteShader)(GLuint shader);
+typedef void (APIENTRY* GLLoaderProc_glDeleteSync)(GLsync sync);
+typedef void (APIENTRY* GLLoaderProc_glDeleteVertexArrays)(GLsizei n, const GLuint *arrays);
+typedef void (APIENTRY* GLLoaderProc_glDepthFunc)(GLenum func);
+typedef void (APIENTRY* GLLoaderProc_glDepthMask)(GLboolean flag);
+typedef void (APIENTRY* GLLoaderProc_glDisable)(GLenum cap);
+typedef void (APIENTRY* GLLoaderProc_glDrawArrays)(GLenum mode, GLint first, GLsizei count);
+typedef void (APIENTRY* GLLoaderProc_glEnable)(GLenum cap);
+typedef void (APIENTRY* GLLoaderProc_glEnableVertexAttribArray)(GLuint index);
+typedef GLsync (APIENTRY* GLLoaderProc_glFenceSync)(GLenum condition, GLbitfield flags);
+typedef void (APIENTRY* GLLoaderProc_glFlush)(void);
+typedef void (APIENTRY* GLLoaderProc_glFramebufferTexture2D)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef void (APIENTRY* GLLoaderProc_glGenBuffers)(GLsizei n, GLuint *buffers);
+typedef void (APIENTRY* GLLoaderProc_glGenFramebuffers)(GLsizei n, GLuint *framebuffers);
+typedef void (APIENTRY* GLLoaderProc_glGenQueries)(GLsizei n, GLuint *ids);
+typedef void (APIENTRY* GLLoaderProc_glGenVertexArrays)(GLsizei n, GLuint *arrays);
+typedef void (APIENTRY* GLLoaderProc_glGetBufferParameteriv)(GLenum target, GLenum pname, GLint *params);
+typedef GLenum (APIENTRY* GLLoaderProc_glGetError)(void);
+typedef void (APIENTRY* GLLoaderProc_glGetInteger64v)(GLenum pname, GLint64 *params);
+typedef void (APIENTRY* GLLoaderProc_glGetIntegerv)(GLenum pname, GLint *params);
+typedef void (APIENTRY* GLLoaderProc_glGetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, GLvoid *binary);
+typedef void (APIENTRY* GLLoaderProc_glGetProgramiv)(GLuint program, GLenum pname, GLint *params);
+typedef void (APIENTRY* GLLoaderProc_glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64 *params);
+typedef void (APIENTRY* GLLoaderProc_glGetQueryObjectuiv)(GLuint id, GLenum pname, GLuint *params);
+typedef const GLubyte * (APIENTRY* GLLoaderProc_glGetString)(GLenum name);
+typedef const GLubyte * (APIENTRY* GLLoaderProc_glGetStringi)(GLenum name, GLuint index);
+typedef void (APIENTRY* GLLoaderProc_glGetTexLevelParameteriv)(GLenum target, GLint level, GLenum pname, GLint *params);
+typedef GLint (APIENTRY* GLLoaderProc_glGetUniformLocation)(GLuint program, const GLchar *name);
+typedef GLboolean (APIENTRY* GLLoaderProc_glIsEnabled)(GLenum cap);
+typedef void (APIENTRY* GLLoaderProc_glLinkProgram)(GLuint program);
+typedef GLvoid* (APIENTRY* GLLoaderProc_glMapBufferRange)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef void (APIENTRY* GLLoaderProc_glPixelStorei)(GLenum pname, GLint param);
+typedef void (APIENTRY* GLLoaderProc_glProgramBinary)(GLuint program, GLenum binaryFormat, const GLvoid *binary, GLsizei length);
+typedef void (APIENTRY* GLLoaderProc_glProgramParameteri)(GLuint program, GLenum pname, GLint value);
+typedef void (APIENTRY* GLLoaderProc_glQueryCounter)(GLuint id, GLenum target);
+typedef void (APIENTRY* GLLoaderProc_glShaderSource)(GLuint shader, GLsizei count, const GLchar* const *string, const GLint *length);
+typedef void (APIENTRY* GLLoaderProc_glTexSubImage2D)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels);
+typedef void (APIENTRY* GLLoaderProc_glUniformMatrix4fv)(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+typedef GLboolean (APIENTRY* GLLoaderProc_glUnmapBuffer)(GLenum target);
+typedef void (APIENTRY* GLLoaderProc_glUseProgram)(GLuint program);
+typedef void (APIENTRY* GLLoaderProc_glVertexAttribDivisor)(GLuint index, GLuint divisor);
+typedef void (APIENTRY* GLLoaderProc_glVertexAttribPointer)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer);
+typedef void (APIENTRY* GLLoaderProc_glWaitSync)(GLsync sync, GLbitfield flags, GLuint64 timeout);
+
+struct GLLoaderDispatch
+{
+	GLLoaderProc_glAttachShader AttachShader;
+	GLLoaderProc_glBindAttribLocation BindAttribLocation;
+	GLLoaderProc_glBindBuffer BindBuffer;
+	GLLoaderProc_glBindFragDataLocation BindFragDataLocation;
+	GLLoaderProc_glBindFramebuffer BindFramebuffer;
+	GLLoaderProc_glBindTexture BindTexture;
+	GLLoaderProc_glBindVertexArray BindVertexArray;
+	GLLoaderProc_glBufferData BufferData;
+	GLLoaderProc_glBufferSubData BufferSubData;
+	GLLoaderProc_glCheckFramebufferStatus CheckFramebufferStatus;
+	GLLoaderProc_glClientWaitSync ClientWaitSync;
+	GLLoaderProc_glCompileShader CompileShader;
+	GLLoaderProc_glCompressedTexSubImage2D CompressedTexSubImage2D;
+	GLLoaderProc_glCreateProgram CreateProgram;
+	GLLoaderProc_glCreateShader CreateShader;
+	GLLoaderProc_glDeleteBuffers DeleteBuffers;
+	GLLoaderProc_glDeleteFramebuffers DeleteFramebuffers;
+	GLLoaderProc_glDeleteProgram DeleteProgram;
+	GLLoaderProc_glDeleteQueries DeleteQueries;
+	GLLoaderProc_glDeleteShader DeleteShader;
+	GLLoaderProc_glDeleteSync DeleteSync;
+	GLLoaderProc_glDeleteVertexArrays DeleteVertexArrays;
+	GLLoaderProc_glDepthFunc DepthFunc;
+	GLLoaderProc_glDepthMask DepthMask;
+	GLLoaderProc_glDisable Disable;
+	GLLoaderProc_glDrawArrays DrawArrays;
+	GLLoaderProc_glEnable Enable;
+	GLLoaderProc_glEnableVertexAttribArray EnableVertexAttribArray;
+	GLLoaderProc_glFenceSync FenceSync;
+	GLLoaderProc_glFlush Flush;
+	GLLoaderProc_glFramebufferTexture2D FramebufferTexture2D;
+	GLLoaderProc_glGenBuffers GenBuffers;
+	GLLoaderProc_glGenFramebuffers GenFramebuffers;
+	GLLoaderProc_glGenQueries GenQueries;
+	GLLoaderProc_glGenVertexArrays GenVertexArrays;
+	GLLoaderProc_glGetBufferParameteriv GetBufferParameteriv;
+	GLLoaderProc_glGetError GetError;
+	GLLoaderProc_glGetInteger64v GetInteger64v;
+	GLLoaderProc_glGetIntegerv GetIntegerv;
+	GLLoaderProc_glGetProgramBinary GetProgramBinary;
+	GLLoaderProc_glGetProgramiv GetProgramiv;
+	GLLoaderProc_glGetQueryObjectui64v GetQueryObjectui64v;
+	GLLoaderProc_glGetQueryObjectuiv GetQueryObjectuiv;
+	GLLoaderProc_glGetString GetString;
+	GLLoaderProc_glGetStringi GetStringi;
+	GLLoaderProc_glGetTexLevelParameteriv GetTexLevelParameteriv;
+	GLLoaderProc_glGetUniformLocation GetUniformLocation;
+	GLLoaderProc_glIsEnabled IsEnabled;
+	GLLoaderProc_glLinkProgram LinkProgram;
+	GLLoaderProc_glMapBufferRange MapBufferRange;
+	GLLoaderProc_glPixelStorei PixelStorei;
+	GLLoaderProc_glProgramBinary ProgramBinary;
+	GLLoaderProc_glProgramParameteri ProgramParameteri;
+	GLLoaderProc_glQueryCounter QueryCounter;
+	GLLoaderProc_glShaderSource ShaderSource;
+	GLLoaderProc_glTexSubImage2D TexSubImage2D;
+	GLLoaderProc_glUniformMatrix4fv UniformMatrix4fv;
+	GLLoaderProc_glUnmapBuffer UnmapBuffer;
+	GLLoaderProc_glUseProgram UseProgram;
+	GLLoaderProc_glVertexAttribDivisor VertexAttribDivisor;
+	GLLoaderProc_glVertexAttribPointer VertexAttribPointer;
+	GLLoaderProc_glWaitSync WaitSync;
+};
+
+extern GLLoaderDispatch g_GLDispatch;
+
+#define glAttachShader g_GLDispatch.AttachShader
+#define glBindAttribLocation g_GLDispatch.BindAttribLocation
+#define glBindBuffer g_GLDispatch.BindBuffer
+#define glBindFragDataLocation g_GLDispatch.BindFragDataLocation
+#define glBindFramebuffer g_GLDispatch.BindFramebuffer
+#define glBindTexture g_GLDispatch.BindTexture
+#define glBindVertexArray g_GLDispatch.BindVertexArray
+#define glBufferData g_GLDispatch.BufferData
+#define glBufferSubData g_GLDispatch.BufferSubData
+#define glCheckFramebufferStatus g_GLDispatch.CheckFramebufferStatus
+#define glClientWaitSync g_GLDispatch.ClientWaitSync
+#define glCompileShader g_GLDispatch.CompileShader
+#define glCompressedTexSubImage2D g_GLDispatch.CompressedTexSubImage2D
+#define glCreateProgram g_GLDispatch.CreateProgram
+#define glCreateShader g_GLDispatch.CreateShader
+#define glDeleteBuffers g_GLDispatch.DeleteBuffers
+#define glDeleteFramebuffers g_GLDispatch.DeleteFramebuffers
+#define glDeleteProgram g_GLDispatch.DeleteProgram
+#define glDeleteQueries g_GLDispatch.DeleteQueries
+#define glDeleteShader g_GLDispatch.DeleteShader
+#define glDeleteSync g_GLDispatch.DeleteSync
+#define glDeleteVertexArrays g_GLDispatch.DeleteVertexArrays
+#define glDepthFunc g_GLDispatch.DepthFunc
+#define glDepthMask g_GLDispatch.DepthMask
+#define glDisable g_GLDispatch.Disable
+#define glDrawArrays g_GLDispatch.DrawArrays
+#define glEnable g_GLDispatch.Enable
+#define glEnableVertexAttribArray g_GLDispatch.EnableVertexAttribArray
+#define glFenceSync g_GLDispatch.FenceSync
+#define glFlush g_GLDispatch.Flush
+#define glFramebufferTexture2D g_GLDispatch.FramebufferTexture2D
+#define glGenBuffers g_GLDispatch.GenBuffers
+#define glGenFramebuffers g_GLDispatch.GenFramebuffers
+#define glGenQueries g_GLDispatch.GenQueries
+#define glGenVertexArrays g_GLDispatch.GenVertexArrays
+#define glGetBufferParameteriv g_GLDispatch.GetBufferParameteriv
+#define glGetError g_GLDispatch.GetError
+#define glGetInteger64v g_GLDispatch.GetInteger64v
+#define glGetIntegerv g_GLDispatch.GetIntegerv
+#define glGetProgramBinary g_GLDispatch.GetProgramBinary
+#define glGetProgramiv g_GLDispatch.GetProgramiv
+#define glGetQueryObjectui64v g_GLDispatch.GetQueryObjectui64v
+#define glGetQueryObjectuiv g_GLDispatch.GetQueryObjectuiv
+#define glGetString g_GLDispatch.GetString
+#define glGetStringi g_GLDispatch.GetStringi
+#define glGetTexLevelParameteriv g_GLDispatch.GetTexLevelParameteriv
+#define glGetUniformLocation g_GLDispatch.GetUniformLocation
+#define glIsEnabled g_GLDispatch.IsEnabled
+#define glLinkProgram g_GLDispatch.LinkProgram
+#define glMapBufferRange g_GLDispatch.MapBufferRange
+#define glPixelStorei g_GLDispatch.PixelStorei
+#define glProgramBinary g_GLDispatch.ProgramBinary
+#define glProgramParameteri g_GLDispatch.ProgramParameteri
+#define glQueryCounter g_GLDispatch.QueryCounter
+#define glShaderSource g_GLDispatch.ShaderSource
+#define glTexSubImage2D g_GLDispatch.TexSubImage2D
+#define glUniformMatrix4fv g_GLDispatch.UniformMatrix4fv
+#define glUnmapBuffer g_GLDispatch.UnmapBuffer
+#define glUseProgram g_GLDispatch.UseProgram
+#define glVertexAttribDivisor g_GLDispatch.VertexAttribDivisor
+#define glVertexAttribPointer g_GLDispatch.VertexAttribPointer
+#define glWaitSync g_GLDispatch.WaitSync
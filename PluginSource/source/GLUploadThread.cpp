@@ -0,0 +1,306 @@
+#include "GLUploadThread.h"
+
+// GL upload thread; see GLUploadThread.h.
+
+
+static std::atomic<bool> s_GLUploadThreadEnabled(false);
+
+void SetGLUploadThreadEnabled(bool enabled)
+{
+	s_GLUploadThreadEnabled = enabled;
+}
+
+bool IsGLUploadThreadEnabled()
+{
+	return s_GLUploadThreadEnabled;
+}
+
+
+GLUploadThread::GLUploadThread()
+	: m_Submitted(0)
+	, m_Completed(0)
+	, m_StartResult(0)
+	, m_StopRequested(false)
+	, m_Running(false)
+	, m_Display(NULL)
+	, m_Context(NULL)
+	, m_Surface(NULL)
+	, m_API(0)
+{
+}
+
+
+#if SUPPORT_GL_UPLOAD_THREAD
+
+#include <assert.h>
+#include <dlfcn.h>
+#include <string.h>
+// Only the types and enums are used; no X11 headers needed for those
+#define EGL_NO_X11 1
+#define MESA_EGL_NO_X11_HEADERS 1
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#ifndef EGL_NO_CONFIG_KHR
+#	define EGL_NO_CONFIG_KHR ((EGLConfig)0)
+#endif
+
+
+// --------------------------------------------------------------------------
+// EGL entry points, from whatever libEGL Unity has loaded
+
+struct EGLFuncs
+{
+	EGLDisplay (EGLAPIENTRY* getCurrentDisplay)();
+	EGLContext (EGLAPIENTRY* getCurrentContext)();
+	EGLBoolean (EGLAPIENTRY* queryContext)(EGLDisplay dpy, EGLContext ctx, EGLint attribute, EGLint* value);
+	const char* (EGLAPIENTRY* queryString)(EGLDisplay dpy, EGLint name);
+	EGLBoolean (EGLAPIENTRY* chooseConfig)(EGLDisplay dpy, const EGLint* attribList, EGLConfig* configs, EGLint configSize, EGLint* numConfig);
+	EGLBoolean (EGLAPIENTRY* bindAPI)(EGLenum api);
+	EGLContext (EGLAPIENTRY* createContext)(EGLDisplay dpy, EGLConfig config, EGLContext shareContext, const EGLint* attribList);
+	EGLBoolean (EGLAPIENTRY* destroyContext)(EGLDisplay dpy, EGLContext ctx);
+	EGLSurface (EGLAPIENTRY* createPbufferSurface)(EGLDisplay dpy, EGLConfig config, const EGLint* attribList);
+	EGLBoolean (EGLAPIENTRY* destroySurface)(EGLDisplay dpy, EGLSurface surface);
+	EGLBoolean (EGLAPIENTRY* makeCurrent)(EGLDisplay dpy, EGLSurface draw, EGLSurface read, EGLContext ctx);
+	EGLBoolean (EGLAPIENTRY* releaseThread)();
+};
+
+static bool LoadEGLFuncs(EGLFuncs& egl)
+{
+#	define GET_EGL_PROC(member, name) \
+		*(void**)&egl.member = dlsym(RTLD_DEFAULT, #name); \
+		if (!egl.member) \
+			return false
+	GET_EGL_PROC(getCurrentDisplay, eglGetCurrentDisplay);
+	GET_EGL_PROC(getCurrentContext, eglGetCurrentContext);
+	GET_EGL_PROC(queryContext, eglQueryContext);
+	GET_EGL_PROC(queryString, eglQueryString);
+	GET_EGL_PROC(chooseConfig, eglChooseConfig);
+	GET_EGL_PROC(bindAPI, eglBindAPI);
+	GET_EGL_PROC(createContext, eglCreateContext);
+	GET_EGL_PROC(destroyContext, eglDestroyContext);
+	GET_EGL_PROC(createPbufferSurface, eglCreatePbufferSurface);
+	GET_EGL_PROC(destroySurface, eglDestroySurface);
+	GET_EGL_PROC(makeCurrent, eglMakeCurrent);
+	GET_EGL_PROC(releaseThread, eglReleaseThread);
+#	undef GET_EGL_PROC
+	return true;
+}
+
+static EGLFuncs s_EGL;
+
+
+static bool HasEGLExtension(EGLDisplay display, const char* name)
+{
+	const char* extensions = s_EGL.queryString(display, EGL_EXTENSIONS);
+	const size_t length = strlen(name);
+	for (const char* p = extensions; p && (p = strstr(p, name)) != NULL; p += length)
+	{
+		if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0'))
+			return true;
+	}
+	return false;
+}
+
+
+// --------------------------------------------------------------------------
+// Start / stop
+
+bool GLUploadThread::Start(int majorVersion, int minorVersion, bool coreProfile)
+{
+	if (m_Running)
+		return true;
+	if (!s_EGL.makeCurrent && !LoadEGLFuncs(s_EGL))
+	{
+		s_EGL = EGLFuncs();
+		return false;
+	}
+
+	// Unity's context; none when it renders through GLX or WGL
+	EGLDisplay display = s_EGL.getCurrentDisplay();
+	EGLContext shareContext = s_EGL.getCurrentContext();
+	if (display == EGL_NO_DISPLAY || shareContext == EGL_NO_CONTEXT)
+		return false;
+
+	EGLint api = 0, configID = 0;
+	if (!s_EGL.queryContext(display, shareContext, EGL_CONTEXT_CLIENT_TYPE, &api))
+		return false;
+	// Same config as Unity's context, so that the two are compatible for sharing
+	EGLConfig config = EGL_NO_CONFIG_KHR;
+	EGLint configCount = 0;
+	s_EGL.queryContext(display, shareContext, EGL_CONFIG_ID, &configID);
+	const EGLint configAttribs[] = { EGL_CONFIG_ID, configID, EGL_NONE };
+	if (configID == 0 || !s_EGL.chooseConfig(display, configAttribs, &config, 1, &configCount) || configCount < 1)
+	{
+		if (!HasEGLExtension(display, "EGL_KHR_no_config_context"))
+			return false;
+		config = EGL_NO_CONFIG_KHR;
+	}
+
+	// eglBindAPI is per thread; Unity's render thread has its API bound already, but be explicit
+	if (!s_EGL.bindAPI(api))
+		return false;
+	EGLint contextAttribs[] =
+	{
+		EGL_CONTEXT_MAJOR_VERSION, majorVersion,
+		EGL_CONTEXT_MINOR_VERSION, minorVersion,
+		EGL_NONE, EGL_NONE,
+		EGL_NONE
+	};
+	if (coreProfile)
+	{
+		contextAttribs[4] = EGL_CONTEXT_OPENGL_PROFILE_MASK;
+		contextAttribs[5] = EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT;
+	}
+	EGLContext context = s_EGL.createContext(display, config, shareContext, contextAttribs);
+	if (context == EGL_NO_CONTEXT)
+		return false;
+
+	// The thread never draws; it needs a surface only when the driver can't do without
+	EGLSurface surface = EGL_NO_SURFACE;
+	if (!HasEGLExtension(display, "EGL_KHR_surfaceless_context"))
+	{
+		const EGLint surfaceAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+		if (config != EGL_NO_CONFIG_KHR)
+			surface = s_EGL.createPbufferSurface(display, config, surfaceAttribs);
+		if (surface == EGL_NO_SURFACE)
+		{
+			s_EGL.destroyContext(display, context);
+			return false;
+		}
+	}
+
+	m_Display = display;
+	m_Context = context;
+	m_Surface = surface;
+	m_API = (unsigned int)api;
+	m_StopRequested = false;
+	m_StartResult = 0;
+	m_Jobs.clear();
+	m_Thread = std::thread(&GLUploadThread::ThreadMain, this);
+
+	// Wait for the thread to make its context current, which is where an unsupported setup fails
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	while (m_StartResult == 0)
+		m_Done.wait(lock);
+	if (m_StartResult < 0)
+	{
+		lock.unlock();
+		m_Thread.join();
+		DestroyContext();
+		return false;
+	}
+	m_Running = true;
+	return true;
+}
+
+
+void GLUploadThread::Stop()
+{
+	if (!m_Running)
+		return;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_StopRequested = true;
+	}
+	m_Wake.notify_one();
+	m_Thread.join();
+	DestroyContext();
+	m_Running = false;
+}
+
+
+void GLUploadThread::DestroyContext()
+{
+	if (m_Surface != EGL_NO_SURFACE)
+		s_EGL.destroySurface(m_Display, m_Surface);
+	s_EGL.destroyContext(m_Display, m_Context);
+	m_Display = NULL;
+	m_Context = NULL;
+	m_Surface = NULL;
+}
+
+
+// --------------------------------------------------------------------------
+// Jobs
+
+unsigned long long GLUploadThread::Submit(JobFunc func, void* userData)
+{
+	assert(m_Running);
+	Job job = { func, userData };
+	unsigned long long sequence;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Jobs.push_back(job);
+		sequence = ++m_Submitted;
+	}
+	m_Wake.notify_one();
+	return sequence;
+}
+
+
+void GLUploadThread::WaitForCompleted(unsigned long long sequence)
+{
+	if (GetCompleted() >= sequence)
+		return;
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	while (GetCompleted() < sequence)
+		m_Done.wait(lock);
+}
+
+
+void GLUploadThread::ThreadMain()
+{
+	const bool current = s_EGL.bindAPI(m_API) && s_EGL.makeCurrent(m_Display, m_Surface, m_Surface, m_Context);
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_StartResult = current ? 1 : -1;
+	}
+	m_Done.notify_all();
+	if (!current)
+	{
+		s_EGL.releaseThread();
+		return;
+	}
+
+	std::vector<Job> jobs;
+	for (;;)
+	{
+		bool stop;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			while (!m_StopRequested && m_Jobs.empty())
+				m_Wake.wait(lock);
+			jobs.swap(m_Jobs);
+			stop = m_StopRequested;
+		}
+		for (size_t i = 0; i < jobs.size(); ++i)
+		{
+			jobs[i].func(jobs[i].userData);
+			{
+				// Under the lock, so a waiter can't miss the notification
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Completed.fetch_add(1, std::memory_order_release);
+			}
+			m_Done.notify_all();
+		}
+		jobs.clear();
+		if (stop)
+			break;
+	}
+
+	s_EGL.makeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	s_EGL.releaseThread();
+}
+
+
+#else // #if SUPPORT_GL_UPLOAD_THREAD
+
+bool GLUploadThread::Start(int majorVersion, int minorVersion, bool coreProfile) { return false; }
+void GLUploadThread::Stop() { }
+void GLUploadThread::DestroyContext() { }
+unsigned long long GLUploadThread::Submit(JobFunc func, void* userData) { return 0; }
+void GLUploadThread::WaitForCompleted(unsigned long long sequence) { }
+void GLUploadThread::ThreadMain() { }
+
+#endif // #if SUPPORT_GL_UPLOAD_THREAD
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "PlatformBase.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A worker thread with its own OpenGL context, created in the share group of the context Unity
+// renders with, so textures and buffers are the same objects on both. The GL backend moves the
+// expensive part of asynchronous texture uploads onto it. Jobs run one after the other in
+// submission order; they synchronize with the render thread through GL sync objects of their own.
+//
+// Only where Unity's context can be an EGL one, see SUPPORT_GL_UPLOAD_THREAD. EGL is looked up at
+// runtime, so the plugin does not link against it, and Start simply fails when Unity renders
+// through GLX or some other window system binding.
+
+// Scripts turn the thread on or off; off by default. Takes effect for uploads issued after the
+// call. Can be called from any thread.
+void SetGLUploadThreadEnabled(bool enabled);
+bool IsGLUploadThreadEnabled();
+
+
+class GLUploadThread
+{
+public:
+	typedef void (*JobFunc)(void* userData);
+
+	GLUploadThread();
+	~GLUploadThread() { Stop(); }
+
+	// Create the shared context and start the thread. Call with the context to share with current on
+	// the calling thread; the version and profile have to match it. Returns false when the context
+	// can not be shared, the thread then stays stopped.
+	bool Start(int majorVersion, int minorVersion, bool coreProfile);
+	// Finish the submitted jobs, then end the thread and destroy its context.
+	void Stop();
+	bool IsRunning() const { return m_Running; }
+
+	// Queue a job; returns its sequence number, the first one being 1.
+	unsigned long long Submit(JobFunc func, void* userData);
+	// Newest sequence number whose job has returned; what the job wrote to userData is visible to
+	// the caller once this reports it.
+	unsigned long long GetCompleted() const { return m_Completed.load(std::memory_order_acquire); }
+	void WaitForCompleted(unsigned long long sequence);
+
+private:
+	struct Job
+	{
+		JobFunc func;
+		void* userData;
+	};
+
+	void ThreadMain();
+	void DestroyContext();
+
+private:
+	std::thread m_Thread;
+	std::mutex m_Mutex;
+	std::condition_variable m_Wake;		// the thread waits on this for jobs
+	std::condition_variable m_Done;		// and signals this after each one
+	std::vector<Job> m_Jobs;			// not picked up by the thread yet
+	unsigned long long m_Submitted;
+	std::atomic<unsigned long long> m_Completed;
+	int m_StartResult;					// set by the thread: 1 once its context is current, -1 if that failed
+	bool m_StopRequested;
+	bool m_Running;
+	// EGLDisplay, EGLContext, EGLSurface; EGL_NO_SURFACE when the context can be current without one
+	void* m_Display;
+	void* m_Context;
+	void* m_Surface;
+	unsigned int m_API;					// EGLenum of the client API, to bind on the thread
+};
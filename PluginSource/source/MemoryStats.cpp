@@ -0,0 +1,139 @@
+#include "MemoryStats.h"
+
+#include <atomic>
+#include <stdio.h>
+
+#if UNITY_WIN
+#include <windows.h>
+#endif
+
+// Memory accounting; see MemoryStats.h.
+
+
+// Counters are atomics: most calls come from the render thread, but scripts register buffers and
+// read stats from the main thread.
+struct MemoryCounters
+{
+	std::atomic<long long> liveBytes;
+	std::atomic<long long> peakBytes;
+	std::atomic<long long> liveObjects;
+	std::atomic<unsigned long long> totalAllocations;
+	std::atomic<unsigned long long> frameAllocations;
+	std::atomic<unsigned long long> frameBytes;
+	std::atomic<unsigned long long> lastFrameAllocations;
+	std::atomic<unsigned long long> lastFrameBytes;
+};
+
+// Zero initialized, being static
+static MemoryCounters s_MemoryCounters[kMemBackendCount][kMemCategoryCount];
+
+static const char* const kMemBackendNames[kMemBackendCount] = { "Plugin", "Null", "D3D11", "D3D12", "OpenGL", "Metal", "Vulkan" };
+static const char* const kMemCategoryNames[kMemCategoryCount] = { "staging", "buffers", "shaders", "queries", "other" };
+
+
+void MemoryStatsAlloc(MemoryBackend backend, MemoryCategory category, size_t bytes)
+{
+	MemoryCounters& c = s_MemoryCounters[backend][category];
+	const long long live = c.liveBytes += (long long)bytes;
+	long long peak = c.peakBytes.load(std::memory_order_relaxed);
+	while (live > peak && !c.peakBytes.compare_exchange_weak(peak, live))
+		;
+	++c.liveObjects;
+	++c.totalAllocations;
+	++c.frameAllocations;
+	c.frameBytes += bytes;
+}
+
+
+void MemoryStatsFree(MemoryBackend backend, MemoryCategory category, size_t bytes)
+{
+	MemoryCounters& c = s_MemoryCounters[backend][category];
+	c.liveBytes -= (long long)bytes;
+	--c.liveObjects;
+}
+
+
+void MemoryStatsResize(MemoryBackend backend, MemoryCategory category, size_t oldBytes, size_t newBytes)
+{
+	if (oldBytes == newBytes)
+		return;
+	if (oldBytes)
+		MemoryStatsFree(backend, category, oldBytes);
+	if (newBytes)
+		MemoryStatsAlloc(backend, category, newBytes);
+}
+
+
+void MemoryStatsNextFrame()
+{
+	for (int b = 0; b < kMemBackendCount; ++b)
+	{
+		for (int cat = 0; cat < kMemCategoryCount; ++cat)
+		{
+			MemoryCounters& c = s_MemoryCounters[b][cat];
+			c.lastFrameAllocations = c.frameAllocations.exchange(0);
+			c.lastFrameBytes = c.frameBytes.exchange(0);
+		}
+	}
+}
+
+
+int GetMemoryStats(MemoryStats* outStats, int maxCount)
+{
+	if (!outStats || maxCount <= 0)
+		return 0;
+	const int count = maxCount < kMemoryStatsCount ? maxCount : kMemoryStatsCount;
+	for (int i = 0; i < count; ++i)
+	{
+		const MemoryCounters& c = s_MemoryCounters[i / kMemCategoryCount][i % kMemCategoryCount];
+		MemoryStats& stats = outStats[i];
+		stats.liveBytes = c.liveBytes;
+		stats.peakBytes = c.peakBytes;
+		stats.liveObjects = c.liveObjects;
+		stats.totalAllocations = c.totalAllocations;
+		stats.allocationsLastFrame = c.lastFrameAllocations;
+		stats.bytesAllocatedLastFrame = c.lastFrameBytes;
+	}
+	return count;
+}
+
+
+MemoryBackend GetMemoryBackend(UnityGfxRenderer renderer)
+{
+	switch (renderer)
+	{
+	case kUnityGfxRendererD3D11: return kMemBackendD3D11;
+	case kUnityGfxRendererD3D12: return kMemBackendD3D12;
+	case kUnityGfxRendererOpenGLCore:
+	case kUnityGfxRendererOpenGLES20:
+	case kUnityGfxRendererOpenGLES30: return kMemBackendOpenGL;
+	case kUnityGfxRendererMetal: return kMemBackendMetal;
+	case kUnityGfxRendererVulkan: return kMemBackendVulkan;
+	default: return kMemBackendNull;
+	}
+}
+
+
+long long ReportMemoryLeaks(MemoryBackend backend)
+{
+	long long leakedBytes = 0;
+	for (int cat = 0; cat < kMemCategoryCount; ++cat)
+	{
+		const MemoryCounters& c = s_MemoryCounters[backend][cat];
+		const long long objects = c.liveObjects;
+		if (objects == 0)
+			continue;
+		const long long bytes = c.liveBytes;
+		leakedBytes += bytes;
+
+		char message[256];
+		snprintf(message, sizeof(message), "RenderingPlugin: %s device shut down with %lld %s objects (%lld bytes) still alive\n",
+			kMemBackendNames[backend], objects, kMemCategoryNames[cat], bytes);
+#if UNITY_WIN
+		OutputDebugStringA(message);
+#else
+		fputs(message, stderr);
+#endif
+	}
+	return leakedBytes;
+}
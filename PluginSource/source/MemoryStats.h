@@ -0,0 +1,65 @@
+#pragma once
+
+#include "PlatformBase.h"
+#include "Unity/IUnityGraphics.h"
+
+#include <stddef.h>
+
+// Accounting of everything the plugin allocates: GPU resources the backends create, CPU staging
+// memory, and the plugin's own backend independent buffers. Tracked per backend and category, with
+// live and peak values and per frame allocation counts. Objects whose size the API doesn't tell
+// (shaders, pipeline states, queries) are counted with zero bytes.
+//
+// When a device shuts down, whatever its backend still holds gets reported as a leak.
+
+enum MemoryBackend
+{
+	kMemBackendPlugin = 0,		// backend independent, lives as long as the plugin
+	kMemBackendNull,
+	kMemBackendD3D11,
+	kMemBackendD3D12,
+	kMemBackendOpenGL,
+	kMemBackendMetal,
+	kMemBackendVulkan,
+	kMemBackendCount
+};
+
+enum MemoryCategory
+{
+	kMemCategoryStaging = 0,	// CPU visible memory that uploads go through
+	kMemCategoryBuffer,			// vertex, constant and other GPU buffers
+	kMemCategoryShader,			// shaders, programs, pipeline states
+	kMemCategoryQuery,			// timer queries and query pools
+	kMemCategoryOther,			// render states, vertex arrays, command lists
+	kMemCategoryCount
+};
+
+// Stats of one backend / category pair. Plain C layout, so scripts can marshal it directly.
+// A frame ends at each SetTimeFromUnity call.
+struct MemoryStats
+{
+	long long liveBytes;
+	long long peakBytes;
+	long long liveObjects;
+	unsigned long long totalAllocations;
+	unsigned long long allocationsLastFrame;
+	unsigned long long bytesAllocatedLastFrame;
+};
+
+// Entries are backend major: index = backend * kMemCategoryCount + category
+enum { kMemoryStatsCount = kMemBackendCount * kMemCategoryCount };
+
+void MemoryStatsAlloc(MemoryBackend backend, MemoryCategory category, size_t bytes);
+void MemoryStatsFree(MemoryBackend backend, MemoryCategory category, size_t bytes);
+// A growable CPU buffer changed capacity; counts as one allocation when it got a new block
+void MemoryStatsResize(MemoryBackend backend, MemoryCategory category, size_t oldBytes, size_t newBytes);
+
+void MemoryStatsNextFrame();
+
+// Fill up to maxCount entries; returns the number filled. Can be called from any thread.
+int GetMemoryStats(MemoryStats* outStats, int maxCount);
+
+MemoryBackend GetMemoryBackend(UnityGfxRenderer renderer);
+
+// Log every category of the backend that still holds objects. Returns the leaked byte count.
+long long ReportMemoryLeaks(MemoryBackend backend);
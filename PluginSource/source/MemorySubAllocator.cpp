@@ -0,0 +1,316 @@
+#include "MemorySubAllocator.h"
+
+#include <assert.h>
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
+static inline uint64_t AlignUp(uint64_t value, uint64_t alignment)
+{
+	assert((alignment & (alignment - 1)) == 0);
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static inline unsigned LowestBit(unsigned bits)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, bits);
+	return (unsigned)index;
+#else
+	return (unsigned)__builtin_ctz(bits);
+#endif
+}
+
+static inline unsigned HighestBit(uint64_t value)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanReverse(&index, (unsigned long)(value >> 32)))
+		return (unsigned)index + 32;
+	_BitScanReverse(&index, (unsigned long)value);
+	return (unsigned)index;
+#else
+	return 63 - (unsigned)__builtin_clzll(value);
+#endif
+}
+
+
+// --------------------------------------------------------------------------
+// RingSubAllocator
+
+
+void RingSubAllocator::Init(uint64_t capacity)
+{
+	m_Capacity = capacity;
+	m_Head = m_Tail = m_Used = 0;
+	m_Frames.clear();
+}
+
+uint64_t RingSubAllocator::Allocate(uint64_t size, uint64_t alignment, unsigned long long frame)
+{
+	assert(m_Frames.empty() || m_Frames.back().frame <= frame);
+	if (size == 0 || size > m_Capacity)
+		return kSubAllocationNoOffset;
+	if (m_Used == 0)
+		m_Head = m_Tail = 0;
+
+	// Live data runs from the tail to the head, or from the tail to the end and on from 0 to the head
+	const bool wrapped = m_Head < m_Tail || (m_Head == m_Tail && m_Used != 0);
+	uint64_t offset = AlignUp(m_Head, alignment);
+	uint64_t consumed;
+	if (!wrapped)
+	{
+		if (offset + size <= m_Capacity)
+			consumed = offset + size - m_Head;
+		else if (size <= m_Tail)
+		{
+			// Skip the rest of the ring; it's freed along with this frame
+			consumed = m_Capacity - m_Head + size;
+			offset = 0;
+		}
+		else
+			return kSubAllocationNoOffset;
+	}
+	else
+	{
+		if (offset + size > m_Tail)
+			return kSubAllocationNoOffset;
+		consumed = offset + size - m_Head;
+	}
+
+	m_Head = offset + size;
+	m_Used += consumed;
+	if (!m_Frames.empty() && m_Frames.back().frame == frame)
+	{
+		m_Frames.back().head = m_Head;
+		m_Frames.back().bytes += consumed;
+	}
+	else
+	{
+		FrameEnd end = { frame, m_Head, consumed };
+		m_Frames.push_back(end);
+	}
+	return offset;
+}
+
+void RingSubAllocator::Retire(unsigned long long safeFrame)
+{
+	while (!m_Frames.empty() && m_Frames.front().frame <= safeFrame)
+	{
+		m_Tail = m_Frames.front().head;
+		m_Used -= m_Frames.front().bytes;
+		m_Frames.pop_front();
+	}
+}
+
+
+// --------------------------------------------------------------------------
+// TlsfSubAllocator
+
+
+TlsfSubAllocator::TlsfSubAllocator()
+	: m_FirstLevelBits(0)
+	, m_Capacity(0)
+	, m_Used(0)
+{
+	Init(0);
+}
+
+void TlsfSubAllocator::Init(uint64_t capacity)
+{
+	assert(capacity < (1ull << 32));
+	m_Blocks.clear();
+	m_UnusedBlocks.clear();
+	for (unsigned i = 0; i < kFirstLevelCount; ++i)
+	{
+		for (unsigned j = 0; j < kSecondLevelCount; ++j)
+			m_FreeLists[i][j] = kNoBlock;
+		m_SecondLevelBits[i] = 0;
+	}
+	m_FirstLevelBits = 0;
+	m_Capacity = capacity & ~(uint64_t)(kGranularity - 1);
+	m_Used = 0;
+	if (m_Capacity == 0)
+		return;
+
+	const unsigned block = NewBlock();
+	m_Blocks[block].offset = 0;
+	m_Blocks[block].size = m_Capacity;
+	InsertFree(block);
+}
+
+void TlsfSubAllocator::GetListIndex(uint64_t size, unsigned* firstLevel, unsigned* secondLevel)
+{
+	if (size < kSmallSize)
+	{
+		*firstLevel = 0;
+		*secondLevel = (unsigned)(size / (kSmallSize / kSecondLevelCount));
+	}
+	else
+	{
+		const unsigned msb = HighestBit(size);
+		*firstLevel = msb - kFirstLevelShift + 1;
+		*secondLevel = (unsigned)(size >> (msb - kSecondLevelShift)) - kSecondLevelCount;
+	}
+}
+
+unsigned TlsfSubAllocator::NewBlock()
+{
+	unsigned block;
+	if (!m_UnusedBlocks.empty())
+	{
+		block = m_UnusedBlocks.back();
+		m_UnusedBlocks.pop_back();
+	}
+	else
+	{
+		block = (unsigned)m_Blocks.size();
+		m_Blocks.push_back(Block());
+	}
+	Block& b = m_Blocks[block];
+	b.offset = b.size = 0;
+	b.prevPhysical = b.nextPhysical = b.prevFree = b.nextFree = kNoBlock;
+	b.free = false;
+	return block;
+}
+
+void TlsfSubAllocator::InsertFree(unsigned block)
+{
+	unsigned fl, sl;
+	GetListIndex(m_Blocks[block].size, &fl, &sl);
+	Block& b = m_Blocks[block];
+	b.free = true;
+	b.prevFree = kNoBlock;
+	b.nextFree = m_FreeLists[fl][sl];
+	if (b.nextFree != kNoBlock)
+		m_Blocks[b.nextFree].prevFree = block;
+	m_FreeLists[fl][sl] = block;
+	m_FirstLevelBits |= 1u << fl;
+	m_SecondLevelBits[fl] |= 1u << sl;
+}
+
+void TlsfSubAllocator::RemoveFree(unsigned block)
+{
+	Block& b = m_Blocks[block];
+	if (b.prevFree != kNoBlock)
+		m_Blocks[b.prevFree].nextFree = b.nextFree;
+	else
+	{
+		unsigned fl, sl;
+		GetListIndex(b.size, &fl, &sl);
+		m_FreeLists[fl][sl] = b.nextFree;
+		if (b.nextFree == kNoBlock)
+		{
+			m_SecondLevelBits[fl] &= ~(1u << sl);
+			if (!m_SecondLevelBits[fl])
+				m_FirstLevelBits &= ~(1u << fl);
+		}
+	}
+	if (b.nextFree != kNoBlock)
+		m_Blocks[b.nextFree].prevFree = b.prevFree;
+	b.free = false;
+	b.prevFree = b.nextFree = kNoBlock;
+}
+
+unsigned TlsfSubAllocator::FindFree(uint64_t size)
+{
+	// Round up to the next list, so that any block in the list found is big enough
+	const uint64_t rounded = size >= kSmallSize ? size + (1ull << (HighestBit(size) - kSecondLevelShift)) - 1 : size;
+	unsigned fl, sl;
+	GetListIndex(rounded, &fl, &sl);
+	if (fl < kFirstLevelCount)
+	{
+		unsigned secondLevelBits = m_SecondLevelBits[fl] & (~0u << sl);
+		if (!secondLevelBits)
+		{
+			const unsigned firstLevelBits = fl + 1 < kFirstLevelCount ? m_FirstLevelBits & (~0u << (fl + 1)) : 0;
+			if (firstLevelBits)
+			{
+				fl = LowestBit(firstLevelBits);
+				secondLevelBits = m_SecondLevelBits[fl];
+			}
+		}
+		if (secondLevelBits)
+			return m_FreeLists[fl][LowestBit(secondLevelBits)];
+	}
+
+	// Only the size's own list is left, where some blocks may be big enough
+	GetListIndex(size, &fl, &sl);
+	if (fl >= kFirstLevelCount)
+		return kNoBlock;
+	for (unsigned block = m_FreeLists[fl][sl]; block != kNoBlock; block = m_Blocks[block].nextFree)
+	{
+		if (m_Blocks[block].size >= size)
+			return block;
+	}
+	return kNoBlock;
+}
+
+unsigned TlsfSubAllocator::Allocate(uint64_t size, uint64_t alignment, uint64_t* outOffset)
+{
+	if (size == 0)
+		return kSubAllocationFailed;
+	size = AlignUp(size, kGranularity);
+	// Blocks start on the granularity already; beyond that, the worst case padding
+	const uint64_t padding = alignment > kGranularity ? alignment - kGranularity : 0;
+
+	const unsigned block = FindFree(size + padding);
+	if (block == kNoBlock)
+		return kSubAllocationFailed;
+	RemoveFree(block);
+
+	// The padding stays in the block; the rest goes back to the free lists
+	const uint64_t offset = AlignUp(m_Blocks[block].offset, alignment);
+	const uint64_t used = offset - m_Blocks[block].offset + size;
+	if (m_Blocks[block].size - used >= kGranularity)
+	{
+		const unsigned rest = NewBlock();
+		Block& b = m_Blocks[block];
+		Block& r = m_Blocks[rest];
+		r.offset = b.offset + used;
+		r.size = b.size - used;
+		r.prevPhysical = block;
+		r.nextPhysical = b.nextPhysical;
+		if (b.nextPhysical != kNoBlock)
+			m_Blocks[b.nextPhysical].prevPhysical = rest;
+		b.nextPhysical = rest;
+		b.size = used;
+		InsertFree(rest);
+	}
+
+	m_Used += m_Blocks[block].size;
+	*outOffset = offset;
+	return block;
+}
+
+void TlsfSubAllocator::Free(unsigned allocation)
+{
+	assert(allocation < m_Blocks.size() && !m_Blocks[allocation].free);
+	unsigned block = allocation;
+	m_Used -= m_Blocks[block].size;
+
+	const unsigned prev = m_Blocks[block].prevPhysical;
+	if (prev != kNoBlock && m_Blocks[prev].free)
+	{
+		RemoveFree(prev);
+		m_Blocks[prev].size += m_Blocks[block].size;
+		m_Blocks[prev].nextPhysical = m_Blocks[block].nextPhysical;
+		if (m_Blocks[block].nextPhysical != kNoBlock)
+			m_Blocks[m_Blocks[block].nextPhysical].prevPhysical = prev;
+		m_UnusedBlocks.push_back(block);
+		block = prev;
+	}
+	const unsigned next = m_Blocks[block].nextPhysical;
+	if (next != kNoBlock && m_Blocks[next].free)
+	{
+		RemoveFree(next);
+		m_Blocks[block].size += m_Blocks[next].size;
+		m_Blocks[block].nextPhysical = m_Blocks[next].nextPhysical;
+		if (m_Blocks[next].nextPhysical != kNoBlock)
+			m_Blocks[m_Blocks[next].nextPhysical].prevPhysical = block;
+		m_UnusedBlocks.push_back(next);
+	}
+	InsertFree(block);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "PlatformBase.h"
+
+#include <stdint.h>
+#include <deque>
+#include <vector>
+
+// Offset bookkeeping for carving small allocations out of one big block of GPU memory; the caller
+// owns the memory itself (a VkDeviceMemory, say) and these only hand out ranges of it. Graphics
+// APIs limit how many memory allocations there may be, and each one costs a trip into the driver.
+//
+// Alignments have to be powers of two.
+
+enum { kSubAllocationFailed = ~0u };
+static const uint64_t kSubAllocationNoOffset = ~0ull;
+
+
+// Per frame data: allocations are made at the head and retired in bulk, oldest frame first, once
+// the GPU is done with the frame. Nothing is freed on its own.
+class RingSubAllocator
+{
+public:
+	RingSubAllocator() : m_Capacity(0), m_Head(0), m_Tail(0), m_Used(0) {}
+
+	void Init(uint64_t capacity);
+	// Offset of size bytes for frame, kSubAllocationNoOffset when the ring is full. Frames have to
+	// come in increasing order.
+	uint64_t Allocate(uint64_t size, uint64_t alignment, unsigned long long frame);
+	// Everything allocated for frames up to safeFrame is free again
+	void Retire(unsigned long long safeFrame);
+
+	uint64_t GetCapacity() const { return m_Capacity; }
+	uint64_t GetUsed() const { return m_Used; }
+
+private:
+	struct FrameEnd
+	{
+		unsigned long long frame;
+		uint64_t head;		// where the frame's last allocation ended
+		uint64_t bytes;		// used by the frame, padding and the skipped end of the ring included
+	};
+
+	uint64_t m_Capacity;
+	uint64_t m_Head;		// next allocation starts here, or wraps to 0
+	uint64_t m_Tail;		// start of the oldest live frame
+	uint64_t m_Used;
+	std::deque<FrameEnd> m_Frames;
+};
+
+
+// Long lived data: allocations freed one by one in any order. Two-level segregated fit (TLSF):
+// free ranges sit in lists by size class, found through two levels of bitmaps, so allocating and
+// freeing take constant time; a freed range merges with free neighbors right away.
+// Capacity below 4 GB, handed out in multiples of 16 bytes.
+class TlsfSubAllocator
+{
+public:
+	TlsfSubAllocator();
+
+	void Init(uint64_t capacity);
+	// Handle of the allocation, kSubAllocationFailed when no free range is big enough; outOffset
+	// gets where the allocation starts.
+	unsigned Allocate(uint64_t size, uint64_t alignment, uint64_t* outOffset);
+	void Free(unsigned allocation);
+
+	uint64_t GetCapacity() const { return m_Capacity; }
+	uint64_t GetUsed() const { return m_Used; }
+	bool IsEmpty() const { return m_Used == 0; }
+
+private:
+	enum
+	{
+		kGranularityShift = 4,
+		kGranularity = 1 << kGranularityShift,
+		kSecondLevelShift = 4,										// 16 lists per power of two
+		kSecondLevelCount = 1 << kSecondLevelShift,
+		kFirstLevelShift = kSecondLevelShift + kGranularityShift,	// below 256 bytes, lists are 16 bytes apart
+		kSmallSize = 1 << kFirstLevelShift,
+		kFirstLevelCount = 32 - kFirstLevelShift + 1,
+		kNoBlock = ~0u
+	};
+
+	// A range of the memory, free or allocated. Physical neighbors link up in offset order, free
+	// ones also into the list of their size class.
+	struct Block
+	{
+		uint64_t offset;
+		uint64_t size;
+		unsigned prevPhysical;
+		unsigned nextPhysical;
+		unsigned prevFree;
+		unsigned nextFree;
+		bool free;
+	};
+
+	static void GetListIndex(uint64_t size, unsigned* firstLevel, unsigned* secondLevel);
+	unsigned NewBlock();
+	void InsertFree(unsigned block);
+	void RemoveFree(unsigned block);
+	unsigned FindFree(uint64_t size);
+
+private:
+	std::vector<Block> m_Blocks;
+	std::vector<unsigned> m_UnusedBlocks;		// records in m_Blocks free for reuse
+	unsigned m_FreeLists[kFirstLevelCount][kSecondLevelCount];
+	unsigned m_FirstLevelBits;
+	unsigned m_SecondLevelBits[kFirstLevelCount];
+	uint64_t m_Capacity;
+	uint64_t m_Used;
+};
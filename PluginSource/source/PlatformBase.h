@@ -4,7 +4,9 @@
 
 #include <stddef.h>
 
-#include <TargetConditionals.h>
+#if defined(__APPLE__)
+	#include <TargetConditionals.h>
+#endif
 
 
 // Which platform we are on?
@@ -76,6 +78,45 @@
 	#define SUPPORT_METAL 1
 #endif
 
+// "Null" device (batch mode / -nographics, or a headless host); has no dependencies so it's always available
+#ifndef SUPPORT_NULL_RENDERER
+	#define SUPPORT_NULL_RENDERER 1
+#endif
+
+// CPU scope timers on the render thread hot paths (PluginProfiler.h); cheap enough to leave on,
+// define to 0 to compile them out entirely
+#ifndef SUPPORT_PLUGIN_PROFILER
+	#define SUPPORT_PLUGIN_PROFILER 1
+#endif
+
+// Driver debug messages (DebugMessages.h), e.g. GL KHR_debug output. Turning debug output on
+// affects Unity's whole context and slows the driver down, so builds have to opt in by defining
+// this to 1 (the Visual Studio debug configurations do, as does "make DEBUG_MESSAGES=1"). Not
+// keyed off NDEBUG: not every project defines that in its release builds.
+#ifndef SUPPORT_DEBUG_MESSAGES
+	#define SUPPORT_DEBUG_MESSAGES 0
+#endif
+
+
+
+// Generated GL loader (GLLoader.h): GL Core entry points resolved on first call instead of linked
+#ifndef SUPPORT_GL_LOADER
+	#if SUPPORT_OPENGL_CORE && (UNITY_WIN || UNITY_LINUX)
+		#define SUPPORT_GL_LOADER 1
+	#else
+		#define SUPPORT_GL_LOADER 0
+	#endif
+#endif
+
+// OpenGL worker thread for texture uploads (GLUploadThread.h); needs Unity's context to be an EGL one
+#ifndef SUPPORT_GL_UPLOAD_THREAD
+	#if SUPPORT_OPENGL_UNIFIED && (UNITY_LINUX || UNITY_ANDROID || UNITY_EMBEDDED_LINUX)
+		#define SUPPORT_GL_UPLOAD_THREAD 1
+	#else
+		#define SUPPORT_GL_UPLOAD_THREAD 0
+	#endif
+#endif
+
 
 
 // COM-like Release macro
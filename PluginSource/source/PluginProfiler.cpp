@@ -0,0 +1,249 @@
+#include "PluginProfiler.h"
+#include "ChromeTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+// Scope timers; see PluginProfiler.h.
+
+static const char* const kProfilerScopeNames[kProfileScopeCount] =
+{
+	"OnRenderEvent",
+	"DrawColoredTriangle",
+	"ModifyTexturePixels",
+	"ModifyVertexBuffer",
+	"UpdateVirtualTexture",
+	"RenderAPI::DrawSimpleTriangles",
+	"RenderAPI::DrawMesh",
+	"RenderAPI::BeginModifyTexture",
+	"RenderAPI::EndModifyTexture",
+	"RenderAPI::UpdateTextureRegion",
+	"RenderAPI::BeginModifyVertexBuffer",
+	"RenderAPI::EndModifyVertexBuffer",
+	"TextureKernel",
+	"VertexBufferKernel",
+	"UploadThread::TextureUpload",
+	"TextureCompress",
+	"RenderAPI::UpdateCompressedTexture",
+	"RenderAPI::CreatePipeline",
+};
+
+const char* GetProfilerScopeName(ProfilerScope scope)
+{
+	return scope >= 0 && scope < kProfileScopeCount ? kProfilerScopeNames[scope] : "";
+}
+
+#if SUPPORT_PLUGIN_PROFILER
+
+// --------------------------------------------------------------------------
+// Per-thread rings. A sample is one 64 bit word, the scope in the top byte and the duration in
+// ticks below it, so the writer publishes it with a single relaxed store and never takes a lock.
+// Readers copy the ring and then drop whatever the writer may have overwritten meanwhile.
+
+static const int kScopeShift = 56;
+static const unsigned long long kTicksMask = (1ull << kScopeShift) - 1;
+
+struct ProfilerThreadRing
+{
+	std::atomic<unsigned long long> written;	// samples ever written by the owning thread
+	std::atomic<unsigned long long> resetAt;	// samples before this index are ignored
+	std::atomic<unsigned long long> samples[kProfilerRingSize];
+};
+
+// Rings are never freed: threads come and go, but the number of threads that ever run plugin code
+// is small, and readers can walk the list without caring about thread lifetimes.
+static std::mutex s_RingsMutex;
+static std::vector<ProfilerThreadRing*> s_Rings;
+static thread_local ProfilerThreadRing* t_Ring = NULL;
+
+thread_local ProfilerScope t_ActiveProfilerScope = kProfileScopeCount;
+
+
+ProfilerScope GetActiveProfilerScope()
+{
+	return t_ActiveProfilerScope;
+}
+
+
+static ProfilerThreadRing* RegisterThreadRing()
+{
+	ProfilerThreadRing* ring = new ProfilerThreadRing();
+	ring->written = 0;
+	ring->resetAt = 0;
+	for (int i = 0; i < kProfilerRingSize; ++i)
+		ring->samples[i].store(0, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> lock(s_RingsMutex);
+	s_Rings.push_back(ring);
+	return ring;
+}
+
+
+void ProfilerRecord(ProfilerScope scope, unsigned long long startTicks, unsigned long long ticks)
+{
+	if (IsChromeTraceActive())
+		ChromeTraceScope(GetProfilerScopeName(scope), startTicks, ticks);
+
+	ProfilerThreadRing* ring = t_Ring;
+	if (!ring)
+		ring = t_Ring = RegisterThreadRing();
+
+	const unsigned long long index = ring->written.load(std::memory_order_relaxed);
+	ring->samples[index % kProfilerRingSize].store(((unsigned long long)scope << kScopeShift) | (ticks & kTicksMask), std::memory_order_relaxed);
+	ring->written.store(index + 1, std::memory_order_release);
+}
+
+
+// --------------------------------------------------------------------------
+// Tick to nanosecond conversion. The TSC runs at a constant rate on anything recent, so it is
+// calibrated once against the monotonic clock; elsewhere ticks already are nanoseconds.
+
+#if PLUGIN_PROFILER_USE_TSC
+
+static double s_NsPerTick = 1.0;
+static unsigned long long s_CalibrationTicks = 0;
+static unsigned long long s_CalibrationNs = 0;
+static std::once_flag s_Calibrated;
+
+static void Calibrate()
+{
+	typedef std::chrono::steady_clock Clock;
+	const Clock::time_point start = Clock::now();
+	const unsigned long long startTicks = ProfilerTicks();
+	Clock::time_point end;
+	do
+		end = Clock::now();
+	while (end - start < std::chrono::milliseconds(10));
+	const unsigned long long endTicks = ProfilerTicks();
+	const double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+	s_NsPerTick = endTicks > startTicks ? ns / double(endTicks - startTicks) : 1.0;
+	s_CalibrationTicks = endTicks;
+	s_CalibrationNs = (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(end.time_since_epoch()).count();
+}
+
+double GetProfilerNanosecondsPerTick()
+{
+	std::call_once(s_Calibrated, Calibrate);
+	return s_NsPerTick;
+}
+
+unsigned long long ProfilerTicksToSteadyNs(unsigned long long ticks)
+{
+	std::call_once(s_Calibrated, Calibrate);
+	const double offsetNs = (double((long long)(ticks - s_CalibrationTicks))) * s_NsPerTick;
+	return s_CalibrationNs + (long long)offsetNs;
+}
+
+#else
+
+double GetProfilerNanosecondsPerTick()
+{
+	return 1.0;
+}
+
+unsigned long long ProfilerTicksToSteadyNs(unsigned long long ticks)
+{
+	return ticks;
+}
+
+#endif // if PLUGIN_PROFILER_USE_TSC
+
+
+// --------------------------------------------------------------------------
+// Stats
+
+static unsigned long long Percentile(const std::vector<unsigned long long>& sorted, int percent)
+{
+	// Nearest rank
+	size_t rank = (sorted.size() * percent + 99) / 100;
+	return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+
+int GetProfilerStats(ProfilerScopeStats* outStats, int maxCount)
+{
+	if (!outStats || maxCount <= 0)
+		return 0;
+
+	std::vector<unsigned long long> ticks[kProfileScopeCount];
+	std::vector<unsigned long long> copy(kProfilerRingSize);
+	{
+		std::lock_guard<std::mutex> lock(s_RingsMutex);
+		for (size_t r = 0; r < s_Rings.size(); ++r)
+		{
+			ProfilerThreadRing* ring = s_Rings[r];
+			const unsigned long long end = ring->written.load(std::memory_order_acquire);
+			unsigned long long begin = std::max(ring->resetAt.load(std::memory_order_relaxed), end > kProfilerRingSize ? end - kProfilerRingSize : 0ull);
+			for (unsigned long long i = begin; i < end; ++i)
+				copy[i % kProfilerRingSize] = ring->samples[i % kProfilerRingSize].load(std::memory_order_relaxed);
+
+			// Anything the writer got to while we were copying is not the sample we wanted
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const unsigned long long writtenNow = ring->written.load(std::memory_order_relaxed);
+			if (writtenNow > kProfilerRingSize)
+				begin = std::max(begin, writtenNow - kProfilerRingSize);
+
+			for (unsigned long long i = begin; i < end; ++i)
+			{
+				const unsigned long long sample = copy[i % kProfilerRingSize];
+				const int scope = int(sample >> kScopeShift);
+				if (scope < kProfileScopeCount)
+					ticks[scope].push_back(sample & kTicksMask);
+			}
+		}
+	}
+
+	const double nsPerTick = GetProfilerNanosecondsPerTick();
+	const int count = std::min<int>(maxCount, kProfileScopeCount);
+	for (int scope = 0; scope < count; ++scope)
+	{
+		ProfilerScopeStats& stats = outStats[scope];
+		std::vector<unsigned long long>& samples = ticks[scope];
+		stats = ProfilerScopeStats();
+		if (samples.empty())
+			continue;
+
+		std::sort(samples.begin(), samples.end());
+		double sum = 0.0;
+		for (size_t i = 0; i < samples.size(); ++i)
+			sum += double(samples[i]);
+
+		stats.count = samples.size();
+		stats.minNs = (unsigned long long)(double(samples.front()) * nsPerTick);
+		stats.meanNs = (unsigned long long)(sum / double(samples.size()) * nsPerTick);
+		stats.p95Ns = (unsigned long long)(double(Percentile(samples, 95)) * nsPerTick);
+		stats.p99Ns = (unsigned long long)(double(Percentile(samples, 99)) * nsPerTick);
+		stats.maxNs = (unsigned long long)(double(samples.back()) * nsPerTick);
+	}
+	return count;
+}
+
+
+void ResetProfilerStats()
+{
+	std::lock_guard<std::mutex> lock(s_RingsMutex);
+	for (size_t r = 0; r < s_Rings.size(); ++r)
+		s_Rings[r]->resetAt = s_Rings[r]->written.load();
+}
+
+
+#else // #if SUPPORT_PLUGIN_PROFILER
+
+ProfilerScope GetActiveProfilerScope()
+{
+	return kProfileScopeCount;
+}
+
+int GetProfilerStats(ProfilerScopeStats* outStats, int maxCount)
+{
+	return 0;
+}
+
+void ResetProfilerStats()
+{
+}
+
+#endif // #if SUPPORT_PLUGIN_PROFILER
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "PlatformBase.h"
+
+// CPU scope timers for the plugin's render thread hot paths. Each thread records into its own
+// lock-free ring of the most recent samples, so timing a scope costs two timestamp reads and one
+// store; stats are only computed when somebody asks for them. Timestamps come from the TSC on x86
+// and from the monotonic clock elsewhere.
+//
+// Define SUPPORT_PLUGIN_PROFILER to 0 to compile all of this out; PLUGIN_PROFILE_SCOPE then expands
+// to nothing and GetProfilerStats reports no scopes.
+
+enum ProfilerScope
+{
+	kProfileRenderEvent = 0,
+	kProfileDrawColoredTriangle,
+	kProfileModifyTexturePixels,
+	kProfileModifyVertexBuffer,
+	kProfileUpdateVirtualTexture,
+	// RenderAPI methods, whichever backend is active
+	kProfileDrawSimpleTriangles,
+	kProfileDrawMesh,
+	kProfileBeginModifyTexture,
+	kProfileEndModifyTexture,
+	kProfileUpdateTextureRegion,
+	kProfileBeginModifyVertexBuffer,
+	kProfileEndModifyVertexBuffer,
+	// CPU work between Begin/EndModify: generating the texture and vertex data
+	kProfileTextureKernel,
+	kProfileVertexBufferKernel,
+	// Plugin worker threads
+	kProfileUploadThreadTexture,
+	// Block compression of the texture kernel's output, and uploading the blocks
+	kProfileTextureCompress,
+	kProfileUpdateCompressedTexture,
+	// Creating a pipeline state or program, from the backend's cache or from scratch
+	kProfileCreatePipeline,
+	kProfileScopeCount
+};
+
+// Stats of one scope over the samples currently held in the rings. Plain C layout, so scripts can
+// marshal it directly. Times are in nanoseconds; all zero when the scope has no samples.
+struct ProfilerScopeStats
+{
+	unsigned long long count;
+	unsigned long long minNs;
+	unsigned long long meanNs;
+	unsigned long long p95Ns;
+	unsigned long long p99Ns;
+	unsigned long long maxNs;
+};
+
+// Each thread keeps its kProfilerRingSize most recent samples.
+enum { kProfilerRingSize = 4096 };
+
+// Fill up to maxCount entries, in ProfilerScope order. Returns the number filled, 0 if the
+// profiler is compiled out. Can be called from any thread.
+int GetProfilerStats(ProfilerScopeStats* outStats, int maxCount);
+// Forget all samples recorded so far.
+void ResetProfilerStats();
+// Readable scope name, for reports and traces
+const char* GetProfilerScopeName(ProfilerScope scope);
+// Innermost scope being timed on the calling thread; kProfileScopeCount outside of any scope, or
+// when the profiler is compiled out
+ProfilerScope GetActiveProfilerScope();
+
+
+#if SUPPORT_PLUGIN_PROFILER
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define PLUGIN_PROFILER_USE_TSC 1
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#else
+	#define PLUGIN_PROFILER_USE_TSC 0
+	#include <chrono>
+#endif
+
+inline unsigned long long ProfilerTicks()
+{
+#if PLUGIN_PROFILER_USE_TSC
+	return __rdtsc();
+#else
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void ProfilerRecord(ProfilerScope scope, unsigned long long startTicks, unsigned long long ticks);
+
+extern thread_local ProfilerScope t_ActiveProfilerScope;
+
+// Map a ProfilerTicks() value to std::chrono::steady_clock nanoseconds. The first call calibrates
+// the TSC against the steady clock, which takes about 10 ms.
+unsigned long long ProfilerTicksToSteadyNs(unsigned long long ticks);
+double GetProfilerNanosecondsPerTick();
+
+class ProfilerScopeTimer
+{
+public:
+	explicit ProfilerScopeTimer(ProfilerScope scope) : m_Scope(scope), m_Parent(t_ActiveProfilerScope), m_Start(ProfilerTicks()) { t_ActiveProfilerScope = scope; }
+	~ProfilerScopeTimer()
+	{
+		ProfilerRecord(m_Scope, m_Start, ProfilerTicks() - m_Start);
+		t_ActiveProfilerScope = m_Parent;
+	}
+
+private:
+	ProfilerScope m_Scope;
+	ProfilerScope m_Parent;
+	unsigned long long m_Start;
+};
+
+#define PLUGIN_PROFILE_CONCAT_(a, b) a##b
+#define PLUGIN_PROFILE_CONCAT(a, b) PLUGIN_PROFILE_CONCAT_(a, b)
+// Time the rest of the enclosing block
+#define PLUGIN_PROFILE_SCOPE(scope) ProfilerScopeTimer PLUGIN_PROFILE_CONCAT(profileScope_, __LINE__)(scope)
+
+#else
+
+#define PLUGIN_PROFILE_SCOPE(scope) do { } while (0)
+
+#endif // #if SUPPORT_PLUGIN_PROFILER
@@ -46,6 +46,14 @@ RenderAPI* CreateRenderAPI(UnityGfxRenderer apiType)
 	}
 #	endif // if SUPPORT_VULKAN
 
+#	if SUPPORT_NULL_RENDERER
+	if (apiType == kUnityGfxRendererNull)
+	{
+		extern RenderAPI* CreateRenderAPI_Null();
+		return CreateRenderAPI_Null();
+	}
+#	endif // if SUPPORT_NULL_RENDERER
+
 	// Unknown or unsupported graphics API
 	return NULL;
 }
@@ -1,12 +1,55 @@
 #pragma once
 
 #include "Unity/IUnityGraphics.h"
+#include "BlockCompression.h"
 
 #include <stddef.h>
 
 struct IUnityInterfaces;
 
 
+// Identifies an asynchronous upload issued through RenderAPI::EndModifyTextureAsync.
+// Tickets increase monotonically per RenderAPI instance, so "ticket <= last completed ticket" means complete.
+// Zero is never a valid ticket.
+typedef unsigned long long UploadTicket;
+
+
+// Pieces of plugin work that get GPU timestamps around them; see RenderAPI::BeginGpuScope.
+enum GpuScope
+{
+	kGpuScopeDrawTriangles = 0,
+	kGpuScopeTextureUpload,
+	kGpuScopeVertexBufferUpload,
+	kGpuScopeVirtualTextureUpload,
+	kGpuScopeCount
+};
+
+// A GPU scope result. cpuStartNs is where the scope started on the GPU, translated to the CPU's
+// steady clock (std::chrono::steady_clock nanoseconds), or -1 if the backend can't correlate clocks.
+struct GpuScopeTiming
+{
+	float ms;
+	long long cpuStartNs;
+};
+
+
+// Byte order of 8 bit per channel texels in memory
+enum TexturePixelLayout
+{
+	kTexturePixelRGBA8 = 0,
+	kTexturePixelBGRA8,
+};
+
+
+// One draw of RenderAPI::DrawSimpleTrianglesBatch
+struct SimpleTriangleDraw
+{
+	const float* worldMatrix;		// 16 floats
+	int triangleCount;
+	const void* verticesFloat3Byte4;
+};
+
+
 // Super-simple "graphics abstraction". This is nothing like how a proper platform abstraction layer would look like;
 // all this does is a base interface for whatever our plugin sample needs. Which is only "draw some triangles"
 // and "modify a texture" at this point.
@@ -15,6 +58,7 @@ struct IUnityInterfaces;
 class RenderAPI
 {
 public:
+	RenderAPI() : m_LastUploadTicket(0) { }
 	virtual ~RenderAPI() { }
 
 
@@ -25,6 +69,12 @@ public:
 	// Reversed Z is used on modern platforms, and improves depth buffer precision.
 	virtual bool GetUsesReverseZ() = 0;
 
+	// Called around the plugin's work in each render event. Unity renders in between events and
+	// leaves the device state in whatever shape it likes, so state a backend caches about the
+	// device is only good from BeginRenderEvent to EndRenderEvent.
+	virtual void BeginRenderEvent() { }
+	virtual void EndRenderEvent() { }
+
 	// Draw some triangle geometry, using some simple rendering state.
 	// Upon call into our plug-in the render state can be almost completely arbitrary depending
 	// on what was rendered in Unity before. Here, we turn off culling, blending, depth writes etc.
@@ -32,7 +82,19 @@ public:
 	// float3 (position) and byte4 (color) per vertex.
 	virtual void DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4) = 0;
 
-    virtual void DrawMesh(const float worldMatrix[16], void* positionBuffer, void* colorBuffer, int count) = 0;
+	// Draw several sets of triangles like DrawSimpleTriangles, each with its own world matrix.
+	// Backends that can submit them all at once override this; by default it's one
+	// DrawSimpleTriangles call per draw. For callers with many draws per event: the plugin's own
+	// render events draw one triangle and don't use it, only PluginBench does so far.
+	virtual void DrawSimpleTrianglesBatch(const SimpleTriangleDraw* draws, int drawCount)
+	{
+		for (int i = 0; i < drawCount; ++i)
+			DrawSimpleTriangles(draws[i].worldMatrix, draws[i].triangleCount, draws[i].verticesFloat3Byte4);
+	}
+
+	// Draw a triangle with a mesh shader; positions and colors are float4 per vertex.
+	// Only APIs with mesh shader support implement this, it does nothing elsewhere.
+	virtual void DrawMesh(const float worldMatrix[16], void* positionBuffer, void* colorBuffer, int count) { }
 
 	// Begin modifying texture data. You need to pass texture width/height too, since some graphics APIs
 	// (e.g. OpenGL ES) do not have a good way to query that from the texture itself...
@@ -41,6 +103,32 @@ public:
 	virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch) = 0;
 	// End modifying texture data.
 	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr) = 0;
+	// Byte order BeginModifyTexture data has to be written in: the texture's own, so that the upload
+	// is a plain copy rather than a swizzle in the driver. UpdateTextureRegion always takes RGBA8.
+	virtual TexturePixelLayout GetTexturePixelLayout(void* textureHandle) { return kTexturePixelRGBA8; }
+
+	// End modifying texture data without waiting for the upload to reach the GPU. Returns a ticket
+	// that can be checked with PollCompletedUploads / WaitForUpload, or 0 on failure. Several uploads
+	// can be in flight at once. Implementations that upload synchronously just complete the ticket right away.
+	virtual UploadTicket EndModifyTextureAsync(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
+	{
+		EndModifyTexture(textureHandle, textureWidth, textureHeight, rowPitch, dataPtr);
+		return ++m_LastUploadTicket;
+	}
+	// Retire finished uploads and return the newest ticket known to be complete. Never blocks.
+	virtual UploadTicket PollCompletedUploads() { return m_LastUploadTicket; }
+	// Block until the given upload has completed. Returns false if the backend can not wait for it
+	// right now (e.g. the upload is recorded into a command buffer that was not submitted yet).
+	virtual bool WaitForUpload(UploadTicket ticket) { return true; }
+
+	// Update a rectangle of one texture mip level from RGBA8 system memory data, rows rowPitch bytes apart.
+	// Used for streaming, where only a few small tiles of a large texture change per frame.
+	virtual void UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data) = 0;
+
+	// Replace mip 0 of a block compressed texture with tightly packed blocks, as BlockCompressor
+	// writes them. The texture has to be in that format already; the upload never converts. Returns
+	// a ticket like EndModifyTextureAsync, or 0 when the backend can't upload the format.
+	virtual UploadTicket UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize) { return 0; }
 
 
 	// Begin modifying vertex buffer data.
@@ -48,6 +136,19 @@ public:
 	virtual void* BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize) = 0;
 	// End modifying vertex buffer data.
 	virtual void EndModifyVertexBuffer(void* bufferHandle) = 0;
+
+
+	// GPU timestamps around a piece of plugin work. Scopes don't nest, and each one is used at most
+	// once per render event. Backends without timer queries ignore these.
+	virtual void BeginGpuScope(GpuScope scope) { }
+	virtual void EndGpuScope(GpuScope scope) { }
+	// Pick up timer results the GPU has produced by now; never waits, so results trail a few frames
+	// behind. Writes the latest result of each scope that has a new one into outTimings and leaves
+	// the others alone. Returns false if the backend has no GPU timers.
+	virtual bool ResolveGpuTimings(GpuScopeTiming outTimings[kGpuScopeCount]) { return false; }
+
+protected:
+	UploadTicket m_LastUploadTicket;
 };
 
 
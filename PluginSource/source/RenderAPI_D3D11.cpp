@@ -1,5 +1,6 @@
 #include "RenderAPI.h"
 #include "PlatformBase.h"
+#include "MemoryStats.h"
 
 // Direct3D 11 implementation of RenderAPI.
 
@@ -24,6 +25,9 @@ public:
 
 	virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch);
 	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+	virtual TexturePixelLayout GetTexturePixelLayout(void* textureHandle);
+	virtual void UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data);
+	virtual UploadTicket UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize);
 
 	virtual void* BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize);
 	virtual void EndModifyVertexBuffer(void* bufferHandle);
@@ -135,6 +139,20 @@ void RenderAPI_D3D11::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInt
 }
 
 
+// Memory accounting of the objects created here; sizes of the buffers, the rest only counted
+static void TrackCreated(IUnknown* object, MemoryCategory category, size_t bytes = 0)
+{
+	if (object)
+		MemoryStatsAlloc(kMemBackendD3D11, category, bytes);
+}
+
+static void TrackReleased(IUnknown* object, MemoryCategory category, size_t bytes = 0)
+{
+	if (object)
+		MemoryStatsFree(kMemBackendD3D11, category, bytes);
+}
+
+
 void RenderAPI_D3D11::CreateResources()
 {
 	D3D11_BUFFER_DESC desc;
@@ -193,11 +211,29 @@ void RenderAPI_D3D11::CreateResources()
 	bdesc.RenderTarget[0].BlendEnable = FALSE;
 	bdesc.RenderTarget[0].RenderTargetWriteMask = 0xF;
 	m_Device->CreateBlendState(&bdesc, &m_BlendState);
+
+	TrackCreated(m_VB, kMemCategoryBuffer, 1024);
+	TrackCreated(m_CB, kMemCategoryBuffer, 64);
+	TrackCreated(m_VertexShader, kMemCategoryShader);
+	TrackCreated(m_PixelShader, kMemCategoryShader);
+	TrackCreated(m_InputLayout, kMemCategoryOther);
+	TrackCreated(m_RasterState, kMemCategoryOther);
+	TrackCreated(m_DepthState, kMemCategoryOther);
+	TrackCreated(m_BlendState, kMemCategoryOther);
 }
 
 
 void RenderAPI_D3D11::ReleaseResources()
 {
+	TrackReleased(m_VB, kMemCategoryBuffer, 1024);
+	TrackReleased(m_CB, kMemCategoryBuffer, 64);
+	TrackReleased(m_VertexShader, kMemCategoryShader);
+	TrackReleased(m_PixelShader, kMemCategoryShader);
+	TrackReleased(m_InputLayout, kMemCategoryOther);
+	TrackReleased(m_RasterState, kMemCategoryOther);
+	TrackReleased(m_DepthState, kMemCategoryOther);
+	TrackReleased(m_BlendState, kMemCategoryOther);
+
 	SAFE_RELEASE(m_VB);
 	SAFE_RELEASE(m_CB);
 	SAFE_RELEASE(m_VertexShader);
@@ -248,6 +284,7 @@ void* RenderAPI_D3D11::BeginModifyTexture(void* textureHandle, int textureWidth,
 	const int rowPitch = textureWidth * 4;
 	// Just allocate a system memory buffer here for simplicity
 	unsigned char* data = new unsigned char[rowPitch * textureHeight];
+	MemoryStatsAlloc(kMemBackendD3D11, kMemCategoryStaging, rowPitch * textureHeight);
 	*outRowPitch = rowPitch;
 	return data;
 }
@@ -263,7 +300,74 @@ void RenderAPI_D3D11::EndModifyTexture(void* textureHandle, int textureWidth, in
 	// Update texture data, and free the memory buffer
 	ctx->UpdateSubresource(d3dtex, 0, NULL, dataPtr, rowPitch, 0);
 	delete[] (unsigned char*)dataPtr;
+	MemoryStatsFree(kMemBackendD3D11, kMemCategoryStaging, rowPitch * textureHeight);
+	ctx->Release();
+}
+
+
+TexturePixelLayout RenderAPI_D3D11::GetTexturePixelLayout(void* textureHandle)
+{
+	// UpdateSubresource copies bytes as they are; a BGRA texture needs BGRA data
+	D3D11_TEXTURE2D_DESC desc;
+	((ID3D11Texture2D*)textureHandle)->GetDesc(&desc);
+	switch (desc.Format)
+	{
+	case DXGI_FORMAT_B8G8R8A8_UNORM:
+	case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+	case DXGI_FORMAT_B8G8R8A8_TYPELESS:
+		return kTexturePixelBGRA8;
+	default:
+		return kTexturePixelRGBA8;
+	}
+}
+
+
+void RenderAPI_D3D11::UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data)
+{
+	ID3D11Texture2D* d3dtex = (ID3D11Texture2D*)textureHandle;
+	assert(d3dtex);
+
+	ID3D11DeviceContext* ctx = NULL;
+	m_Device->GetImmediateContext(&ctx);
+	// Subresource index of a mip level is just the mip level for non-array textures
+	D3D11_BOX box = { (UINT)x, (UINT)y, 0, (UINT)(x + width), (UINT)(y + height), 1 };
+	ctx->UpdateSubresource(d3dtex, mipLevel, &box, data, rowPitch, 0);
+	ctx->Release();
+}
+
+
+// Texture formats that take the blocks of a TextureBlockFormat; of those, D3D has the BC ones only.
+// Unity creates textures typeless when they may get sRGB views; the blocks are the same.
+static bool IsBlockFormatOfTexture(TextureBlockFormat format, DXGI_FORMAT textureFormat)
+{
+	switch (format)
+	{
+	case kBlockFormatBC1:
+		return textureFormat == DXGI_FORMAT_BC1_TYPELESS || textureFormat == DXGI_FORMAT_BC1_UNORM || textureFormat == DXGI_FORMAT_BC1_UNORM_SRGB;
+	case kBlockFormatBC4:
+		return textureFormat == DXGI_FORMAT_BC4_TYPELESS || textureFormat == DXGI_FORMAT_BC4_UNORM;
+	default:
+		return false;
+	}
+}
+
+
+UploadTicket RenderAPI_D3D11::UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize)
+{
+	ID3D11Texture2D* d3dtex = (ID3D11Texture2D*)textureHandle;
+	assert(d3dtex);
+	// UpdateSubresource reads as much as the texture's format needs, whatever data holds
+	D3D11_TEXTURE2D_DESC desc;
+	d3dtex->GetDesc(&desc);
+	if (!IsBlockFormatOfTexture(format, desc.Format) || dataSize != GetBlockCompressedSize(format, textureWidth, textureHeight))
+		return 0;
+
+	ID3D11DeviceContext* ctx = NULL;
+	m_Device->GetImmediateContext(&ctx);
+	// The row pitch of block compressed data is that of a row of blocks
+	ctx->UpdateSubresource(d3dtex, 0, NULL, data, GetBlockCountX(textureWidth) * kBlockBytes, 0);
 	ctx->Release();
+	return ++m_LastUploadTicket;
 }
 
 
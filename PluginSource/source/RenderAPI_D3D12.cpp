@@ -1,5 +1,6 @@
 #include "RenderAPI.h"
 #include "PlatformBase.h"
+#include "MemoryStats.h"
 
 #include <cmath>
 
@@ -9,6 +10,7 @@
 #if SUPPORT_D3D12
 
 #include <assert.h>
+#include <string.h>
 #include <d3d12.h>
 #include "Unity/IUnityGraphicsD3D12.h"
 
@@ -27,6 +29,12 @@ public:
 
 	virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch);
 	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+	virtual TexturePixelLayout GetTexturePixelLayout(void* textureHandle);
+	virtual UploadTicket EndModifyTextureAsync(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+	virtual UploadTicket PollCompletedUploads();
+	virtual bool WaitForUpload(UploadTicket ticket);
+	virtual void UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data);
+	virtual UploadTicket UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize);
 
 	virtual void* BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize);
 	virtual void EndModifyVertexBuffer(void* bufferHandle);
@@ -34,16 +42,25 @@ public:
 private:
 	UINT64 AlignPow2(UINT64 value);
 	UINT64 GetAlignedSize(int width, int height, int pixelSize, int rowPitch);
-	ID3D12Resource* GetUploadResource(UINT64 size);
+	ID3D12Resource* GetUploadResource(int slot, UINT64 size);
+	int BeginUploadSlot();
+	UploadTicket SubmitTextureCopy(int slot, ID3D12Resource* resource, ID3D12Resource* upload, const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& footprint, UINT subresource = 0, UINT x = 0, UINT y = 0);
+	void WaitForFenceValue(UINT64 value);
 	void CreateResources();
 	void ReleaseResources();
 
 private:
+	// Texture uploads go through a small ring of upload buffers / command lists, each guarded by
+	// the frame fence value of its last submission. A slot is only waited on when the GPU is
+	// kUploadRingSize uploads behind, so in steady state the render thread does not block.
+	enum { kUploadRingSize = 3 };
+
 	IUnityGraphicsD3D12v2* s_D3D12;
-	ID3D12Resource* s_D3D12Upload;
-	ID3D12CommandAllocator* s_D3D12CmdAlloc;
-	ID3D12GraphicsCommandList* s_D3D12CmdList;
-	UINT64 s_D3D12FenceValue = 0;
+	ID3D12Resource* s_D3D12Upload[kUploadRingSize];
+	ID3D12CommandAllocator* s_D3D12CmdAlloc[kUploadRingSize];
+	ID3D12GraphicsCommandList* s_D3D12CmdList[kUploadRingSize];
+	UINT64 s_D3D12FenceValue[kUploadRingSize];
+	int s_D3D12UploadSlot;
 	HANDLE s_D3D12Event = NULL;
 };
 
@@ -59,12 +76,16 @@ const UINT kNodeMask = 0;
 
 RenderAPI_D3D12::RenderAPI_D3D12()
 	: s_D3D12(NULL)
-	, s_D3D12Upload(NULL)
-	, s_D3D12CmdAlloc(NULL)
-	, s_D3D12CmdList(NULL)
-	, s_D3D12FenceValue(0)
+	, s_D3D12UploadSlot(0)
 	, s_D3D12Event(NULL)
 {
+	for (int i = 0; i < kUploadRingSize; ++i)
+	{
+		s_D3D12Upload[i] = NULL;
+		s_D3D12CmdAlloc[i] = NULL;
+		s_D3D12CmdList[i] = NULL;
+		s_D3D12FenceValue[i] = 0;
+	}
 }
 
 UINT64 RenderAPI_D3D12::AlignPow2(UINT64 value)
@@ -93,15 +114,16 @@ UINT64 RenderAPI_D3D12::GetAlignedSize( int width, int height, int pixelSize, in
 	}
 }
 
-ID3D12Resource* RenderAPI_D3D12::GetUploadResource(UINT64 size)
+ID3D12Resource* RenderAPI_D3D12::GetUploadResource(int slot, UINT64 size)
 {
-	if (s_D3D12Upload)
+	if (s_D3D12Upload[slot])
 	{
-		D3D12_RESOURCE_DESC desc = s_D3D12Upload->GetDesc();
-		if (desc.Width == size)
-			return s_D3D12Upload;
-		else
-			s_D3D12Upload->Release();
+		// Big enough will do; region updates come in all sizes
+		D3D12_RESOURCE_DESC desc = s_D3D12Upload[slot]->GetDesc();
+		if (desc.Width >= size)
+			return s_D3D12Upload[slot];
+		MemoryStatsFree(kMemBackendD3D12, kMemCategoryStaging, (size_t)desc.Width);
+		SAFE_RELEASE(s_D3D12Upload[slot]);
 	}
 
 	// Texture upload buffer
@@ -132,13 +154,28 @@ ID3D12Resource* RenderAPI_D3D12::GetUploadResource(UINT64 size)
 		&heapDesc,
 		D3D12_RESOURCE_STATE_GENERIC_READ,
 		nullptr,
-		IID_PPV_ARGS(&s_D3D12Upload));
+		IID_PPV_ARGS(&s_D3D12Upload[slot]));
 	if (FAILED(hr))
 	{
 		OutputDebugStringA("Failed to CreateCommittedResource.\n");
 	}
+	else
+	{
+		MemoryStatsAlloc(kMemBackendD3D12, kMemCategoryStaging, (size_t)size);
+	}
 
-	return s_D3D12Upload;
+	return s_D3D12Upload[slot];
+}
+
+
+void RenderAPI_D3D12::WaitForFenceValue(UINT64 value)
+{
+	ID3D12Fence* fence = s_D3D12->GetFrameFence();
+	if (fence->GetCompletedValue() < value)
+	{
+		fence->SetEventOnCompletion(value, s_D3D12Event);
+		WaitForSingleObject(s_D3D12Event, INFINITE);
+	}
 }
 
 
@@ -148,26 +185,38 @@ void RenderAPI_D3D12::CreateResources()
 
 	HRESULT hr = E_FAIL;
 
-	// Command list
-	hr = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&s_D3D12CmdAlloc));
-	if (FAILED(hr)) OutputDebugStringA("Failed to CreateCommandAllocator.\n");
-	hr = device->CreateCommandList(kNodeMask, D3D12_COMMAND_LIST_TYPE_DIRECT, s_D3D12CmdAlloc, nullptr, IID_PPV_ARGS(&s_D3D12CmdList));
-	if (FAILED(hr)) OutputDebugStringA("Failed to CreateCommandList.\n");
-	s_D3D12CmdList->Close();
+	// Command lists, one per upload slot
+	for (int i = 0; i < kUploadRingSize; ++i)
+	{
+		hr = device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&s_D3D12CmdAlloc[i]));
+		if (FAILED(hr)) OutputDebugStringA("Failed to CreateCommandAllocator.\n");
+		hr = device->CreateCommandList(kNodeMask, D3D12_COMMAND_LIST_TYPE_DIRECT, s_D3D12CmdAlloc[i], nullptr, IID_PPV_ARGS(&s_D3D12CmdList[i]));
+		if (FAILED(hr)) OutputDebugStringA("Failed to CreateCommandList.\n");
+		s_D3D12CmdList[i]->Close();
+		s_D3D12FenceValue[i] = 0;
+		MemoryStatsAlloc(kMemBackendD3D12, kMemCategoryOther, 0);	// allocator + list
+	}
 
 	// Fence
-	s_D3D12FenceValue = 0;
+	s_D3D12UploadSlot = 0;
 	s_D3D12Event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
 }
 
 
 void RenderAPI_D3D12::ReleaseResources()
 {
-	SAFE_RELEASE(s_D3D12Upload);
+	for (int i = 0; i < kUploadRingSize; ++i)
+	{
+		if (s_D3D12Upload[i])
+			MemoryStatsFree(kMemBackendD3D12, kMemCategoryStaging, (size_t)s_D3D12Upload[i]->GetDesc().Width);
+		if (s_D3D12CmdList[i])
+			MemoryStatsFree(kMemBackendD3D12, kMemCategoryOther, 0);
+		SAFE_RELEASE(s_D3D12Upload[i]);
+		SAFE_RELEASE(s_D3D12CmdList[i]);
+		SAFE_RELEASE(s_D3D12CmdAlloc[i]);
+	}
 	if (s_D3D12Event)
 		CloseHandle(s_D3D12Event);
-	SAFE_RELEASE(s_D3D12CmdList);
-	SAFE_RELEASE(s_D3D12CmdAlloc);
 }
 
 
@@ -192,26 +241,61 @@ void RenderAPI_D3D12::DrawSimpleTriangles(const float worldMatrix[16], int trian
 }
 
 
-void* RenderAPI_D3D12::BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch)
+// Move to the next upload slot and begin its command list; this only waits if that slot's previous
+// upload is still in flight
+int RenderAPI_D3D12::BeginUploadSlot()
 {
-	ID3D12Fence* fence = s_D3D12->GetFrameFence();
+	s_D3D12UploadSlot = (s_D3D12UploadSlot + 1) % kUploadRingSize;
+	const int slot = s_D3D12UploadSlot;
+	WaitForFenceValue(s_D3D12FenceValue[slot]);
+
+	s_D3D12CmdAlloc[slot]->Reset();
+	s_D3D12CmdList[slot]->Reset(s_D3D12CmdAlloc[slot], nullptr);
+	return slot;
+}
+
+
+// Copy the footprint from the slot's upload buffer to x, y of the texture's subresource (mip 0 by
+// default) and execute the slot's command list
+UploadTicket RenderAPI_D3D12::SubmitTextureCopy(int slot, ID3D12Resource* resource, ID3D12Resource* upload, const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& footprint, UINT subresource, UINT x, UINT y)
+{
+	D3D12_TEXTURE_COPY_LOCATION srcLoc = {};
+	srcLoc.pResource = upload;
+	srcLoc.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+	srcLoc.PlacedFootprint = footprint;
+
+	D3D12_TEXTURE_COPY_LOCATION dstLoc = {};
+	dstLoc.pResource = resource;
+	dstLoc.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+	dstLoc.SubresourceIndex = subresource;
+
+	// We inform Unity that we expect this resource to be in D3D12_RESOURCE_STATE_COPY_DEST state,
+	// and because we do not barrier it ourselves, we tell Unity that no changes are done on our command list.
+	UnityGraphicsD3D12ResourceState resourceState = {};
+	resourceState.resource = resource;
+	resourceState.expected = D3D12_RESOURCE_STATE_COPY_DEST;
+	resourceState.current = D3D12_RESOURCE_STATE_COPY_DEST;
+
+	// Queue data upload
+	s_D3D12CmdList[slot]->CopyTextureRegion(&dstLoc, x, y, 0, &srcLoc, nullptr);
+
+	// Execute the command list; the returned frame fence value is our ticket
+	s_D3D12CmdList[slot]->Close();
+	s_D3D12FenceValue[slot] = s_D3D12->ExecuteCommandList(s_D3D12CmdList[slot], 1, &resourceState);
+	m_LastUploadTicket = s_D3D12FenceValue[slot];
+	return m_LastUploadTicket;
+}
 
-	// Wait on the previous job (example only - simplifies resource management)
-	if (fence->GetCompletedValue() < s_D3D12FenceValue)
-	{
-		fence->SetEventOnCompletion(s_D3D12FenceValue, s_D3D12Event);
-		WaitForSingleObject(s_D3D12Event, INFINITE);
-	}
 
-	// Begin a command list
-	s_D3D12CmdAlloc->Reset();
-	s_D3D12CmdList->Reset(s_D3D12CmdAlloc, nullptr);
+void* RenderAPI_D3D12::BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch)
+{
+	const int slot = BeginUploadSlot();
 
 	// Fill data
 	// Clamp to minimum rowPitch of RGBA32
 	*outRowPitch = max(AlignPow2(textureWidth * 4), 256);
 	const UINT64 kDataSize = GetAlignedSize(textureWidth, textureHeight, 4, *outRowPitch);
-	ID3D12Resource* upload = GetUploadResource(kDataSize);
+	ID3D12Resource* upload = GetUploadResource(slot, kDataSize);
 	void* mapped = NULL;
 	upload->Map(0, NULL, &mapped);
 	return mapped;
@@ -219,11 +303,18 @@ void* RenderAPI_D3D12::BeginModifyTexture(void* textureHandle, int textureWidth,
 
 
 void RenderAPI_D3D12::EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
+{
+	EndModifyTextureAsync(textureHandle, textureWidth, textureHeight, rowPitch, dataPtr);
+}
+
+
+UploadTicket RenderAPI_D3D12::EndModifyTextureAsync(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
 {
 	ID3D12Device* device = s_D3D12->GetDevice();
+	const int slot = s_D3D12UploadSlot;
 
 	const UINT64 kDataSize = GetAlignedSize(textureWidth, textureHeight, 4, rowPitch);
-	ID3D12Resource* upload = GetUploadResource(kDataSize);
+	ID3D12Resource* upload = GetUploadResource(slot, kDataSize);
 	upload->Unmap(0, NULL);
 
 	ID3D12Resource* resource = (ID3D12Resource*)textureHandle;
@@ -231,29 +322,94 @@ void RenderAPI_D3D12::EndModifyTexture(void* textureHandle, int textureWidth, in
 	assert(desc.Width == textureWidth);
 	assert(desc.Height == textureHeight);
 
-	D3D12_TEXTURE_COPY_LOCATION srcLoc = {};
-	srcLoc.pResource = upload;
-	srcLoc.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
-	device->GetCopyableFootprints(&desc, 0, 1, 0, &srcLoc.PlacedFootprint, nullptr, nullptr, nullptr);
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+	device->GetCopyableFootprints(&desc, 0, 1, 0, &footprint, nullptr, nullptr, nullptr);
+	return SubmitTextureCopy(slot, resource, upload, footprint);
+}
 
-	D3D12_TEXTURE_COPY_LOCATION dstLoc = {};
-	dstLoc.pResource = resource;
-	dstLoc.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
-	dstLoc.SubresourceIndex = 0;
 
-	// We inform Unity that we expect this resource to be in D3D12_RESOURCE_STATE_COPY_DEST state,
-	// and because we do not barrier it ourselves, we tell Unity that no changes are done on our command list.
-	UnityGraphicsD3D12ResourceState resourceState = {};
-	resourceState.resource = resource;
-	resourceState.expected = D3D12_RESOURCE_STATE_COPY_DEST;
-	resourceState.current = D3D12_RESOURCE_STATE_COPY_DEST;
+UploadTicket RenderAPI_D3D12::PollCompletedUploads()
+{
+	return s_D3D12->GetFrameFence()->GetCompletedValue();
+}
+
+
+bool RenderAPI_D3D12::WaitForUpload(UploadTicket ticket)
+{
+	WaitForFenceValue(ticket);
+	return true;
+}
+
+
+TexturePixelLayout RenderAPI_D3D12::GetTexturePixelLayout(void* textureHandle)
+{
+	// CopyTextureRegion copies bytes as they are; a BGRA texture needs BGRA data
+	switch (((ID3D12Resource*)textureHandle)->GetDesc().Format)
+	{
+	case DXGI_FORMAT_B8G8R8A8_UNORM:
+	case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+	case DXGI_FORMAT_B8G8R8A8_TYPELESS:
+		return kTexturePixelBGRA8;
+	default:
+		return kTexturePixelRGBA8;
+	}
+}
 
-	// Queue data upload
-	s_D3D12CmdList->CopyTextureRegion(&dstLoc, 0, 0, 0, &srcLoc, nullptr);
 
-	// Execute the command list
-	s_D3D12CmdList->Close();
-	s_D3D12FenceValue = s_D3D12->ExecuteCommandList(s_D3D12CmdList, 1, &resourceState);
+void RenderAPI_D3D12::UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data)
+{
+	ID3D12Resource* resource = (ID3D12Resource*)textureHandle;
+	assert(resource);
+	D3D12_RESOURCE_DESC desc = resource->GetDesc();
+
+	// RGBA8 rows, repacked to the pitch alignment copies need
+	const UINT packedRowSize = (UINT)width * 4;
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint = {};
+	footprint.Offset = 0;
+	footprint.Footprint.Format = desc.Format;
+	footprint.Footprint.Width = (UINT)width;
+	footprint.Footprint.Height = (UINT)height;
+	footprint.Footprint.Depth = 1;
+	footprint.Footprint.RowPitch = (packedRowSize + D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1) & ~(D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1);
+
+	const int slot = BeginUploadSlot();
+	ID3D12Resource* upload = GetUploadResource(slot, (UINT64)footprint.Footprint.RowPitch * height);
+	unsigned char* mapped = NULL;
+	upload->Map(0, NULL, (void**)&mapped);
+	for (int row = 0; row < height; ++row)
+		memcpy(mapped + row * footprint.Footprint.RowPitch, (const unsigned char*)data + row * rowPitch, packedRowSize);
+	upload->Unmap(0, NULL);
+	// Subresource index of a mip level is just the mip level for non-array textures
+	SubmitTextureCopy(slot, resource, upload, footprint, (UINT)mipLevel, (UINT)x, (UINT)y);
+}
+
+
+UploadTicket RenderAPI_D3D12::UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize)
+{
+	// Of the block formats, D3D has the BC ones only
+	if (format != kBlockFormatBC1 && format != kBlockFormatBC4)
+		return 0;
+	ID3D12Device* device = s_D3D12->GetDevice();
+	ID3D12Resource* resource = (ID3D12Resource*)textureHandle;
+	D3D12_RESOURCE_DESC desc = resource->GetDesc();
+
+	// Rows of blocks, each at the pitch copies need
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+	UINT rowCount = 0;
+	UINT64 rowSize = 0, uploadSize = 0;
+	device->GetCopyableFootprints(&desc, 0, 1, 0, &footprint, &rowCount, &rowSize, &uploadSize);
+	const size_t packedRowSize = (size_t)GetBlockCountX(textureWidth) * kBlockBytes;
+	if (rowSize != packedRowSize || rowCount * packedRowSize != dataSize)
+		return 0;
+
+	const int slot = BeginUploadSlot();
+	ID3D12Resource* upload = GetUploadResource(slot, uploadSize);
+	unsigned char* mapped = NULL;
+	upload->Map(0, NULL, (void**)&mapped);
+	for (UINT row = 0; row < rowCount; ++row)
+		memcpy(mapped + footprint.Offset + row * footprint.Footprint.RowPitch, (const unsigned char*)data + row * packedRowSize, packedRowSize);
+	upload->Unmap(0, NULL);
+	return SubmitTextureCopy(slot, resource, upload, footprint);
 }
 
 
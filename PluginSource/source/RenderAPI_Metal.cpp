@@ -1,6 +1,7 @@
 
 #include "RenderAPI.h"
 #include "PlatformBase.h"
+#include "MemoryStats.h"
 
 
 // Metal implementation of RenderAPI.
@@ -30,12 +31,16 @@ public:
 
 	virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch);
 	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+	virtual TexturePixelLayout GetTexturePixelLayout(void* textureHandle);
+	virtual void UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data);
+	virtual UploadTicket UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize);
 
 	virtual void* BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize);
 	virtual void EndModifyVertexBuffer(void* bufferHandle);
 
 private:
 	void CreateResources();
+	void ReleaseResources();
 
 private:
 	IUnityGraphicsMetal*	m_MetalGraphics;
@@ -257,10 +262,67 @@ void RenderAPI_Metal::CreateResources()
         ::fprintf(stderr, "Metal: Error creating pipeline state: %s\n%s\n", error->localizedDescription()->utf8String(), error->localizedFailureReason()->utf8String());
         error = nullptr;
     }
+
+	// Pipeline states keep what they need of the shader functions
+	NS::Object* shaderObjects[] = { vertexFunction, fragmentFunction, meshFunction, meshFragmentFunction, shaderLibrary, meshShaderLibrary };
+	for (size_t i = 0; i < sizeof(shaderObjects) / sizeof(shaderObjects[0]); ++i)
+		if (shaderObjects[i])
+			shaderObjects[i]->release();
+
+	MemoryStatsAlloc(kMemBackendMetal, kMemCategoryBuffer, m_VertexBuffer->length());
+	MemoryStatsAlloc(kMemBackendMetal, kMemCategoryBuffer, m_PositionBuffer->length());
+	MemoryStatsAlloc(kMemBackendMetal, kMemCategoryBuffer, m_ColorBuffer->length());
+	MemoryStatsAlloc(kMemBackendMetal, kMemCategoryBuffer, m_ConstantBuffer->length());
+	if (m_DepthStencil)
+		MemoryStatsAlloc(kMemBackendMetal, kMemCategoryOther, 0);
+	if (m_Pipeline)
+		MemoryStatsAlloc(kMemBackendMetal, kMemCategoryShader, 0);
+	if (m_MeshPipeline)
+		MemoryStatsAlloc(kMemBackendMetal, kMemCategoryShader, 0);
+}
+
+
+void RenderAPI_Metal::ReleaseResources()
+{
+	MTL::Buffer** buffers[] = { &m_VertexBuffer, &m_PositionBuffer, &m_ColorBuffer, &m_ConstantBuffer };
+	for (size_t i = 0; i < sizeof(buffers) / sizeof(buffers[0]); ++i)
+	{
+		if (!*buffers[i])
+			continue;
+		MemoryStatsFree(kMemBackendMetal, kMemCategoryBuffer, (*buffers[i])->length());
+		(*buffers[i])->release();
+		*buffers[i] = nullptr;
+	}
+	if (m_DepthStencil)
+	{
+		MemoryStatsFree(kMemBackendMetal, kMemCategoryOther, 0);
+		m_DepthStencil->release();
+		m_DepthStencil = nullptr;
+	}
+	if (m_Pipeline)
+	{
+		MemoryStatsFree(kMemBackendMetal, kMemCategoryShader, 0);
+		m_Pipeline->release();
+		m_Pipeline = nullptr;
+	}
+	if (m_MeshPipeline)
+	{
+		MemoryStatsFree(kMemBackendMetal, kMemCategoryShader, 0);
+		m_MeshPipeline->release();
+		m_MeshPipeline = nullptr;
+	}
 }
 
 
 RenderAPI_Metal::RenderAPI_Metal()
+	: m_MetalGraphics(NULL)
+	, m_VertexBuffer(NULL)
+	, m_PositionBuffer(NULL)
+	, m_ColorBuffer(NULL)
+	, m_ConstantBuffer(NULL)
+	, m_DepthStencil(NULL)
+	, m_Pipeline(NULL)
+	, m_MeshPipeline(NULL)
 {
 }
 
@@ -275,7 +337,7 @@ void RenderAPI_Metal::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInt
 	}
 	else if (type == kUnityGfxDeviceEventShutdown)
 	{
-		//@TODO: release resources
+		ReleaseResources();
 	}
 }
 
@@ -346,6 +408,7 @@ void* RenderAPI_Metal::BeginModifyTexture(void* textureHandle, int textureWidth,
 	const int rowPitch = textureWidth * 4;
 	// Just allocate a system memory buffer here for simplicity
 	unsigned char* data = new unsigned char[rowPitch * textureHeight];
+	MemoryStatsAlloc(kMemBackendMetal, kMemCategoryStaging, rowPitch * textureHeight);
 	*outRowPitch = rowPitch;
 	return data;
 }
@@ -357,6 +420,54 @@ void RenderAPI_Metal::EndModifyTexture(void* textureHandle, int textureWidth, in
 	// Update texture data, and free the memory buffer
 	tex->replaceRegion(MTL::Region(0,0,0, textureWidth,textureHeight,1), 0, dataPtr, rowPitch);
 	delete[](unsigned char*)dataPtr;
+	MemoryStatsFree(kMemBackendMetal, kMemCategoryStaging, rowPitch * textureHeight);
+}
+
+
+TexturePixelLayout RenderAPI_Metal::GetTexturePixelLayout(void* textureHandle)
+{
+	// replaceRegion copies bytes as they are; BGRA is what Unity picks for most color textures on Apple GPUs
+	const MTL::PixelFormat format = ((MTL::Texture*)textureHandle)->pixelFormat();
+	return format == MTL::PixelFormatBGRA8Unorm || format == MTL::PixelFormatBGRA8Unorm_sRGB ? kTexturePixelBGRA8 : kTexturePixelRGBA8;
+}
+
+
+void RenderAPI_Metal::UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data)
+{
+	MTL::Texture* tex = (MTL::Texture*)textureHandle;
+	tex->replaceRegion(MTL::Region(x,y,0, width,height,1), mipLevel, data, rowPitch);
+}
+
+
+// Pixel formats that take the blocks of a TextureBlockFormat. BC formats exist on macOS, ETC2 and
+// EAC on iOS and tvOS (and Apple silicon Macs); Unity only creates textures in ones that exist.
+static bool IsBlockFormatOfTexture(TextureBlockFormat format, MTL::PixelFormat pixelFormat)
+{
+	switch (format)
+	{
+	case kBlockFormatBC1:
+		return pixelFormat == MTL::PixelFormatBC1_RGBA || pixelFormat == MTL::PixelFormatBC1_RGBA_sRGB;
+	case kBlockFormatBC4:
+		return pixelFormat == MTL::PixelFormatBC4_RUnorm;
+	case kBlockFormatETC2RGB:
+		return pixelFormat == MTL::PixelFormatETC2_RGB8 || pixelFormat == MTL::PixelFormatETC2_RGB8_sRGB;
+	case kBlockFormatEACR11:
+		return pixelFormat == MTL::PixelFormatEAC_R11Unorm;
+	default:
+		return false;
+	}
+}
+
+
+UploadTicket RenderAPI_Metal::UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize)
+{
+	MTL::Texture* tex = (MTL::Texture*)textureHandle;
+	// replaceRegion reads as much as the texture's format needs, whatever data holds
+	if (!IsBlockFormatOfTexture(format, tex->pixelFormat()) || dataSize != GetBlockCompressedSize(format, textureWidth, textureHeight))
+		return 0;
+	// bytesPerRow of block compressed data is that of a row of blocks
+	tex->replaceRegion(MTL::Region(0,0,0, textureWidth,textureHeight,1), 0, data, GetBlockCountX(textureWidth) * kBlockBytes);
+	return ++m_LastUploadTicket;
 }
 
 
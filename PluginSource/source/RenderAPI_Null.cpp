@@ -0,0 +1,289 @@
+#include "RenderAPI.h"
+#include "RenderAPI_Null.h"
+#include "MemoryStats.h"
+#include "PlatformBase.h"
+
+// Null implementation of RenderAPI; see RenderAPI_Null.h.
+
+#if SUPPORT_NULL_RENDERER
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+
+// --------------------------------------------------------------------------
+// Command log and buffer registry. These are global rather than per device, so scripts can
+// register buffers and read the log regardless of when the device gets created or destroyed.
+
+static std::mutex s_NullLogMutex;
+static std::vector<NullCommand> s_NullLog;			// ring of kNullCommandLogCapacity entries
+static unsigned long long s_NullLogWritten = 0;		// total commands ever written since last clear
+static NullCommandTotals s_NullTotals[kNullCmdCount];
+
+static std::mutex s_NullBufferMutex;
+static std::unordered_map<void*, std::vector<unsigned char> > s_NullBuffers;
+
+
+static void RecordNullCommand(NullCommandType type, size_t bytes, unsigned long long startNs, unsigned long long durationNs)
+{
+	std::lock_guard<std::mutex> lock(s_NullLogMutex);
+	if (s_NullLog.empty())
+		s_NullLog.resize(kNullCommandLogCapacity);
+
+	NullCommand& cmd = s_NullLog[s_NullLogWritten % kNullCommandLogCapacity];
+	cmd.type = type;
+	cmd.bytes = (int)bytes;
+	cmd.startNs = startNs;
+	cmd.durationNs = durationNs;
+	++s_NullLogWritten;
+
+	NullCommandTotals& totals = s_NullTotals[type];
+	++totals.count;
+	totals.bytes += bytes;
+	totals.durationNs += durationNs;
+}
+
+
+int GetNullCommandLog(NullCommand* outCommands, int maxCount)
+{
+	if (!outCommands || maxCount <= 0)
+		return 0;
+	std::lock_guard<std::mutex> lock(s_NullLogMutex);
+	const unsigned long long available = std::min<unsigned long long>(s_NullLogWritten, kNullCommandLogCapacity);
+	const int count = (int)std::min<unsigned long long>(available, maxCount);
+	const unsigned long long first = s_NullLogWritten - count;
+	for (int i = 0; i < count; ++i)
+		outCommands[i] = s_NullLog[(first + i) % kNullCommandLogCapacity];
+	return count;
+}
+
+
+void GetNullCommandTotals(NullCommandTotals* outTotals)
+{
+	std::lock_guard<std::mutex> lock(s_NullLogMutex);
+	memcpy(outTotals, s_NullTotals, sizeof(s_NullTotals));
+}
+
+
+void ClearNullCommandLog()
+{
+	std::lock_guard<std::mutex> lock(s_NullLogMutex);
+	s_NullLogWritten = 0;
+	memset(s_NullTotals, 0, sizeof(s_NullTotals));
+}
+
+
+void RegisterNullVertexBuffer(void* bufferHandle, size_t bufferSize)
+{
+	std::lock_guard<std::mutex> lock(s_NullBufferMutex);
+	std::unordered_map<void*, std::vector<unsigned char> >::iterator it = s_NullBuffers.find(bufferHandle);
+	const size_t oldSize = it != s_NullBuffers.end() ? it->second.size() : 0;
+	if (bufferSize == 0)
+	{
+		if (it != s_NullBuffers.end())
+			s_NullBuffers.erase(it);
+	}
+	else
+		s_NullBuffers[bufferHandle].resize(bufferSize);
+	// Outlives any device, so counted as the plugin's own memory
+	MemoryStatsResize(kMemBackendPlugin, kMemCategoryBuffer, oldSize, bufferSize);
+}
+
+
+// Staging vectors only ever grow; the accounting follows their capacity
+static void GrowNullStaging(std::vector<unsigned char>& buffer, size_t bytes)
+{
+	const size_t oldCapacity = buffer.capacity();
+	buffer.resize(std::max(buffer.size(), bytes));
+	MemoryStatsResize(kMemBackendNull, kMemCategoryStaging, oldCapacity, buffer.capacity());
+}
+
+static void ReleaseNullStaging(std::vector<unsigned char>& buffer)
+{
+	MemoryStatsResize(kMemBackendNull, kMemCategoryStaging, buffer.capacity(), 0);
+	std::vector<unsigned char>().swap(buffer);
+}
+
+
+
+// --------------------------------------------------------------------------
+// RenderAPI_Null
+
+
+class RenderAPI_Null : public RenderAPI
+{
+public:
+	RenderAPI_Null();
+	virtual ~RenderAPI_Null() { }
+
+	virtual void ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInterfaces* interfaces);
+
+	virtual bool GetUsesReverseZ() { return false; }
+
+	virtual void DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4);
+	virtual void DrawMesh(const float worldMatrix[16], void* positionBuffer, void* colorBuffer, int count);
+
+	virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch);
+	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+	virtual void UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data);
+	virtual UploadTicket UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize);
+
+	virtual void* BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize);
+	virtual void EndModifyVertexBuffer(void* bufferHandle);
+
+private:
+	unsigned long long NowNs() const;
+	void Record(NullCommandType type, size_t bytes, unsigned long long startNs) { RecordNullCommand(type, bytes, startNs, NowNs() - startNs); }
+
+private:
+	std::chrono::steady_clock::time_point m_StartTime;
+
+	// Stand-ins for GPU memory; the copies into them approximate the cost of a real upload
+	std::vector<unsigned char>	m_VertexStaging;
+	std::vector<unsigned char>	m_TextureStaging;
+	std::vector<unsigned char>	m_TextureUploads;
+	size_t						m_VertexBufferBytes;
+};
+
+
+RenderAPI* CreateRenderAPI_Null()
+{
+	return new RenderAPI_Null();
+}
+
+
+RenderAPI_Null::RenderAPI_Null()
+	: m_StartTime(std::chrono::steady_clock::now())
+	, m_VertexBufferBytes(0)
+{
+}
+
+
+unsigned long long RenderAPI_Null::NowNs() const
+{
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_StartTime).count();
+}
+
+
+void RenderAPI_Null::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInterfaces* interfaces)
+{
+	if (type == kUnityGfxDeviceEventShutdown)
+	{
+		ReleaseNullStaging(m_VertexStaging);
+		ReleaseNullStaging(m_TextureStaging);
+		ReleaseNullStaging(m_TextureUploads);
+	}
+}
+
+
+void RenderAPI_Null::DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4)
+{
+	const unsigned long long start = NowNs();
+	const size_t bytes = triangleCount * 3 * (12 + 4);
+	GrowNullStaging(m_VertexStaging, bytes);
+	if (bytes)
+		memcpy(&m_VertexStaging[0], verticesFloat3Byte4, bytes);
+	Record(kNullCmdDrawSimpleTriangles, bytes, start);
+}
+
+
+void RenderAPI_Null::DrawMesh(const float worldMatrix[16], void* positionBuffer, void* colorBuffer, int count)
+{
+	const unsigned long long start = NowNs();
+	const size_t streamBytes = count * 16;
+	GrowNullStaging(m_VertexStaging, streamBytes * 2);
+	if (streamBytes)
+	{
+		memcpy(&m_VertexStaging[0], positionBuffer, streamBytes);
+		memcpy(&m_VertexStaging[streamBytes], colorBuffer, streamBytes);
+	}
+	Record(kNullCmdDrawMesh, streamBytes * 2, start);
+}
+
+
+void* RenderAPI_Null::BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch)
+{
+	const unsigned long long start = NowNs();
+	const int rowPitch = textureWidth * 4;
+	const size_t bytes = (size_t)rowPitch * textureHeight;
+	if (bytes == 0)
+		return NULL;
+	// Reuse the staging memory between frames, like the real backends
+	GrowNullStaging(m_TextureStaging, bytes);
+	*outRowPitch = rowPitch;
+	Record(kNullCmdBeginModifyTexture, bytes, start);
+	return &m_TextureStaging[0];
+}
+
+
+void RenderAPI_Null::EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
+{
+	const unsigned long long start = NowNs();
+	const size_t bytes = (size_t)rowPitch * textureHeight;
+	GrowNullStaging(m_TextureUploads, bytes);
+	if (bytes)
+		memcpy(&m_TextureUploads[0], dataPtr, bytes);
+	Record(kNullCmdEndModifyTexture, bytes, start);
+}
+
+
+void RenderAPI_Null::UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data)
+{
+	const unsigned long long start = NowNs();
+	const size_t packedPitch = width * 4;
+	const size_t bytes = packedPitch * height;
+	GrowNullStaging(m_TextureUploads, bytes);
+	const unsigned char* src = (const unsigned char*)data;
+	for (int row = 0; row < height; ++row)
+		memcpy(&m_TextureUploads[row * packedPitch], src + row * rowPitch, packedPitch);
+	Record(kNullCmdUpdateTextureRegion, bytes, start);
+}
+
+
+UploadTicket RenderAPI_Null::UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize)
+{
+	const unsigned long long start = NowNs();
+	GrowNullStaging(m_TextureUploads, dataSize);
+	if (dataSize)
+		memcpy(&m_TextureUploads[0], data, dataSize);
+	Record(kNullCmdUpdateCompressedTexture, dataSize, start);
+	return ++m_LastUploadTicket;
+}
+
+
+void* RenderAPI_Null::BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize)
+{
+	const unsigned long long start = NowNs();
+	void* data = NULL;
+	m_VertexBufferBytes = 0;
+	{
+		std::lock_guard<std::mutex> lock(s_NullBufferMutex);
+		std::unordered_map<void*, std::vector<unsigned char> >::iterator it = s_NullBuffers.find(bufferHandle);
+		if (it != s_NullBuffers.end())
+		{
+			data = &it->second[0];
+			m_VertexBufferBytes = it->second.size();
+		}
+	}
+	// Unknown buffer; fail like a real backend would with a bad handle
+	if (!data)
+		return NULL;
+	*outBufferSize = m_VertexBufferBytes;
+	Record(kNullCmdBeginModifyVertexBuffer, m_VertexBufferBytes, start);
+	return data;
+}
+
+
+void RenderAPI_Null::EndModifyVertexBuffer(void* bufferHandle)
+{
+	const unsigned long long start = NowNs();
+	Record(kNullCmdEndModifyVertexBuffer, m_VertexBufferBytes, start);
+	m_VertexBufferBytes = 0;
+}
+
+
+#endif // #if SUPPORT_NULL_RENDERER
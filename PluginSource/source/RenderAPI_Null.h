@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stddef.h>
+
+// "Null" RenderAPI: used when Unity runs without a graphics device (batch mode, -nographics), and
+// by headless hosts. It does no rendering, but hands out CPU staging memory like the real backends
+// do and records every call into an in-memory command log, so the CPU side of the plugin can be
+// benchmarked and regression tested on machines without a GPU.
+//
+// The structs here are plain C layouts, so scripts can marshal them directly.
+
+enum NullCommandType
+{
+	kNullCmdDrawSimpleTriangles = 0,
+	kNullCmdDrawMesh,
+	kNullCmdBeginModifyTexture,
+	kNullCmdEndModifyTexture,
+	kNullCmdUpdateTextureRegion,
+	kNullCmdBeginModifyVertexBuffer,
+	kNullCmdEndModifyVertexBuffer,
+	kNullCmdUpdateCompressedTexture,
+	kNullCmdCount
+};
+
+// One recorded RenderAPI call. Times are in nanoseconds; startNs is relative to the creation
+// of the null device. bytes is the amount of data the call consumed or handed out.
+struct NullCommand
+{
+	int type;				// NullCommandType
+	int bytes;
+	unsigned long long startNs;
+	unsigned long long durationNs;
+};
+
+// Running totals per command type since the last clear; these don't wrap like the log does.
+struct NullCommandTotals
+{
+	unsigned long long count;
+	unsigned long long bytes;
+	unsigned long long durationNs;
+};
+
+
+// The log keeps the most recent kNullCommandLogCapacity commands.
+enum { kNullCommandLogCapacity = 65536 };
+
+// Copy up to maxCount of the most recent commands, oldest first. Returns the number copied.
+// Can be called from any thread.
+int GetNullCommandLog(NullCommand* outCommands, int maxCount);
+// Fill kNullCmdCount entries.
+void GetNullCommandTotals(NullCommandTotals* outTotals);
+void ClearNullCommandLog();
+
+// There's no device to ask how big a vertex buffer is, so buffers have to be registered
+// with their size before BeginModifyVertexBuffer can hand out memory for them.
+// A size of zero removes the registration.
+void RegisterNullVertexBuffer(void* bufferHandle, size_t bufferSize);
@@ -1,5 +1,10 @@
 #include "RenderAPI.h"
 #include "PlatformBase.h"
+#include "DebugMessages.h"
+#include "FrameRetireQueue.h"
+#include "GLUploadThread.h"
+#include "MemoryStats.h"
+#include "ShaderCache.h"
 
 // OpenGL Core profile (desktop) or OpenGL ES (mobile) implementation of RenderAPI.
 // Supports several flavors: Core, ES2, ES3
@@ -9,22 +14,21 @@
 
 
 #include <assert.h>
+#include <chrono>
+#include <string.h>
+#include <vector>
 #if UNITY_IOS || UNITY_TVOS
-#	include <OpenGLES/ES2/gl.h>
+#	include <OpenGLES/ES3/gl.h>
 #elif UNITY_ANDROID || UNITY_WEBGL
-#	include <GLES2/gl2.h>
+// ES3 headers are a superset of ES2 ones; ES3-only entry points are only called on ES3 contexts.
+#	include <GLES3/gl3.h>
 #elif UNITY_OSX
 #	include <OpenGL/gl3.h>
-#elif UNITY_WIN
-// On Windows, use gl3w to initialize and load OpenGL Core functions. In principle any other
-// library (like GLEW, GLFW etc.) can be used; here we use gl3w since it's simple and
-// straightforward.
-#	include "gl3w/gl3w.h"
-#elif UNITY_LINUX
-#	define GL_GLEXT_PROTOTYPES
-#	include <GL/gl.h>
+#elif UNITY_WIN || UNITY_LINUX
+// Only the functions the plugin calls, resolved when first called; see GLLoader.h
+#	include "GLLoader.h"
 #elif UNITY_EMBEDDED_LINUX
-#	include <GLES2/gl2.h>
+#	include <GLES3/gl3.h>
 #if SUPPORT_OPENGL_CORE
 #	define GL_GLEXT_PROTOTYPES
 #	include <GL/gl.h>
@@ -34,6 +38,110 @@
 #endif
 
 
+// ARB_multi_draw_indirect and KHR_debug (core in GL 4.3), ARB_buffer_storage (GL 4.4) and
+// ARB_direct_state_access (GL 4.5) are not available at all on macOS; where they can exist, their
+// entry points are fetched at runtime once the context reports them, instead of through the loader's
+// table, which asserts on functions the driver lacks.
+#if SUPPORT_GL_LOADER
+#	define SUPPORT_GL_RUNTIME_ENTRY_POINTS 1
+#	ifndef GL_MAP_PERSISTENT_BIT
+#		define GL_MAP_PERSISTENT_BIT	0x0040
+#		define GL_MAP_COHERENT_BIT		0x0080
+#	endif
+typedef void (APIENTRY* GLBufferStorageFunc)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+typedef void (APIENTRY* GLMultiDrawArraysIndirectFunc)(GLenum mode, const void* indirect, GLsizei drawcount, GLsizei stride);
+typedef void (APIENTRY* GLCreateVertexArraysFunc)(GLsizei n, GLuint* arrays);
+typedef void (APIENTRY* GLEnableVertexArrayAttribFunc)(GLuint vaobj, GLuint index);
+typedef void (APIENTRY* GLVertexArrayAttribFormatFunc)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+typedef void (APIENTRY* GLVertexArrayAttribBindingFunc)(GLuint vaobj, GLuint attribindex, GLuint bindingindex);
+typedef void (APIENTRY* GLVertexArrayVertexBufferFunc)(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+typedef void (APIENTRY* GLVertexArrayBindingDivisorFunc)(GLuint vaobj, GLuint bindingindex, GLuint divisor);
+typedef void (APIENTRY* GLDebugMessageCallbackFunc)(GLDEBUGPROC callback, const void* userParam);
+typedef void (APIENTRY* GLDebugMessageControlFunc)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled);
+typedef void (APIENTRY* GLGetPointervFunc)(GLenum pname, void** params);
+typedef void (APIENTRY* GLObjectLabelFunc)(GLenum identifier, GLuint name, GLsizei length, const GLchar* label);
+typedef void (APIENTRY* GLGetInternalformativFunc)(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint* params);
+
+// The subset of direct state access the plugin uses; all NULL when not supported
+struct GLDirectStateAccess
+{
+	GLCreateVertexArraysFunc createVertexArrays;
+	GLEnableVertexArrayAttribFunc enableVertexArrayAttrib;
+	GLVertexArrayAttribFormatFunc vertexArrayAttribFormat;
+	GLVertexArrayAttribBindingFunc vertexArrayAttribBinding;
+	GLVertexArrayVertexBufferFunc vertexArrayVertexBuffer;
+	GLVertexArrayBindingDivisorFunc vertexArrayBindingDivisor;
+};
+
+// KHR_debug; all NULL when not supported, or when debug messages are compiled out
+struct GLDebugOutput
+{
+	GLDebugMessageCallbackFunc debugMessageCallback;
+	GLDebugMessageControlFunc debugMessageControl;
+	GLGetPointervFunc getPointerv;
+	GLObjectLabelFunc objectLabel;
+};
+#else
+#	define SUPPORT_GL_RUNTIME_ENTRY_POINTS 0
+#endif
+
+// Block compressed formats UpdateCompressedTexture uploads; not in every platform's headers
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#	define GL_COMPRESSED_RGB_S3TC_DXT1_EXT	0x83F0
+#endif
+#ifndef GL_COMPRESSED_RED_RGTC1
+#	define GL_COMPRESSED_RED_RGTC1			0x8DBB
+#endif
+#ifndef GL_ETC1_RGB8_OES
+#	define GL_ETC1_RGB8_OES					0x8D64
+#endif
+#ifndef GL_COMPRESSED_R11_EAC
+#	define GL_COMPRESSED_R11_EAC			0x9270
+#	define GL_COMPRESSED_RGB8_ETC2			0x9274
+#endif
+
+// Initial size of the streaming vertex buffer DrawSimpleTriangles writes into. It grows on its own
+// when a draw does not fit.
+#ifndef PLUGIN_GL_STREAM_BUFFER_SIZE
+#	define PLUGIN_GL_STREAM_BUFFER_SIZE (192 * 1024)
+#endif
+
+
+// A GL object the GPU may still use, deleted once the GPU is past its last use. GL would keep a
+// deleted object's storage alive until then on its own, so this is not needed for correctness: it
+// makes the memory stats count the bytes down when the GPU lets go of them rather than while it
+// still holds them, and moves the deletes out of the draw that replaced the object. Category
+// kMemCategoryCount for objects that weren't counted on their own.
+struct GLRetiredObject
+{
+	enum Type { kBuffer, kFramebuffer, kVertexArray, kProgram, kShader, kQuery };
+
+	Type type;
+	GLuint name;
+	MemoryCategory category;
+	size_t bytes;
+};
+
+
+#if SUPPORT_GL_UPLOAD_THREAD
+// An asynchronous texture upload handed to the upload thread. The render thread fills everything
+// in but done, which the thread sets once it issued the upload.
+struct GLThreadUpload
+{
+	GLuint texture;
+	GLuint buffer;		// pixel unpack buffer with the data, unmapped already
+	int bufferIndex;	// into m_TextureUploadBuffers
+	int width;
+	int height;
+	GLenum format;		// GetTextureUploadFormat of the texture
+	GLsync ready;		// the thread waits for this before reading from buffer
+	GLsync done;
+	UploadTicket ticket;
+	unsigned long long sequence;	// of the upload thread job
+};
+#endif
+
+
 class RenderAPI_OpenGLCoreES : public RenderAPI
 {
 public:
@@ -44,26 +152,208 @@ public:
 
 	virtual bool GetUsesReverseZ() { return false; }
 
+	virtual void BeginRenderEvent();
+	virtual void EndRenderEvent();
+
 	virtual void DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4);
+	virtual void DrawSimpleTrianglesBatch(const SimpleTriangleDraw* draws, int drawCount);
 
 	virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch);
 	virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+	virtual TexturePixelLayout GetTexturePixelLayout(void* textureHandle);
+	virtual UploadTicket EndModifyTextureAsync(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+	virtual UploadTicket PollCompletedUploads();
+	virtual bool WaitForUpload(UploadTicket ticket);
+	virtual void UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data);
+	virtual UploadTicket UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize);
 
 	virtual void* BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize);
 	virtual void EndModifyVertexBuffer(void* bufferHandle);
 
+	virtual void BeginGpuScope(GpuScope scope);
+	virtual void EndGpuScope(GpuScope scope);
+	virtual bool ResolveGpuTimings(GpuScopeTiming outTimings[kGpuScopeCount]);
+
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS && SUPPORT_DEBUG_MESSAGES
+	// Hand a debug message to the callback that was installed before ours
+	void ForwardDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message) const;
+#	endif
+
 private:
 	void CreateResources();
+	void ReleaseResources();
+	void CreateProgram();
+	void CreateBatchProgram();
+	GLuint BuildProgram(const char* cacheName, const char* vertexText, const char* fragmentText, GLuint& outVertexShader, GLuint& outFragmentShader);
+	GLuint LoadProgramBinary(const char* cacheName, unsigned long long key);
+	void SaveProgramBinary(GLuint program, const char* cacheName, unsigned long long key);
+	void ReleaseProgram(GLuint& program, GLuint& vertexShader, GLuint& fragmentShader);
+	void SetSimpleDrawState();
+	void SetupDebugOutput();
+	void ReleaseDebugOutput();
+	void LabelObject(GLenum identifier, GLuint name, const char* label);
+	void SetupVertexArray(GLuint& vertexArray, GLuint& vertexArrayBuffer, bool instanceWorldMatrix);
+	void ReleaseVertexArray(GLuint& vertexArray, GLuint& vertexArrayBuffer);
+	void SetCapability(GLenum cap, bool enable, GLboolean& shadow);
+	void UseProgram(GLuint program);
+	void BindArrayBuffer(GLuint buffer);
+	void BindVertexArray(GLuint vertexArray);
+	void CreateStreamBuffer(size_t regionSize);
+	void ReleaseStreamBuffer();
+	void GrowStreamBuffer(size_t bytes);
+	unsigned char* MapStream(size_t bytes, size_t* outOffset);
+	void UnmapStream();
+	size_t StreamVertices(const void* data, size_t bytes);
+	bool HasMapBufferRange() const;
+	bool HasVertexArrays() const { return m_APIType != kUnityGfxRendererOpenGLES20; }
+	void CreateTimerQueries();
+	void ReleaseTimerQueries();
+	void CalibrateGpuClock();
+	bool HasFenceSync() const { return m_APIType != kUnityGfxRendererOpenGLES20; }
+	UploadTicket FenceUpload();
+	GLenum GetCompressedUploadFormat(TextureBlockFormat format) const;
+	GLenum GetTextureUploadFormat(GLuint texture);
+	void PushPendingUpload(GLsync fence, UploadTicket ticket);
+	void RetireCompletedUploads();
+	bool WaitForPendingUploads(UploadTicket ticket);
+	void RetireOldestUpload();
+	void ReleasePendingUploads();
+	void ReleaseTextureUploadBuffers();
+	void RetireObject(GLRetiredObject::Type type, GLuint name, MemoryCategory category, size_t bytes = 0);
+	void DeleteRetiredObject(const GLRetiredObject& object);
+	void EndRetireFrame();
+	void CollectRetiredObjects(bool waitOldest);
+	void ReleaseRetiredObjects();
+#	if SUPPORT_GL_UPLOAD_THREAD
+	bool StartUploadThread();
+	UploadTicket EndModifyTextureOnThread(void* textureHandle, int textureWidth, int textureHeight);
+	void CollectThreadUploads();
+	void WaitForThreadUploads(UploadTicket ticket);
+#	endif
+
+private:
+	// Texture uploads that were issued but not known to be finished on the GPU yet, oldest first.
+	// Fences signal in submission order, so only the front of the ring ever needs to be checked.
+	enum { kMaxPendingUploads = 8 };
+	struct PendingUpload
+	{
+		GLsync fence;
+		UploadTicket ticket;
+	};
+
+	// GPU timer queries: a begin/end timestamp pair per scope, for each of the last few render
+	// events. Results are only read once the GPU got to them, so there's never a stall.
+	enum { kGpuTimerFrames = 4 };
+
+	// The streaming vertex buffer is split in regions that are filled one after the other. When
+	// persistently mapped, leaving a region puts a fence after the draws that read from it, and
+	// the region is only written again once that fence signaled. Without buffer storage the whole
+	// buffer gets orphaned when the writes wrap around instead.
+	enum { kStreamRegions = 3 };
+
+	// BeginModifyTexture hands out a mapped pixel unpack buffer, and EndModifyTexture uploads from
+	// it, which lets the driver DMA the data instead of copying it out of client memory. Buffers
+	// are used round robin; each gets a fence after its upload and is not mapped again before
+	// that signaled.
+	enum { kTextureUploadBuffers = 3 };
+
+	// Objects are not deleted while the GPU may still use them. What gets retired during a render
+	// event belongs to the current retirement frame, which the end of the event closes with a fence;
+	// the frame's objects go once that fence signaled. Fences sit in a ring as well, one per frame.
+	enum { kRetireFrames = 8 };
+
+	// Shadow of the device state DrawSimpleTriangles sets, to skip redundant calls. Unity changes
+	// state freely outside of plugin events, so the shadow is only trusted between BeginRenderEvent
+	// and EndRenderEvent. What's cached about the plugin's own objects (program uniforms, vertex
+	// array layout) is different: nobody else touches those, so it holds as long as they live.
+	struct StateShadow
+	{
+		bool valid;
+		GLboolean cullFace;
+		GLboolean blend;
+		GLboolean depthTest;
+		GLboolean depthMask;
+		GLenum depthFunc;
+		GLuint program;
+		GLuint arrayBuffer;
+		GLuint drawIndirectBuffer;
+		GLuint vertexArray;
+	};
+	struct TextureUploadBuffer
+	{
+		GLuint buffer;
+		size_t size;
+		GLsync fence;
+	};
 
 private:
 	UnityGfxRenderer m_APIType;
 	GLuint m_VertexShader;
 	GLuint m_FragmentShader;
 	GLuint m_Program;
-	GLuint m_VertexArray;
+	GLuint m_VertexArray;			// layout of the one vertex format, sourcing from the streaming buffer
+	GLuint m_VertexArrayBuffer;		// buffer m_VertexArray was last pointed at
+	GLuint m_BatchVertexShader;
+	GLuint m_BatchFragmentShader;
+	GLuint m_BatchProgram;
+	GLuint m_BatchVertexArray;		// same, plus the world matrix as an instance attribute
+	GLuint m_BatchVertexArrayBuffer;
 	GLuint m_VertexBuffer;
+	size_t m_StreamRegionSize;
+	size_t m_StreamOffset;			// write position; within the current region when persistently mapped
+	int m_StreamRegion;
+	GLsync m_StreamFences[kStreamRegions];
+	unsigned char* m_StreamMapped;	// persistent mapping, NULL when not using buffer storage
+	FrameRetireQueue<GLRetiredObject, kRetireFrames> m_RetireQueue;
+	GLsync m_RetireFences[kRetireFrames];	// fence closing each frame still pending
+	unsigned long long m_RetireFrame;		// frame objects retired now go into
+	unsigned long long m_RetiredFrame;		// newest frame whose fence signaled
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	GLBufferStorageFunc m_BufferStorage;
+	GLMultiDrawArraysIndirectFunc m_MultiDrawArraysIndirect;	// NULL when batches are drawn one by one
+	GLGetInternalformativFunc m_GetInternalformativ;	// NULL without internalformat_query2
+	GLDirectStateAccess m_DSA;
+	GLDebugOutput m_Debug;
+	GLDEBUGPROC m_PrevDebugCallback;	// whoever had the callback before (Unity, in development builds); gets every message as well
+	const void* m_PrevDebugUserParam;
+	bool m_DebugOutputWasEnabled;
+	bool m_DebugOutputSyncWasEnabled;	// when the current render event began
+#	endif
+	StateShadow m_State;
+	float m_WorldMatrix[16];		// value of the program's world matrix uniform
+	bool m_ProgramUniformsSet;
+	bool m_HasProgramBinary;
 	int m_UniformWorldMatrix;
 	int m_UniformProjMatrix;
+	int m_BatchUniformProjMatrix;
+	bool m_BatchUniformsSet;
+	std::vector<unsigned char> m_TextureStaging;	// used instead of upload buffers on ES2 and WebGL
+	std::vector<unsigned char> m_VertexStaging;		// ditto, for vertex buffer modification
+	TextureUploadBuffer m_TextureUploadBuffers[kTextureUploadBuffers];
+	int m_TextureUploadIndex;
+	bool m_TextureUploadMapped;
+	GLuint m_UploadFormatTexture;	// the texture m_UploadFormat was looked up for
+	GLenum m_UploadFormat;
+	PendingUpload m_PendingUploads[kMaxPendingUploads];
+	int m_PendingUploadStart;
+	int m_PendingUploadCount;
+	UploadTicket m_CompletedUploadTicket;
+#	if SUPPORT_GL_UPLOAD_THREAD
+	// With the upload thread on, EndModifyTextureAsync only unmaps the upload buffer and leaves the
+	// upload itself to the thread. Once the thread issued it, the render thread waits for it on the
+	// GPU and it moves over to m_PendingUploads. Each upload buffer is read by at most one of these.
+	GLUploadThread m_UploadThread;
+	bool m_UploadThreadFailed;		// Unity's context can't be shared; don't try again every upload
+	GLThreadUpload m_ThreadUploads[kTextureUploadBuffers];	// oldest first
+	int m_ThreadUploadStart;
+	int m_ThreadUploadCount;
+#	endif
+	bool m_HasTimerQueries;
+	GLuint m_TimerQueries[kGpuTimerFrames][kGpuScopeCount][2];
+	unsigned m_TimerQueriesIssued[kGpuTimerFrames];	// bit per scope that has both timestamps issued
+	int m_TimerFrame;
+	long long m_GpuToCpuClockNs;	// add to a GPU timestamp to get steady_clock time
+	int m_ResolvesSinceCalibration;
 };
 
 
@@ -76,19 +366,20 @@ RenderAPI* CreateRenderAPI_OpenGLCoreES(UnityGfxRenderer apiType)
 enum VertexInputs
 {
 	kVertexInputPosition = 0,
-	kVertexInputColor = 1
+	kVertexInputColor = 1,
+	kVertexInputWorldMatrix = 2,	// batched draws only; a matrix takes four locations
 };
 
 
 // Simple vertex shader source
-#define VERTEX_SHADER_SRC(ver, attr, varying)						\
+#define VERTEX_SHADER_SRC(ver, attr, varying, world)				\
 	ver																\
 	attr " highp vec3 pos;\n"										\
 	attr " lowp vec4 color;\n"										\
 	"\n"															\
 	varying " lowp vec4 ocolor;\n"									\
 	"\n"															\
-	"uniform highp mat4 worldMatrix;\n"								\
+	world " highp mat4 worldMatrix;\n"								\
 	"uniform highp mat4 projMatrix;\n"								\
 	"\n"															\
 	"void main()\n"													\
@@ -97,10 +388,14 @@ enum VertexInputs
 	"	ocolor = color;\n"											\
 	"}\n"															\
 
-static const char* kGlesVProgTextGLES2 = VERTEX_SHADER_SRC("\n", "attribute", "varying");
-static const char* kGlesVProgTextGLES3 = VERTEX_SHADER_SRC("#version 300 es\n", "in", "out");
+static const char* kGlesVProgTextGLES2 = VERTEX_SHADER_SRC("\n", "attribute", "varying", "uniform");
+static const char* kGlesVProgTextGLES3 = VERTEX_SHADER_SRC("#version 300 es\n", "in", "out", "uniform");
 #if SUPPORT_OPENGL_CORE
-static const char* kGlesVProgTextGLCore = VERTEX_SHADER_SRC("#version 150\n", "in", "out");
+static const char* kGlesVProgTextGLCore = VERTEX_SHADER_SRC("#version 150\n", "in", "out", "uniform");
+#endif
+#if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+// Batched draws fetch the world matrix per instance; every draw of the batch starts at its own base instance
+static const char* kGlesVProgTextGLCoreBatch = VERTEX_SHADER_SRC("#version 150\n", "in", "out", "in");
 #endif
 
 #undef VERTEX_SHADER_SRC
@@ -126,187 +421,1699 @@ static const char* kGlesFShaderTextGLCore = FRAGMENT_SHADER_SRC("#version 150\n"
 #undef FRAGMENT_SHADER_SRC
 
 
+#if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+// Core in the given version, or available as the given extension
+static bool HasGLFeature(int coreMajor, int coreMinor, const char* extension)
+{
+	GLint major = 0, minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	if (major > coreMajor || (major == coreMajor && minor >= coreMinor))
+		return true;
+	GLint extensionCount = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+	for (GLint i = 0; i < extensionCount; ++i)
+	{
+		if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), extension) == 0)
+			return true;
+	}
+	return false;
+}
+
+#	define GET_GL_PROC(type, name) (type)GLLoaderGetProcAddress(#name)
+
+static GLBufferStorageFunc GetBufferStorageFunc()
+{
+	if (!HasGLFeature(4, 4, "GL_ARB_buffer_storage"))
+		return NULL;
+	return GET_GL_PROC(GLBufferStorageFunc, glBufferStorage);
+}
+
+// Batches need a base instance per draw as well, to pick their world matrix
+static GLMultiDrawArraysIndirectFunc GetMultiDrawArraysIndirectFunc()
+{
+	if (!HasGLFeature(4, 3, "GL_ARB_multi_draw_indirect") || !HasGLFeature(4, 2, "GL_ARB_base_instance"))
+		return NULL;
+	return GET_GL_PROC(GLMultiDrawArraysIndirectFunc, glMultiDrawArraysIndirect);
+}
+
+// For the format the driver keeps a texture's texels in
+static GLGetInternalformativFunc GetInternalformativFunc()
+{
+	if (!HasGLFeature(4, 3, "GL_ARB_internalformat_query2"))
+		return NULL;
+	return GET_GL_PROC(GLGetInternalformativFunc, glGetInternalformativ);
+}
+
+static GLDirectStateAccess GetDirectStateAccessFuncs()
+{
+	GLDirectStateAccess dsa = {};
+	if (!HasGLFeature(4, 5, "GL_ARB_direct_state_access"))
+		return dsa;
+	dsa.createVertexArrays = GET_GL_PROC(GLCreateVertexArraysFunc, glCreateVertexArrays);
+	dsa.enableVertexArrayAttrib = GET_GL_PROC(GLEnableVertexArrayAttribFunc, glEnableVertexArrayAttrib);
+	dsa.vertexArrayAttribFormat = GET_GL_PROC(GLVertexArrayAttribFormatFunc, glVertexArrayAttribFormat);
+	dsa.vertexArrayAttribBinding = GET_GL_PROC(GLVertexArrayAttribBindingFunc, glVertexArrayAttribBinding);
+	dsa.vertexArrayVertexBuffer = GET_GL_PROC(GLVertexArrayVertexBufferFunc, glVertexArrayVertexBuffer);
+	dsa.vertexArrayBindingDivisor = GET_GL_PROC(GLVertexArrayBindingDivisorFunc, glVertexArrayBindingDivisor);
+	if (!dsa.createVertexArrays || !dsa.enableVertexArrayAttrib || !dsa.vertexArrayAttribFormat || !dsa.vertexArrayAttribBinding || !dsa.vertexArrayVertexBuffer || !dsa.vertexArrayBindingDivisor)
+		dsa = GLDirectStateAccess();
+	return dsa;
+}
+
+#	if SUPPORT_DEBUG_MESSAGES
+static GLDebugOutput GetDebugOutputFuncs()
+{
+	GLDebugOutput debug = {};
+	if (!HasGLFeature(4, 3, "GL_KHR_debug"))
+		return debug;
+	debug.debugMessageCallback = GET_GL_PROC(GLDebugMessageCallbackFunc, glDebugMessageCallback);
+	debug.debugMessageControl = GET_GL_PROC(GLDebugMessageControlFunc, glDebugMessageControl);
+	debug.getPointerv = GET_GL_PROC(GLGetPointervFunc, glGetPointerv);
+	debug.objectLabel = GET_GL_PROC(GLObjectLabelFunc, glObjectLabel);
+	if (!debug.debugMessageCallback || !debug.debugMessageControl || !debug.getPointerv || !debug.objectLabel)
+		debug = GLDebugOutput();
+	return debug;
+}
+#	endif // if SUPPORT_DEBUG_MESSAGES
+
+#	undef GET_GL_PROC
+#endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+
+
 static GLuint CreateShader(GLenum type, const char* sourceText)
 {
 	GLuint ret = glCreateShader(type);
 	glShaderSource(ret, 1, &sourceText, NULL);
 	glCompileShader(ret);
+	MemoryStatsAlloc(kMemBackendOpenGL, kMemCategoryShader, 0);
 	return ret;
 }
 
 
 void RenderAPI_OpenGLCoreES::CreateResources()
 {
-#	if UNITY_WIN && SUPPORT_OPENGL_CORE
+#	if SUPPORT_GL_LOADER
 	if (m_APIType == kUnityGfxRendererOpenGLCore)
-		gl3wInit();
+		GLLoaderReset();
 #	endif
 	// Make sure that there are no GL error flags set before creating resources
 	while (glGetError() != GL_NO_ERROR) {}
 
-	// Create shaders
-	if (m_APIType == kUnityGfxRendererOpenGLES20)
+	// First, so that creating everything else gets checked as well
+	SetupDebugOutput();
+
+	// Program binaries are core in GL 4.1 and ES3; the program itself is created on first use,
+	// see CreateProgram
+	m_HasProgramBinary = false;
+#	if !UNITY_WEBGL
+	if (m_APIType != kUnityGfxRendererOpenGLES20)
+	{
+		GLint major = 0, minor = 0;
+		glGetIntegerv(GL_MAJOR_VERSION, &major);
+		glGetIntegerv(GL_MINOR_VERSION, &minor);
+		GLint formatCount = 0;
+		if (m_APIType != kUnityGfxRendererOpenGLCore || major > 4 || (major == 4 && minor >= 1))
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		m_HasProgramBinary = formatCount > 0;
+	}
+#	endif // if !UNITY_WEBGL
+
+	// Create vertex buffer
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	m_BufferStorage = m_APIType == kUnityGfxRendererOpenGLCore ? GetBufferStorageFunc() : NULL;
+	m_MultiDrawArraysIndirect = m_APIType == kUnityGfxRendererOpenGLCore ? GetMultiDrawArraysIndirectFunc() : NULL;
+	m_DSA = m_APIType == kUnityGfxRendererOpenGLCore ? GetDirectStateAccessFuncs() : GLDirectStateAccess();
+	m_GetInternalformativ = m_APIType == kUnityGfxRendererOpenGLCore ? GetInternalformativFunc() : NULL;
+#	endif
+	// Texture names from before don't mean the same textures anymore
+	m_UploadFormatTexture = 0;
+	// Draws address their vertices by index, so offsets into the buffer have to stay vertex aligned
+	CreateStreamBuffer((PLUGIN_GL_STREAM_BUFFER_SIZE / kStreamRegions) & ~(size_t)15);
+
+	CreateTimerQueries();
+
+	assert(glGetError() == GL_NO_ERROR);
+}
+
+
+// One cache per flavor, so switching between them does not throw the other one away
+static const char* GetProgramCacheName(UnityGfxRenderer apiType)
+{
+	switch (apiType)
 	{
-		m_VertexShader = CreateShader(GL_VERTEX_SHADER, kGlesVProgTextGLES2);
-		m_FragmentShader = CreateShader(GL_FRAGMENT_SHADER, kGlesFShaderTextGLES2);
+	case kUnityGfxRendererOpenGLES20: return "gles2_simple_program";
+	case kUnityGfxRendererOpenGLES30: return "gles3_simple_program";
+	default: return "glcore_simple_program";
 	}
-	else if (m_APIType == kUnityGfxRendererOpenGLES30)
+}
+
+
+// Created on the first draw rather than on device initialization: the device comes up when the
+// plugin gets loaded, before scripts had a chance to set the shader cache directory.
+void RenderAPI_OpenGLCoreES::CreateProgram()
+{
+	const char* vertexText = kGlesVProgTextGLES2;
+	const char* fragmentText = kGlesFShaderTextGLES2;
+	if (m_APIType == kUnityGfxRendererOpenGLES30)
 	{
-		m_VertexShader = CreateShader(GL_VERTEX_SHADER, kGlesVProgTextGLES3);
-		m_FragmentShader = CreateShader(GL_FRAGMENT_SHADER, kGlesFShaderTextGLES3);
+		vertexText = kGlesVProgTextGLES3;
+		fragmentText = kGlesFShaderTextGLES3;
 	}
 #	if SUPPORT_OPENGL_CORE
 	else if (m_APIType == kUnityGfxRendererOpenGLCore)
 	{
-		m_VertexShader = CreateShader(GL_VERTEX_SHADER, kGlesVProgTextGLCore);
-		m_FragmentShader = CreateShader(GL_FRAGMENT_SHADER, kGlesFShaderTextGLCore);
+		vertexText = kGlesVProgTextGLCore;
+		fragmentText = kGlesFShaderTextGLCore;
 	}
 #	endif // if SUPPORT_OPENGL_CORE
 
+	m_Program = BuildProgram(GetProgramCacheName(m_APIType), vertexText, fragmentText, m_VertexShader, m_FragmentShader);
+
+	// Find uniform locations
+	m_UniformWorldMatrix = glGetUniformLocation(m_Program, "worldMatrix");
+	m_UniformProjMatrix = glGetUniformLocation(m_Program, "projMatrix");
+	m_ProgramUniformsSet = false;
+}
+
+
+// Only used with multi-draw-indirect, so GL Core only
+void RenderAPI_OpenGLCoreES::CreateBatchProgram()
+{
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	m_BatchProgram = BuildProgram("glcore_batch_program", kGlesVProgTextGLCoreBatch, kGlesFShaderTextGLCore, m_BatchVertexShader, m_BatchFragmentShader);
+	m_BatchUniformProjMatrix = glGetUniformLocation(m_BatchProgram, "projMatrix");
+	m_BatchUniformsSet = false;
+#	endif
+}
+
+
+// Load the program from the shader cache, or compile and link it from source and store it there.
+// The shaders are only created in the latter case.
+GLuint RenderAPI_OpenGLCoreES::BuildProgram(const char* cacheName, const char* vertexText, const char* fragmentText, GLuint& outVertexShader, GLuint& outFragmentShader)
+{
+	PLUGIN_PROFILE_SCOPE(kProfileCreatePipeline);
+
+	// Binaries are only good for the exact driver that produced them
+	unsigned long long key = kShaderCacheHashSeed;
+	key = HashShaderCacheString(vertexText, key);
+	key = HashShaderCacheString(fragmentText, key);
+	key = HashShaderCacheString((const char*)glGetString(GL_VENDOR), key);
+	key = HashShaderCacheString((const char*)glGetString(GL_RENDERER), key);
+	key = HashShaderCacheString((const char*)glGetString(GL_VERSION), key);
+
+	GLuint program = LoadProgramBinary(cacheName, key);
+	if (program)
+	{
+		LabelObject(GL_PROGRAM, program, cacheName);
+		return program;
+	}
+
+	// Create shaders
+	outVertexShader = CreateShader(GL_VERTEX_SHADER, vertexText);
+	outFragmentShader = CreateShader(GL_FRAGMENT_SHADER, fragmentText);
 
-	// Link shaders into a program and find uniform locations
-	m_Program = glCreateProgram();
-	glBindAttribLocation(m_Program, kVertexInputPosition, "pos");
-	glBindAttribLocation(m_Program, kVertexInputColor, "color");
-	glAttachShader(m_Program, m_VertexShader);
-	glAttachShader(m_Program, m_FragmentShader);
+	// Link shaders into a program
+	program = glCreateProgram();
+	MemoryStatsAlloc(kMemBackendOpenGL, kMemCategoryShader, 0);
+	glBindAttribLocation(program, kVertexInputPosition, "pos");
+	glBindAttribLocation(program, kVertexInputColor, "color");
+	// Only matters where worldMatrix is an attribute
+	glBindAttribLocation(program, kVertexInputWorldMatrix, "worldMatrix");
+	glAttachShader(program, outVertexShader);
+	glAttachShader(program, outFragmentShader);
 #	if SUPPORT_OPENGL_CORE
 	if (m_APIType == kUnityGfxRendererOpenGLCore)
-		glBindFragDataLocation(m_Program, 0, "fragColor");
+		glBindFragDataLocation(program, 0, "fragColor");
 #	endif // if SUPPORT_OPENGL_CORE
-	glLinkProgram(m_Program);
+#	if !UNITY_WEBGL
+	if (m_HasProgramBinary)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#	endif
+	glLinkProgram(program);
 
 	GLint status = 0;
-	glGetProgramiv(m_Program, GL_LINK_STATUS, &status);
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
 	assert(status == GL_TRUE);
 
-	m_UniformWorldMatrix = glGetUniformLocation(m_Program, "worldMatrix");
-	m_UniformProjMatrix = glGetUniformLocation(m_Program, "projMatrix");
+	SaveProgramBinary(program, cacheName, key);
+	LabelObject(GL_PROGRAM, program, cacheName);
+	LabelObject(GL_SHADER, outVertexShader, cacheName);
+	LabelObject(GL_SHADER, outFragmentShader, cacheName);
+	return program;
+}
 
-	// Create vertex buffer
-	glGenBuffers(1, &m_VertexBuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
-	glBufferData(GL_ARRAY_BUFFER, 1024, NULL, GL_STREAM_DRAW);
 
-	assert(glGetError() == GL_NO_ERROR);
+GLuint RenderAPI_OpenGLCoreES::LoadProgramBinary(const char* cacheName, unsigned long long key)
+{
+#	if !UNITY_WEBGL
+	unsigned int format = 0;
+	std::vector<unsigned char> binary;
+	if (!m_HasProgramBinary || !LoadShaderCache(cacheName, key, &format, binary))
+		return 0;
+
+	// Attribute and output locations are part of the binary
+	GLuint program = glCreateProgram();
+	glProgramBinary(program, format, &binary[0], (GLsizei)binary.size());
+	GLint status = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (status == GL_TRUE)
+	{
+		MemoryStatsAlloc(kMemBackendOpenGL, kMemCategoryShader, 0);
+		return program;
+	}
+
+	// Drivers may turn down binaries for reasons the key does not capture; compile from source
+	// and replace the file
+	glDeleteProgram(program);
+	DeleteShaderCache(cacheName);
+	while (glGetError() != GL_NO_ERROR) {}
+#	endif // if !UNITY_WEBGL
+	return 0;
 }
 
 
-RenderAPI_OpenGLCoreES::RenderAPI_OpenGLCoreES(UnityGfxRenderer apiType)
-	: m_APIType(apiType)
+void RenderAPI_OpenGLCoreES::SaveProgramBinary(GLuint program, const char* cacheName, unsigned long long key)
 {
+#	if !UNITY_WEBGL
+	if (!m_HasProgramBinary || !HasShaderCacheDirectory())
+		return;
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+	std::vector<unsigned char> binary(length);
+	GLenum format = 0;
+	glGetProgramBinary(program, length, &length, &format, &binary[0]);
+	if (length > 0)
+		SaveShaderCache(cacheName, key, format, &binary[0], length);
+#	endif // if !UNITY_WEBGL
 }
 
 
-void RenderAPI_OpenGLCoreES::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInterfaces* interfaces)
+void RenderAPI_OpenGLCoreES::ReleaseProgram(GLuint& program, GLuint& vertexShader, GLuint& fragmentShader)
 {
-	if (type == kUnityGfxDeviceEventInitialize)
+	if (program)
+		RetireObject(GLRetiredObject::kProgram, program, kMemCategoryShader);
+	if (vertexShader)
+		RetireObject(GLRetiredObject::kShader, vertexShader, kMemCategoryShader);
+	if (fragmentShader)
+		RetireObject(GLRetiredObject::kShader, fragmentShader, kMemCategoryShader);
+	program = vertexShader = fragmentShader = 0;
+}
+
+
+void RenderAPI_OpenGLCoreES::ReleaseResources()
+{
+#	if SUPPORT_GL_UPLOAD_THREAD
+	// Lets the thread finish what it has, so nothing reads from the upload buffers anymore
+	m_UploadThread.Stop();
+	CollectThreadUploads();
+	m_UploadThreadFailed = false;
+#	endif
+	ReleasePendingUploads();
+	ReleaseTimerQueries();
+
+	ReleaseVertexArray(m_VertexArray, m_VertexArrayBuffer);
+	ReleaseVertexArray(m_BatchVertexArray, m_BatchVertexArrayBuffer);
+	ReleaseStreamBuffer();
+	ReleaseProgram(m_Program, m_VertexShader, m_FragmentShader);
+	ReleaseProgram(m_BatchProgram, m_BatchVertexShader, m_BatchFragmentShader);
+
+	ReleaseTextureUploadBuffers();
+	MemoryStatsResize(kMemBackendOpenGL, kMemCategoryStaging, m_TextureStaging.capacity(), 0);
+	std::vector<unsigned char>().swap(m_TextureStaging);
+	MemoryStatsResize(kMemBackendOpenGL, kMemCategoryStaging, m_VertexStaging.capacity(), 0);
+	std::vector<unsigned char>().swap(m_VertexStaging);
+
+	ReleaseRetiredObjects();
+	ReleaseDebugOutput();
+}
+
+
+#if SUPPORT_GL_RUNTIME_ENTRY_POINTS && SUPPORT_DEBUG_MESSAGES
+static void APIENTRY OnDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam)
+{
+	const RenderAPI_OpenGLCoreES* api = (const RenderAPI_OpenGLCoreES*)userParam;
+	api->ForwardDebugMessage(source, type, id, severity, length, message);
+
+	// Markers and groups are annotations, not findings; pure notifications are mostly noise
+	// (buffer placement info and the like), except for performance hints
+	if (source == GL_DEBUG_SOURCE_APPLICATION || type == GL_DEBUG_TYPE_MARKER || type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP)
+		return;
+	if (severity == GL_DEBUG_SEVERITY_NOTIFICATION && type != GL_DEBUG_TYPE_PERFORMANCE)
+		return;
+
+	DebugMessageType messageType;
+	switch (type)
 	{
-		CreateResources();
+	case GL_DEBUG_TYPE_ERROR: messageType = kDebugMessageError; break;
+	case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: messageType = kDebugMessageDeprecated; break;
+	case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: messageType = kDebugMessageUndefinedBehavior; break;
+	case GL_DEBUG_TYPE_PORTABILITY: messageType = kDebugMessagePortability; break;
+	case GL_DEBUG_TYPE_PERFORMANCE: messageType = kDebugMessagePerformance; break;
+	default: messageType = kDebugMessageOther; break;
 	}
-	else if (type == kUnityGfxDeviceEventShutdown)
+	RecordDebugMessage(messageType, id, message, length);
+}
+#endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS && SUPPORT_DEBUG_MESSAGES
+
+
+// Debug output is per context, and Unity's context is shared with the plugin: whatever callback
+// was installed before keeps getting all messages, and the debug output state is put back on
+// shutdown. Output is only made synchronous during the plugin's render events, so that messages
+// arrive on the thread and inside the plugin scope (see DebugMessages.h) that caused them, while
+// Unity's own GL work is never serialized for it. Without SUPPORT_DEBUG_MESSAGES, none of this is
+// compiled in and Unity's context is left alone.
+void RenderAPI_OpenGLCoreES::SetupDebugOutput()
+{
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS && SUPPORT_DEBUG_MESSAGES
+	m_Debug = m_APIType != kUnityGfxRendererOpenGLES20 ? GetDebugOutputFuncs() : GLDebugOutput();
+	if (!m_Debug.debugMessageCallback)
+		return;
+	void* prevCallback = NULL;
+	void* prevUserParam = NULL;
+	m_Debug.getPointerv(GL_DEBUG_CALLBACK_FUNCTION, &prevCallback);
+	m_Debug.getPointerv(GL_DEBUG_CALLBACK_USER_PARAM, &prevUserParam);
+	m_PrevDebugCallback = (GLDEBUGPROC)prevCallback;
+	m_PrevDebugUserParam = prevUserParam;
+	m_DebugOutputWasEnabled = glIsEnabled(GL_DEBUG_OUTPUT) == GL_TRUE;
+
+	m_Debug.debugMessageCallback(OnDebugMessage, this);
+	glEnable(GL_DEBUG_OUTPUT);
+	// Low severity messages are off by default, and drivers report many performance warnings at
+	// that level. The previous message filter can't be queried, so this stays on after shutdown.
+	m_Debug.debugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_PERFORMANCE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+#	endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS && SUPPORT_DEBUG_MESSAGES
+}
+
+
+void RenderAPI_OpenGLCoreES::ReleaseDebugOutput()
+{
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (!m_Debug.debugMessageCallback)
+		return;
+	m_Debug.debugMessageCallback(m_PrevDebugCallback, m_PrevDebugUserParam);
+	if (!m_DebugOutputWasEnabled)
+		glDisable(GL_DEBUG_OUTPUT);
+	m_Debug = GLDebugOutput();
+	m_PrevDebugCallback = NULL;
+	m_PrevDebugUserParam = NULL;
+#	endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+}
+
+
+#if SUPPORT_GL_RUNTIME_ENTRY_POINTS && SUPPORT_DEBUG_MESSAGES
+void RenderAPI_OpenGLCoreES::ForwardDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message) const
+{
+	if (m_PrevDebugCallback)
+		m_PrevDebugCallback(source, type, id, severity, length, message, m_PrevDebugUserParam);
+}
+#endif
+
+
+// Names show up in debug messages and in GPU debuggers. GL names that were only generated get
+// their object on first bind, so label after that.
+void RenderAPI_OpenGLCoreES::LabelObject(GLenum identifier, GLuint name, const char* label)
+{
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (m_Debug.objectLabel && name)
+		m_Debug.objectLabel(identifier, name, -1, label);
+#	endif
+}
+
+
+void RenderAPI_OpenGLCoreES::ReleaseTextureUploadBuffers()
+{
+	for (int i = 0; i < kTextureUploadBuffers; ++i)
 	{
-		//@TODO: release resources
+		TextureUploadBuffer& upload = m_TextureUploadBuffers[i];
+		if (upload.fence)
+			glDeleteSync(upload.fence);
+		if (upload.buffer)
+			RetireObject(GLRetiredObject::kBuffer, upload.buffer, kMemCategoryStaging, upload.size);
+		upload.buffer = 0;
+		upload.size = 0;
+		upload.fence = NULL;
 	}
+	m_TextureUploadIndex = 0;
+	m_TextureUploadMapped = false;
 }
 
 
-void RenderAPI_OpenGLCoreES::DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4)
+void RenderAPI_OpenGLCoreES::CreateStreamBuffer(size_t regionSize)
 {
-	// Set basic render state
-	glDisable(GL_CULL_FACE);
-	glDisable(GL_BLEND);
-	glDepthFunc(GL_LEQUAL);
-	glEnable(GL_DEPTH_TEST);
-	glDepthMask(GL_FALSE);
-
-	// Tweak the projection matrix a bit to make it match what identity projection would do in D3D case.
-	float projectionMatrix[16] = {
-		1,0,0,0,
-		0,1,0,0,
-		0,0,2,0,
-		0,0,-1,1,
-	};
+	m_StreamRegionSize = regionSize;
+	m_StreamOffset = 0;
+	m_StreamRegion = 0;
+	for (int i = 0; i < kStreamRegions; ++i)
+		m_StreamFences[i] = NULL;
+	m_StreamMapped = NULL;
 
-	// Setup shader program to use, and the matrices
-	glUseProgram(m_Program);
-	glUniformMatrix4fv(m_UniformWorldMatrix, 1, GL_FALSE, worldMatrix);
-	glUniformMatrix4fv(m_UniformProjMatrix, 1, GL_FALSE, projectionMatrix);
+	const size_t size = regionSize * kStreamRegions;
+	glGenBuffers(1, &m_VertexBuffer);
+	BindArrayBuffer(m_VertexBuffer);
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (m_BufferStorage)
+	{
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		m_BufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+		m_StreamMapped = (unsigned char*)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+		if (!m_StreamMapped)
+		{
+			// Storage is immutable; start over with a regular buffer, and don't try again
+			glDeleteBuffers(1, &m_VertexBuffer);
+			glGenBuffers(1, &m_VertexBuffer);
+			m_State.arrayBuffer = ~0u;
+			BindArrayBuffer(m_VertexBuffer);
+			m_BufferStorage = NULL;
+		}
+	}
+#	endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (!m_StreamMapped)
+		glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
+	MemoryStatsAlloc(kMemBackendOpenGL, kMemCategoryBuffer, size);
+	LabelObject(GL_BUFFER, m_VertexBuffer, "RenderingPlugin vertex stream");
+}
 
-	// Core profile needs VAOs, setup one
-#	if SUPPORT_OPENGL_CORE
-	if (m_APIType == kUnityGfxRendererOpenGLCore)
+
+void RenderAPI_OpenGLCoreES::ReleaseStreamBuffer()
+{
+	if (!m_VertexBuffer)
+		return;
+	// Unmapping while the GPU still reads is fine, and so would deleting be: GL keeps the storage
+	// alive until the GPU is done with it
+	if (m_StreamMapped)
 	{
-		glGenVertexArrays(1, &m_VertexArray);
-		glBindVertexArray(m_VertexArray);
+		BindArrayBuffer(m_VertexBuffer);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		m_StreamMapped = NULL;
 	}
-#	endif // if SUPPORT_OPENGL_CORE
+	for (int i = 0; i < kStreamRegions; ++i)
+	{
+		if (m_StreamFences[i])
+			glDeleteSync(m_StreamFences[i]);
+		m_StreamFences[i] = NULL;
+	}
+	RetireObject(GLRetiredObject::kBuffer, m_VertexBuffer, kMemCategoryBuffer, m_StreamRegionSize * kStreamRegions);
+	m_VertexBuffer = 0;
+}
 
-	// Bind a vertex buffer, and update data in it
-	const int kVertexSize = 12 + 4;
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-	glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, kVertexSize * triangleCount * 3, verticesFloat3Byte4);
 
-	// Setup vertex layout
-	glEnableVertexAttribArray(kVertexInputPosition);
-	glVertexAttribPointer(kVertexInputPosition, 3, GL_FLOAT, GL_FALSE, kVertexSize, (char*)NULL + 0);
-	glEnableVertexAttribArray(kVertexInputColor);
-	glVertexAttribPointer(kVertexInputColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, kVertexSize, (char*)NULL + 12);
+bool RenderAPI_OpenGLCoreES::HasMapBufferRange() const
+{
+#	if UNITY_WEBGL
+	// WebGL 2 has no buffer mapping; Emscripten only emulates it with extra copies
+	return false;
+#	else
+	return m_APIType != kUnityGfxRendererOpenGLES20;
+#	endif
+}
 
-	// Draw
-	glDrawArrays(GL_TRIANGLES, 0, triangleCount * 3);
 
-	// Cleanup VAO
-#	if SUPPORT_OPENGL_CORE
-	if (m_APIType == kUnityGfxRendererOpenGLCore)
+static void WaitForFence(GLsync& fence)
+{
+	if (!fence)
+		return;
+	const GLuint64 kWaitTimeoutNs = 1000000; // 1ms, retried until the fence signals
+	GLenum result;
+	do
+		result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kWaitTimeoutNs);
+	while (result == GL_TIMEOUT_EXPIRED);
+	glDeleteSync(fence);
+	fence = NULL;
+}
+
+
+// Without fences there's no telling when the GPU is done, but GL keeps whatever it still uses
+// alive on its own; objects go right away then
+void RenderAPI_OpenGLCoreES::RetireObject(GLRetiredObject::Type type, GLuint name, MemoryCategory category, size_t bytes)
+{
+	GLRetiredObject object = { type, name, category, bytes };
+	if (!HasFenceSync())
+		DeleteRetiredObject(object);
+	else
+		m_RetireQueue.Push(m_RetireFrame, object);
+}
+
+
+void RenderAPI_OpenGLCoreES::DeleteRetiredObject(const GLRetiredObject& object)
+{
+	switch (object.type)
 	{
-		glDeleteVertexArrays(1, &m_VertexArray);
+	case GLRetiredObject::kBuffer:
+		glDeleteBuffers(1, &object.name);
+		// Deleting a bound buffer unbinds it
+		if (m_State.arrayBuffer == object.name)
+			m_State.arrayBuffer = 0;
+		if (m_State.drawIndirectBuffer == object.name)
+			m_State.drawIndirectBuffer = 0;
+		break;
+	case GLRetiredObject::kFramebuffer:
+		glDeleteFramebuffers(1, &object.name);
+		break;
+	case GLRetiredObject::kVertexArray:
+		glDeleteVertexArrays(1, &object.name);
+		if (m_State.vertexArray == object.name)
+			m_State.vertexArray = 0;
+		break;
+	case GLRetiredObject::kProgram:
+		glDeleteProgram(object.name);
+		break;
+	case GLRetiredObject::kShader:
+		glDeleteShader(object.name);
+		break;
+	case GLRetiredObject::kQuery:
+		glDeleteQueries(1, &object.name);
+		break;
 	}
-#	endif
+	if (object.category != kMemCategoryCount)
+		MemoryStatsFree(kMemBackendOpenGL, object.category, object.bytes);
 }
 
 
-void* RenderAPI_OpenGLCoreES::BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch)
+// The end of a render event closes the frame, when anything was retired into it
+void RenderAPI_OpenGLCoreES::EndRetireFrame()
 {
-	const int rowPitch = textureWidth * 4;
-	// Just allocate a system memory buffer here for simplicity
-	unsigned char* data = new unsigned char[rowPitch * textureHeight];
-	*outRowPitch = rowPitch;
-	return data;
+	CollectRetiredObjects(false);
+	if (!m_RetireQueue.HasFrame(m_RetireFrame))
+		return;
+	// A fence ring slot is only free once its frame is done; only a GPU many events behind fills them all
+	if (m_RetireFrame - m_RetiredFrame >= kRetireFrames)
+		CollectRetiredObjects(true);
+	m_RetireFences[m_RetireFrame % kRetireFrames] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	++m_RetireFrame;
 }
 
 
-void RenderAPI_OpenGLCoreES::EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
+// Delete the objects of every frame whose fence signaled. Fences signal in order, so checking stops
+// at the first one that didn't; with waitOldest, the oldest one gets waited for.
+void RenderAPI_OpenGLCoreES::CollectRetiredObjects(bool waitOldest)
 {
-	GLuint gltex = (GLuint)(size_t)(textureHandle);
-	// Update texture data, and free the memory buffer
-	glBindTexture(GL_TEXTURE_2D, gltex);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, textureWidth, textureHeight, GL_RGBA, GL_UNSIGNED_BYTE, dataPtr);
-	delete[](unsigned char*)dataPtr;
+	while (m_RetiredFrame + 1 < m_RetireFrame)
+	{
+		GLsync& fence = m_RetireFences[(m_RetiredFrame + 1) % kRetireFrames];
+		if (waitOldest)
+		{
+			WaitForFence(fence);
+			waitOldest = false;
+		}
+		else
+		{
+			// Zero timeout: only checks the fence status, never blocks
+			const GLenum result = glClientWaitSync(fence, 0, 0);
+			if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+				break;
+			glDeleteSync(fence);
+			fence = NULL;
+		}
+		++m_RetiredFrame;
+	}
+
+	struct Delete
+	{
+		RenderAPI_OpenGLCoreES* api;
+		void operator()(const GLRetiredObject& object) const { api->DeleteRetiredObject(object); }
+	};
+	Delete deleteObject = { this };
+	m_RetireQueue.Retire(m_RetiredFrame, deleteObject);
 }
 
-void* RenderAPI_OpenGLCoreES::BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize)
+
+// Device is going away: everything goes now, done or not
+void RenderAPI_OpenGLCoreES::ReleaseRetiredObjects()
 {
-#	if SUPPORT_OPENGL_ES
-	return 0;
-#	else
-	glBindBuffer(GL_ARRAY_BUFFER, (GLuint)(size_t)bufferHandle);
-	GLint size = 0;
-	glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
-	*outBufferSize = size;
-	void* mapped = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-	return mapped;
-#	endif
+	for (unsigned long long frame = m_RetiredFrame + 1; frame < m_RetireFrame; ++frame)
+	{
+		GLsync& fence = m_RetireFences[frame % kRetireFrames];
+		glDeleteSync(fence);
+		fence = NULL;
+	}
+	// Counts the current frame as done, and starts a new one
+	m_RetiredFrame = m_RetireFrame++;
+	CollectRetiredObjects(false);
+	assert(m_RetireQueue.IsEmpty());
 }
 
 
-void RenderAPI_OpenGLCoreES::EndModifyVertexBuffer(void* bufferHandle)
+// A draw that does not fit a region gets a new, bigger buffer; the old one is dropped as is
+void RenderAPI_OpenGLCoreES::GrowStreamBuffer(size_t bytes)
 {
-#	if !SUPPORT_OPENGL_ES
-	glBindBuffer(GL_ARRAY_BUFFER, (GLuint)(size_t)bufferHandle);
+	if (bytes <= m_StreamRegionSize)
+		return;
+	size_t regionSize = m_StreamRegionSize * 2;
+	while (regionSize < bytes)
+		regionSize *= 2;
+	ReleaseStreamBuffer();
+	CreateStreamBuffer(regionSize);
+}
+
+
+// Reserve bytes of the streaming buffer for writing. Returns where to write them, or NULL if the
+// buffer could not be mapped, and their offset in the buffer; finish the writes with UnmapStream.
+// ES2 can't map buffers, see StreamVertices.
+unsigned char* RenderAPI_OpenGLCoreES::MapStream(size_t bytes, size_t* outOffset)
+{
+	GrowStreamBuffer(bytes);
+
+	// The persistent mapping needs no binding at all
+	if (m_StreamMapped)
+	{
+		if (m_StreamOffset + bytes > m_StreamRegionSize)
+		{
+			m_StreamFences[m_StreamRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			m_StreamRegion = (m_StreamRegion + 1) % kStreamRegions;
+			m_StreamOffset = 0;
+			WaitForFence(m_StreamFences[m_StreamRegion]);
+		}
+		*outOffset = m_StreamRegion * m_StreamRegionSize + m_StreamOffset;
+		m_StreamOffset += bytes;
+		return m_StreamMapped + *outOffset;
+	}
+
+	// Append without synchronizing; when out of space orphan the buffer, the driver hands out
+	// fresh storage while the GPU keeps reading the old one.
+	const size_t size = m_StreamRegionSize * kStreamRegions;
+	BindArrayBuffer(m_VertexBuffer);
+	GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+	if (m_StreamOffset + bytes > size)
+	{
+		access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+		m_StreamOffset = 0;
+	}
+	*outOffset = m_StreamOffset;
+	m_StreamOffset += bytes;
+	return (unsigned char*)glMapBufferRange(GL_ARRAY_BUFFER, *outOffset, bytes, access);
+}
+
+
+void RenderAPI_OpenGLCoreES::UnmapStream()
+{
+	if (m_StreamMapped)
+		return;
+	BindArrayBuffer(m_VertexBuffer);
 	glUnmapBuffer(GL_ARRAY_BUFFER);
-#	endif
+}
+
+
+size_t RenderAPI_OpenGLCoreES::StreamVertices(const void* data, size_t bytes)
+{
+	if (HasMapBufferRange())
+	{
+		size_t offset = 0;
+		unsigned char* mapped = MapStream(bytes, &offset);
+		if (mapped)
+		{
+			memcpy(mapped, data, bytes);
+			UnmapStream();
+		}
+		return offset;
+	}
+
+	// ES2: orphan and upload every time
+	GrowStreamBuffer(bytes);
+	BindArrayBuffer(m_VertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, m_StreamRegionSize * kStreamRegions, NULL, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, data);
+	return 0;
+}
+
+
+void RenderAPI_OpenGLCoreES::CreateTimerQueries()
+{
+	// Timestamp queries are core in GL 3.3; ES only has them through EXT_disjoint_timer_query,
+	// which is not used here.
+	m_HasTimerQueries = false;
+#	if SUPPORT_OPENGL_CORE
+	if (m_APIType == kUnityGfxRendererOpenGLCore)
+	{
+		GLint major = 0, minor = 0;
+		glGetIntegerv(GL_MAJOR_VERSION, &major);
+		glGetIntegerv(GL_MINOR_VERSION, &minor);
+		m_HasTimerQueries = major > 3 || (major == 3 && minor >= 3);
+	}
+	if (m_HasTimerQueries)
+	{
+		glGenQueries(kGpuTimerFrames * kGpuScopeCount * 2, &m_TimerQueries[0][0][0]);
+		MemoryStatsAlloc(kMemBackendOpenGL, kMemCategoryQuery, 0);
+	}
+#	endif // if SUPPORT_OPENGL_CORE
+	for (int i = 0; i < kGpuTimerFrames; ++i)
+		m_TimerQueriesIssued[i] = 0;
+	m_TimerFrame = 0;
+	m_ResolvesSinceCalibration = 0;
+	if (m_HasTimerQueries)
+		CalibrateGpuClock();
+}
+
+
+void RenderAPI_OpenGLCoreES::ReleaseTimerQueries()
+{
+#	if SUPPORT_OPENGL_CORE
+	if (m_HasTimerQueries)
+	{
+		// Counted as one object
+		const GLuint* queries = &m_TimerQueries[0][0][0];
+		for (int i = 0; i < kGpuTimerFrames * kGpuScopeCount * 2; ++i)
+			RetireObject(GLRetiredObject::kQuery, queries[i], i == 0 ? kMemCategoryQuery : kMemCategoryCount);
+	}
+#	endif
+	m_HasTimerQueries = false;
+}
+
+
+RenderAPI_OpenGLCoreES::RenderAPI_OpenGLCoreES(UnityGfxRenderer apiType)
+	: m_APIType(apiType)
+	, m_VertexShader(0)
+	, m_FragmentShader(0)
+	, m_Program(0)
+	, m_VertexArray(0)
+	, m_VertexArrayBuffer(0)
+	, m_BatchVertexShader(0)
+	, m_BatchFragmentShader(0)
+	, m_BatchProgram(0)
+	, m_BatchVertexArray(0)
+	, m_BatchVertexArrayBuffer(0)
+	, m_VertexBuffer(0)
+	, m_StreamRegionSize(0)
+	, m_StreamOffset(0)
+	, m_StreamRegion(0)
+	, m_StreamMapped(NULL)
+	, m_RetireFrame(1)
+	, m_RetiredFrame(0)
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	, m_BufferStorage(NULL)
+	, m_MultiDrawArraysIndirect(NULL)
+	, m_GetInternalformativ(NULL)
+	, m_DSA()
+	, m_Debug()
+	, m_PrevDebugCallback(NULL)
+	, m_PrevDebugUserParam(NULL)
+	, m_DebugOutputWasEnabled(false)
+	, m_DebugOutputSyncWasEnabled(false)
+#	endif
+	, m_State()
+	, m_ProgramUniformsSet(false)
+	, m_HasProgramBinary(false)
+	, m_BatchUniformsSet(false)
+	, m_TextureUploadIndex(0)
+	, m_TextureUploadMapped(false)
+	, m_UploadFormatTexture(0)
+	, m_UploadFormat(GL_RGBA)
+	, m_PendingUploadStart(0)
+	, m_PendingUploadCount(0)
+	, m_CompletedUploadTicket(0)
+#	if SUPPORT_GL_UPLOAD_THREAD
+	, m_UploadThreadFailed(false)
+	, m_ThreadUploadStart(0)
+	, m_ThreadUploadCount(0)
+#	endif
+	, m_HasTimerQueries(false)
+	, m_TimerFrame(0)
+	, m_GpuToCpuClockNs(0)
+	, m_ResolvesSinceCalibration(0)
+{
+	for (int i = 0; i < kStreamRegions; ++i)
+		m_StreamFences[i] = NULL;
+	for (int i = 0; i < kRetireFrames; ++i)
+		m_RetireFences[i] = NULL;
+	for (int i = 0; i < kTextureUploadBuffers; ++i)
+	{
+		m_TextureUploadBuffers[i].buffer = 0;
+		m_TextureUploadBuffers[i].size = 0;
+		m_TextureUploadBuffers[i].fence = NULL;
+	}
+}
+
+
+void RenderAPI_OpenGLCoreES::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityInterfaces* interfaces)
+{
+	if (type == kUnityGfxDeviceEventInitialize)
+	{
+		CreateResources();
+	}
+	else if (type == kUnityGfxDeviceEventShutdown)
+	{
+		ReleaseResources();
+	}
+}
+
+
+void RenderAPI_OpenGLCoreES::BeginRenderEvent()
+{
+	// Whatever Unity did since the last event, nothing about the device state is known
+	m_State.valid = true;
+	m_State.cullFace = m_State.blend = m_State.depthTest = m_State.depthMask = 0xFF;
+	m_State.depthFunc = GL_NONE;
+	m_State.program = ~0u;
+	m_State.arrayBuffer = ~0u;
+	m_State.drawIndirectBuffer = ~0u;
+	m_State.vertexArray = ~0u;
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	// Synchronous debug output for the plugin's own calls only, see SetupDebugOutput
+	if (m_Debug.debugMessageCallback)
+	{
+		m_DebugOutputSyncWasEnabled = glIsEnabled(GL_DEBUG_OUTPUT_SYNCHRONOUS) == GL_TRUE;
+		if (!m_DebugOutputSyncWasEnabled)
+			glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	}
+#	endif
+}
+
+
+void RenderAPI_OpenGLCoreES::EndRenderEvent()
+{
+	// Unity binds its own vertex arrays, but don't leave it drawing with ours by accident
+	if (HasVertexArrays() && m_State.vertexArray != 0 && m_State.vertexArray != ~0u)
+		glBindVertexArray(0);
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	// Same for indirect draws
+	if (m_State.drawIndirectBuffer != 0 && m_State.drawIndirectBuffer != ~0u)
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+#	endif
+	m_State.valid = false;
+	EndRetireFrame();
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (m_Debug.debugMessageCallback && !m_DebugOutputSyncWasEnabled)
+		glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+#	endif
+}
+
+
+void RenderAPI_OpenGLCoreES::SetCapability(GLenum cap, bool enable, GLboolean& shadow)
+{
+	if (m_State.valid && shadow == (GLboolean)enable)
+		return;
+	if (enable)
+		glEnable(cap);
+	else
+		glDisable(cap);
+	shadow = enable;
+}
+
+
+void RenderAPI_OpenGLCoreES::UseProgram(GLuint program)
+{
+	if (m_State.valid && m_State.program == program)
+		return;
+	glUseProgram(program);
+	m_State.program = program;
+}
+
+
+void RenderAPI_OpenGLCoreES::BindArrayBuffer(GLuint buffer)
+{
+	if (m_State.valid && m_State.arrayBuffer == buffer)
+		return;
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	m_State.arrayBuffer = buffer;
+}
+
+
+void RenderAPI_OpenGLCoreES::BindVertexArray(GLuint vertexArray)
+{
+	if (m_State.valid && m_State.vertexArray == vertexArray)
+		return;
+	glBindVertexArray(vertexArray);
+	m_State.vertexArray = vertexArray;
+}
+
+
+enum { kSimpleVertexSize = 12 + 4, kWorldMatrixSize = 16 * 4 };
+
+// There's one vertex format so far: float3 position and byte4 color, from the streaming buffer.
+// Draws select their vertices with the first vertex index, so the layout never changes and only
+// has to be pointed at a new buffer when the streaming buffer got replaced. The batch layout adds
+// the world matrix as an instance attribute, read from the start of the same buffer and likewise
+// selected with the base instance.
+void RenderAPI_OpenGLCoreES::SetupVertexArray(GLuint& vertexArray, GLuint& vertexArrayBuffer, bool instanceWorldMatrix)
+{
+	if (vertexArray && vertexArrayBuffer == m_VertexBuffer)
+		return;
+	const char* label = instanceWorldMatrix ? "RenderingPlugin batch vertex array" : "RenderingPlugin vertex array";
+
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (m_DSA.createVertexArrays)
+	{
+		if (!vertexArray)
+		{
+			m_DSA.createVertexArrays(1, &vertexArray);
+			m_DSA.enableVertexArrayAttrib(vertexArray, kVertexInputPosition);
+			m_DSA.vertexArrayAttribFormat(vertexArray, kVertexInputPosition, 3, GL_FLOAT, GL_FALSE, 0);
+			m_DSA.vertexArrayAttribBinding(vertexArray, kVertexInputPosition, 0);
+			m_DSA.enableVertexArrayAttrib(vertexArray, kVertexInputColor);
+			m_DSA.vertexArrayAttribFormat(vertexArray, kVertexInputColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, 12);
+			m_DSA.vertexArrayAttribBinding(vertexArray, kVertexInputColor, 0);
+			if (instanceWorldMatrix)
+			{
+				for (int column = 0; column < 4; ++column)
+				{
+					m_DSA.enableVertexArrayAttrib(vertexArray, kVertexInputWorldMatrix + column);
+					m_DSA.vertexArrayAttribFormat(vertexArray, kVertexInputWorldMatrix + column, 4, GL_FLOAT, GL_FALSE, column * 16);
+					m_DSA.vertexArrayAttribBinding(vertexArray, kVertexInputWorldMatrix + column, 1);
+				}
+				m_DSA.vertexArrayBindingDivisor(vertexArray, 1, 1);
+			}
+			MemoryStatsAlloc(kMemBackendOpenGL, kMemCategoryOther, 0);
+			LabelObject(GL_VERTEX_ARRAY, vertexArray, label);
+		}
+		m_DSA.vertexArrayVertexBuffer(vertexArray, 0, m_VertexBuffer, 0, kSimpleVertexSize);
+		if (instanceWorldMatrix)
+			m_DSA.vertexArrayVertexBuffer(vertexArray, 1, m_VertexBuffer, 0, kWorldMatrixSize);
+		vertexArrayBuffer = m_VertexBuffer;
+		return;
+	}
+#	endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+
+	const bool created = !vertexArray;
+	if (created)
+	{
+		glGenVertexArrays(1, &vertexArray);
+		MemoryStatsAlloc(kMemBackendOpenGL, kMemCategoryOther, 0);
+	}
+	BindVertexArray(vertexArray);
+	if (created)
+		LabelObject(GL_VERTEX_ARRAY, vertexArray, label);
+	BindArrayBuffer(m_VertexBuffer);
+	glEnableVertexAttribArray(kVertexInputPosition);
+	glVertexAttribPointer(kVertexInputPosition, 3, GL_FLOAT, GL_FALSE, kSimpleVertexSize, (char*)NULL + 0);
+	glEnableVertexAttribArray(kVertexInputColor);
+	glVertexAttribPointer(kVertexInputColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, kSimpleVertexSize, (char*)NULL + 12);
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (instanceWorldMatrix)
+	{
+		for (int column = 0; column < 4; ++column)
+		{
+			glEnableVertexAttribArray(kVertexInputWorldMatrix + column);
+			glVertexAttribPointer(kVertexInputWorldMatrix + column, 4, GL_FLOAT, GL_FALSE, kWorldMatrixSize, (char*)NULL + column * 16);
+			glVertexAttribDivisor(kVertexInputWorldMatrix + column, 1);
+		}
+	}
+#	endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	vertexArrayBuffer = m_VertexBuffer;
+}
+
+
+void RenderAPI_OpenGLCoreES::ReleaseVertexArray(GLuint& vertexArray, GLuint& vertexArrayBuffer)
+{
+	if (!vertexArray)
+		return;
+	RetireObject(GLRetiredObject::kVertexArray, vertexArray, kMemCategoryOther);
+	vertexArray = 0;
+	vertexArrayBuffer = 0;
+}
+
+
+// Tweak the projection matrix a bit to make it match what identity projection would do in D3D case.
+static const float kSimpleProjectionMatrix[16] = {
+	1,0,0,0,
+	0,1,0,0,
+	0,0,2,0,
+	0,0,-1,1,
+};
+
+// Basic render state of simple draws
+void RenderAPI_OpenGLCoreES::SetSimpleDrawState()
+{
+	SetCapability(GL_CULL_FACE, false, m_State.cullFace);
+	SetCapability(GL_BLEND, false, m_State.blend);
+	SetCapability(GL_DEPTH_TEST, true, m_State.depthTest);
+	if (!m_State.valid || m_State.depthFunc != GL_LEQUAL)
+	{
+		glDepthFunc(GL_LEQUAL);
+		m_State.depthFunc = GL_LEQUAL;
+	}
+	if (!m_State.valid || m_State.depthMask != GL_FALSE)
+	{
+		glDepthMask(GL_FALSE);
+		m_State.depthMask = GL_FALSE;
+	}
+}
+
+
+void RenderAPI_OpenGLCoreES::DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4)
+{
+	SetSimpleDrawState();
+
+	// Setup shader program to use, and the matrices. Uniforms are program state, so they only
+	// change when the values do.
+	if (!m_Program)
+		CreateProgram();
+	UseProgram(m_Program);
+	if (!m_ProgramUniformsSet)
+	{
+		glUniformMatrix4fv(m_UniformProjMatrix, 1, GL_FALSE, kSimpleProjectionMatrix);
+		glUniformMatrix4fv(m_UniformWorldMatrix, 1, GL_FALSE, worldMatrix);
+		memcpy(m_WorldMatrix, worldMatrix, sizeof(m_WorldMatrix));
+		m_ProgramUniformsSet = true;
+	}
+	else if (memcmp(m_WorldMatrix, worldMatrix, sizeof(m_WorldMatrix)) != 0)
+	{
+		glUniformMatrix4fv(m_UniformWorldMatrix, 1, GL_FALSE, worldMatrix);
+		memcpy(m_WorldMatrix, worldMatrix, sizeof(m_WorldMatrix));
+	}
+
+	// Update the vertex data, then point the vertex layout at it. Without vertex arrays (ES2) the
+	// layout is global state that Unity changes, so it has to be set up every time.
+	const size_t offset = StreamVertices(verticesFloat3Byte4, kSimpleVertexSize * triangleCount * 3);
+	assert(offset % kSimpleVertexSize == 0);
+	if (HasVertexArrays())
+	{
+		SetupVertexArray(m_VertexArray, m_VertexArrayBuffer, false);
+		BindVertexArray(m_VertexArray);
+	}
+	else
+	{
+		BindArrayBuffer(m_VertexBuffer);
+		glEnableVertexAttribArray(kVertexInputPosition);
+		glVertexAttribPointer(kVertexInputPosition, 3, GL_FLOAT, GL_FALSE, kSimpleVertexSize, (char*)NULL + 0);
+		glEnableVertexAttribArray(kVertexInputColor);
+		glVertexAttribPointer(kVertexInputColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, kSimpleVertexSize, (char*)NULL + 12);
+	}
+
+	// Draw
+	glDrawArrays(GL_TRIANGLES, (GLint)(offset / kSimpleVertexSize), triangleCount * 3);
+
+	// Called outside of a render event (tools driving the backend directly): leave no vertex array
+	// of ours bound, as before
+	if (!m_State.valid && HasVertexArrays())
+		glBindVertexArray(0);
+}
+
+
+// With multi-draw-indirect, the whole batch is a single draw call. Vertices, world matrices and
+// the indirect draw commands go into one stretch of the streaming buffer:
+//
+//   | vertices of all draws | padding | world matrices | draw commands |
+//
+// Each command selects its draw's vertices with the first vertex, and its world matrix with the
+// base instance; so nothing but the indirect buffer binding changes from one batch to the next.
+void RenderAPI_OpenGLCoreES::DrawSimpleTrianglesBatch(const SimpleTriangleDraw* draws, int drawCount)
+{
+#	if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (m_MultiDrawArraysIndirect)
+	{
+		if (drawCount <= 0)
+			return;
+
+		struct DrawArraysIndirectCommand
+		{
+			GLuint count;
+			GLuint instanceCount;
+			GLuint first;
+			GLuint baseInstance;
+		};
+
+		size_t vertexBytes = 0;
+		for (int i = 0; i < drawCount; ++i)
+			vertexBytes += kSimpleVertexSize * 3 * draws[i].triangleCount;
+		const size_t matrixBytes = (size_t)drawCount * kWorldMatrixSize;
+		const size_t commandBytes = (size_t)drawCount * sizeof(DrawArraysIndirectCommand);
+
+		// Stream offsets are vertex aligned; matrices need to be matrix aligned
+		size_t offset = 0;
+		unsigned char* mapped = MapStream(vertexBytes + (kWorldMatrixSize - kSimpleVertexSize) + matrixBytes + commandBytes, &offset);
+		if (!mapped)
+			return;
+		assert(offset % kSimpleVertexSize == 0);
+		const size_t matrixOffset = (offset + vertexBytes + kWorldMatrixSize - 1) & ~(size_t)(kWorldMatrixSize - 1);
+		const size_t commandOffset = matrixOffset + matrixBytes;
+		unsigned char* vertexDst = mapped;
+		float* matrixDst = (float*)(mapped + (matrixOffset - offset));
+		DrawArraysIndirectCommand* commandDst = (DrawArraysIndirectCommand*)(mapped + (commandOffset - offset));
+		GLuint first = (GLuint)(offset / kSimpleVertexSize);
+		const GLuint baseInstance = (GLuint)(matrixOffset / kWorldMatrixSize);
+		for (int i = 0; i < drawCount; ++i)
+		{
+			const SimpleTriangleDraw& draw = draws[i];
+			const size_t bytes = kSimpleVertexSize * 3 * draw.triangleCount;
+			memcpy(vertexDst, draw.verticesFloat3Byte4, bytes);
+			vertexDst += bytes;
+			memcpy(matrixDst + i * 16, draw.worldMatrix, kWorldMatrixSize);
+			DrawArraysIndirectCommand command = { (GLuint)draw.triangleCount * 3, 1, first, baseInstance + i };
+			commandDst[i] = command;
+			first += draw.triangleCount * 3;
+		}
+		UnmapStream();
+
+		SetSimpleDrawState();
+		if (!m_BatchProgram)
+			CreateBatchProgram();
+		UseProgram(m_BatchProgram);
+		if (!m_BatchUniformsSet)
+		{
+			glUniformMatrix4fv(m_BatchUniformProjMatrix, 1, GL_FALSE, kSimpleProjectionMatrix);
+			m_BatchUniformsSet = true;
+		}
+		SetupVertexArray(m_BatchVertexArray, m_BatchVertexArrayBuffer, true);
+		BindVertexArray(m_BatchVertexArray);
+		if (!m_State.valid || m_State.drawIndirectBuffer != m_VertexBuffer)
+		{
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_VertexBuffer);
+			m_State.drawIndirectBuffer = m_VertexBuffer;
+		}
+
+		m_MultiDrawArraysIndirect(GL_TRIANGLES, (char*)NULL + commandOffset, drawCount, 0);
+
+		// Outside of a render event, see DrawSimpleTriangles
+		if (!m_State.valid)
+		{
+			glBindVertexArray(0);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		}
+		return;
+	}
+#	endif // if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+
+	// ES, and Core contexts older than 4.3
+	RenderAPI::DrawSimpleTrianglesBatch(draws, drawCount);
+}
+
+
+void* RenderAPI_OpenGLCoreES::BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch)
+{
+	const int rowPitch = textureWidth * 4;
+	const size_t size = (size_t)rowPitch * textureHeight;
+
+	if (!HasMapBufferRange())
+	{
+		// Reuse a single system memory buffer: glTexSubImage2D copies the data out of client memory
+		// before returning, so the buffer is free again as soon as EndModifyTexture is done.
+		const size_t oldCapacity = m_TextureStaging.capacity();
+		m_TextureStaging.resize(size);
+		MemoryStatsResize(kMemBackendOpenGL, kMemCategoryStaging, oldCapacity, m_TextureStaging.capacity());
+		*outRowPitch = rowPitch;
+		return &m_TextureStaging[0];
+	}
+
+	m_TextureUploadIndex = (m_TextureUploadIndex + 1) % kTextureUploadBuffers;
+	TextureUploadBuffer& upload = m_TextureUploadBuffers[m_TextureUploadIndex];
+#	if SUPPORT_GL_UPLOAD_THREAD
+	// The upload thread may still have to read from it; collecting that upload fences the buffer
+	for (int i = 0; i < m_ThreadUploadCount; ++i)
+	{
+		const GLThreadUpload& job = m_ThreadUploads[(m_ThreadUploadStart + i) % kTextureUploadBuffers];
+		if (job.bufferIndex == m_TextureUploadIndex)
+		{
+			WaitForThreadUploads(job.ticket);
+			break;
+		}
+	}
+#	endif
+	WaitForFence(upload.fence);
+	if (!upload.buffer)
+		glGenBuffers(1, &upload.buffer);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload.buffer);
+	if (upload.size < size)
+	{
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+		MemoryStatsResize(kMemBackendOpenGL, kMemCategoryStaging, upload.size, size);
+		if (!upload.size)
+			LabelObject(GL_BUFFER, upload.buffer, "RenderingPlugin texture upload");
+		upload.size = size;
+	}
+	// The fence already made sure the GPU is done with the previous contents
+	void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	m_TextureUploadMapped = mapped != NULL;
+	*outRowPitch = rowPitch;
+	return mapped;
+}
+
+
+void RenderAPI_OpenGLCoreES::EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
+{
+	GLuint gltex = (GLuint)(size_t)(textureHandle);
+	const GLenum format = GetTextureUploadFormat(gltex);
+	// Update texture data
+	glBindTexture(GL_TEXTURE_2D, gltex);
+	if (!m_TextureUploadMapped)
+	{
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, textureWidth, textureHeight, format, GL_UNSIGNED_BYTE, dataPtr);
+		return;
+	}
+
+	// dataPtr is the mapping of the current upload buffer; source offset 0 in it
+	TextureUploadBuffer& upload = m_TextureUploadBuffers[m_TextureUploadIndex];
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload.buffer);
+	glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, textureWidth, textureHeight, format, GL_UNSIGNED_BYTE, NULL);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	upload.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	m_TextureUploadMapped = false;
+}
+
+
+TexturePixelLayout RenderAPI_OpenGLCoreES::GetTexturePixelLayout(void* textureHandle)
+{
+	return GetTextureUploadFormat((GLuint)(size_t)textureHandle) == GL_RGBA ? kTexturePixelRGBA8 : kTexturePixelBGRA8;
+}
+
+
+// GL_BGRA where the driver keeps the texture's texels in that order, which many desktop drivers
+// do for RGBA8; an upload in GL_RGBA then gets swizzled on the CPU. Looked up once per texture;
+// should the name get reused for another format, Core still converts whatever it's given.
+// ES uploads have to name the texture's own format, which is RGBA for the textures Unity creates.
+GLenum RenderAPI_OpenGLCoreES::GetTextureUploadFormat(GLuint texture)
+{
+#	if SUPPORT_OPENGL_CORE
+	if (m_APIType != kUnityGfxRendererOpenGLCore)
+		return GL_RGBA;
+	if (texture == m_UploadFormatTexture)
+		return m_UploadFormat;
+	m_UploadFormatTexture = texture;
+	m_UploadFormat = GL_RGBA;
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	GLint internalFormat = 0;
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+	if (internalFormat != GL_RGBA8 && internalFormat != GL_SRGB8_ALPHA8)
+		return m_UploadFormat;
+	GLint preferred = GL_RGBA;
+#		if SUPPORT_GL_RUNTIME_ENTRY_POINTS
+	if (m_GetInternalformativ)
+		m_GetInternalformativ(GL_TEXTURE_2D, internalFormat, GL_TEXTURE_IMAGE_FORMAT, 1, &preferred);
+	else
+#		endif
+	{
+		// The format reads from the texture are fastest in is the next best hint
+		GLint readFramebuffer = 0;
+		glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+		GLuint framebuffer = 0;
+		glGenFramebuffers(1, &framebuffer);
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+		glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+		if (glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE)
+			glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_FORMAT, &preferred);
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
+		RetireObject(GLRetiredObject::kFramebuffer, framebuffer, kMemCategoryCount);
+	}
+	m_UploadFormat = preferred == GL_BGRA ? GL_BGRA : GL_RGBA;
+	return m_UploadFormat;
+#	else
+	return GL_RGBA;
+#	endif // if SUPPORT_OPENGL_CORE
+}
+
+
+UploadTicket RenderAPI_OpenGLCoreES::EndModifyTextureAsync(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
+{
+#	if SUPPORT_GL_UPLOAD_THREAD
+	if (m_TextureUploadMapped && IsGLUploadThreadEnabled() && StartUploadThread())
+		return EndModifyTextureOnThread(textureHandle, textureWidth, textureHeight);
+	// Tickets complete in order; only matters right after the thread got turned off
+	WaitForThreadUploads(m_LastUploadTicket);
+#	endif
+
+	EndModifyTexture(textureHandle, textureWidth, textureHeight, rowPitch, dataPtr);
+	return FenceUpload();
+}
+
+
+// Ticket for the upload just issued on the render thread, completing when the GPU got past it
+UploadTicket RenderAPI_OpenGLCoreES::FenceUpload()
+{
+	const UploadTicket ticket = ++m_LastUploadTicket;
+	if (!HasFenceSync())
+	{
+		// ES2 has no fences; once glTexSubImage2D returned the driver owns the data, which is the best we can tell.
+		m_CompletedUploadTicket = ticket;
+		return ticket;
+	}
+	PushPendingUpload(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), ticket);
+	return ticket;
+}
+
+
+UploadTicket RenderAPI_OpenGLCoreES::PollCompletedUploads()
+{
+#	if SUPPORT_GL_UPLOAD_THREAD
+	CollectThreadUploads();
+#	endif
+	RetireCompletedUploads();
+	return m_CompletedUploadTicket;
+}
+
+
+bool RenderAPI_OpenGLCoreES::WaitForUpload(UploadTicket ticket)
+{
+#	if SUPPORT_GL_UPLOAD_THREAD
+	WaitForThreadUploads(ticket);
+#	endif
+	return WaitForPendingUploads(ticket);
+}
+
+
+void RenderAPI_OpenGLCoreES::PushPendingUpload(GLsync fence, UploadTicket ticket)
+{
+	if (m_PendingUploadCount == kMaxPendingUploads)
+	{
+		// Only happens when the GPU falls many uploads behind; make room by retiring the oldest one.
+		RetireCompletedUploads();
+		if (m_PendingUploadCount == kMaxPendingUploads)
+			WaitForPendingUploads(m_PendingUploads[m_PendingUploadStart].ticket);
+	}
+
+	PendingUpload& pending = m_PendingUploads[(m_PendingUploadStart + m_PendingUploadCount) % kMaxPendingUploads];
+	pending.fence = fence;
+	pending.ticket = ticket;
+	++m_PendingUploadCount;
+}
+
+
+void RenderAPI_OpenGLCoreES::RetireCompletedUploads()
+{
+	while (m_PendingUploadCount > 0)
+	{
+		// Zero timeout: only checks the fence status, never blocks
+		const GLenum result = glClientWaitSync(m_PendingUploads[m_PendingUploadStart].fence, 0, 0);
+		if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+			break;
+		RetireOldestUpload();
+	}
+}
+
+
+bool RenderAPI_OpenGLCoreES::WaitForPendingUploads(UploadTicket ticket)
+{
+	const GLuint64 kWaitTimeoutNs = 1000000; // 1ms, retried until the fence signals
+	while (m_PendingUploadCount > 0 && m_PendingUploads[m_PendingUploadStart].ticket <= ticket)
+	{
+		// Flush on wait, otherwise the fence might never reach the GPU
+		const GLenum result = glClientWaitSync(m_PendingUploads[m_PendingUploadStart].fence, GL_SYNC_FLUSH_COMMANDS_BIT, kWaitTimeoutNs);
+		if (result == GL_WAIT_FAILED)
+			return false;
+		if (result == GL_TIMEOUT_EXPIRED)
+			continue;
+		RetireOldestUpload();
+	}
+	return ticket <= m_CompletedUploadTicket;
+}
+
+
+void RenderAPI_OpenGLCoreES::RetireOldestUpload()
+{
+	PendingUpload& pending = m_PendingUploads[m_PendingUploadStart];
+	glDeleteSync(pending.fence);
+	m_CompletedUploadTicket = pending.ticket;
+	m_PendingUploadStart = (m_PendingUploadStart + 1) % kMaxPendingUploads;
+	--m_PendingUploadCount;
+}
+
+
+void RenderAPI_OpenGLCoreES::ReleasePendingUploads()
+{
+	// Device is going away; nothing is going to wait on these anymore
+	while (m_PendingUploadCount > 0)
+		RetireOldestUpload();
+}
+
+
+#if SUPPORT_GL_UPLOAD_THREAD
+// Runs on the upload thread, with its context current
+static void UploadTextureOnThread(void* userData)
+{
+	PLUGIN_PROFILE_SCOPE(kProfileUploadThreadTexture);
+	GLThreadUpload& job = *(GLThreadUpload*)userData;
+	glWaitSync(job.ready, 0, GL_TIMEOUT_IGNORED);
+	glDeleteSync(job.ready);
+	job.ready = NULL;
+
+	// Binding again after the wait is what makes the render thread's changes visible here
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, job.buffer);
+	glBindTexture(GL_TEXTURE_2D, job.texture);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, job.width, job.height, job.format, GL_UNSIGNED_BYTE, NULL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	job.done = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	// The render thread waits for the fence on the GPU, where it never shows up without a flush
+	glFlush();
+}
+
+
+bool RenderAPI_OpenGLCoreES::StartUploadThread()
+{
+	if (m_UploadThread.IsRunning())
+		return true;
+	if (m_UploadThreadFailed)
+		return false;
+	GLint major = 0, minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	m_UploadThreadFailed = !m_UploadThread.Start(major, minor, m_APIType == kUnityGfxRendererOpenGLCore);
+	return !m_UploadThreadFailed;
+}
+
+
+UploadTicket RenderAPI_OpenGLCoreES::EndModifyTextureOnThread(void* textureHandle, int textureWidth, int textureHeight)
+{
+	// The mapping belongs to this context, so unmapping stays here; it's the cheap part
+	TextureUploadBuffer& upload = m_TextureUploadBuffers[m_TextureUploadIndex];
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload.buffer);
+	glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	m_TextureUploadMapped = false;
+
+	// BeginModifyTexture collected the last thread upload from this buffer, so there is room
+	assert(m_ThreadUploadCount < kTextureUploadBuffers);
+	GLThreadUpload& job = m_ThreadUploads[(m_ThreadUploadStart + m_ThreadUploadCount) % kTextureUploadBuffers];
+	job.texture = (GLuint)(size_t)(textureHandle);
+	job.buffer = upload.buffer;
+	job.bufferIndex = m_TextureUploadIndex;
+	job.width = textureWidth;
+	job.height = textureHeight;
+	job.format = GetTextureUploadFormat(job.texture);
+	// The unmap, and whatever Unity last did to the texture, have to be done before the thread's upload
+	job.ready = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	glFlush();
+	job.done = NULL;
+	job.ticket = ++m_LastUploadTicket;
+	job.sequence = m_UploadThread.Submit(UploadTextureOnThread, &job);
+	++m_ThreadUploadCount;
+	return job.ticket;
+}
+
+
+// Hand the uploads the thread has issued by now over to m_PendingUploads; never blocks
+void RenderAPI_OpenGLCoreES::CollectThreadUploads()
+{
+	const unsigned long long completed = m_UploadThread.GetCompleted();
+	while (m_ThreadUploadCount > 0 && m_ThreadUploads[m_ThreadUploadStart].sequence <= completed)
+	{
+		GLThreadUpload& job = m_ThreadUploads[m_ThreadUploadStart];
+		// Everything the render thread issues from here on, Unity's draws sampling the texture
+		// included, waits on the GPU until the upload is done
+		glWaitSync(job.done, 0, GL_TIMEOUT_IGNORED);
+		// And the upload buffer is free again once the GPU got past that wait
+		TextureUploadBuffer& upload = m_TextureUploadBuffers[job.bufferIndex];
+		assert(!upload.fence);
+		upload.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_ThreadUploadStart = (m_ThreadUploadStart + 1) % kTextureUploadBuffers;
+		--m_ThreadUploadCount;
+		PushPendingUpload(job.done, job.ticket);
+	}
+}
+
+
+// Block until the thread has issued every upload up to the ticket, then collect them
+void RenderAPI_OpenGLCoreES::WaitForThreadUploads(UploadTicket ticket)
+{
+	for (int i = m_ThreadUploadCount - 1; i >= 0; --i)
+	{
+		const GLThreadUpload& job = m_ThreadUploads[(m_ThreadUploadStart + i) % kTextureUploadBuffers];
+		if (job.ticket <= ticket)
+		{
+			m_UploadThread.WaitForCompleted(job.sequence);
+			break;
+		}
+	}
+	CollectThreadUploads();
+}
+#endif // if SUPPORT_GL_UPLOAD_THREAD
+
+
+void RenderAPI_OpenGLCoreES::UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data)
+{
+	GLuint gltex = (GLuint)(size_t)(textureHandle);
+	glBindTexture(GL_TEXTURE_2D, gltex);
+
+	// ES2 has no GL_UNPACK_ROW_LENGTH, rows have to be tightly packed there
+	const bool hasRowLength = m_APIType != kUnityGfxRendererOpenGLES20;
+	assert(hasRowLength || rowPitch == width * 4);
+	if (hasRowLength)
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, rowPitch / 4);
+	glTexSubImage2D(GL_TEXTURE_2D, mipLevel, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	if (hasRowLength)
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+
+// Format to upload blocks with, for the texture bound to GL_TEXTURE_2D; 0 when it can't take them
+GLenum RenderAPI_OpenGLCoreES::GetCompressedUploadFormat(TextureBlockFormat format) const
+{
+#	if SUPPORT_OPENGL_CORE
+	if (m_APIType == kUnityGfxRendererOpenGLCore)
+	{
+		// Unity picks the sRGB or alpha variant of a format as it sees fit. The blocks are the same,
+		// but the upload has to name the texture's own format, so ask the texture.
+		GLint compressed = GL_FALSE, internalFormat = 0;
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed);
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+		return compressed ? (GLenum)internalFormat : 0;
+	}
+#	endif
+	// No way to ask on ES before 3.1; the texture has to be in the linear variant
+	const bool es2 = m_APIType == kUnityGfxRendererOpenGLES20;
+	switch (format)
+	{
+	case kBlockFormatBC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+	case kBlockFormatBC4: return GL_COMPRESSED_RED_RGTC1;
+	// The encoder only uses the modes ETC2 shares with ETC1, which is what ES2 has
+	case kBlockFormatETC2RGB: return es2 ? GL_ETC1_RGB8_OES : GL_COMPRESSED_RGB8_ETC2;
+	case kBlockFormatEACR11: return es2 ? 0 : GL_COMPRESSED_R11_EAC;
+	default: return 0;
+	}
+}
+
+
+UploadTicket RenderAPI_OpenGLCoreES::UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize)
+{
+	GLuint gltex = (GLuint)(size_t)(textureHandle);
+	glBindTexture(GL_TEXTURE_2D, gltex);
+	const GLenum uploadFormat = GetCompressedUploadFormat(format);
+	if (!uploadFormat)
+		return 0;
+#	if SUPPORT_GL_UPLOAD_THREAD
+	// Tickets complete in order
+	WaitForThreadUploads(m_LastUploadTicket);
+#	endif
+	// Straight from client memory: at an eighth of the RGBA8 size the driver's copy is cheap, and
+	// the data is the driver's once the call returned. OES_compressed_ETC1_RGB8_texture has no
+	// sub-image updates of ETC1 levels, so there the whole level gets specified anew; same size and
+	// format, so the texture stays as Unity made it.
+	if (uploadFormat == GL_ETC1_RGB8_OES)
+		glCompressedTexImage2D(GL_TEXTURE_2D, 0, uploadFormat, textureWidth, textureHeight, 0, (GLsizei)dataSize, data);
+	else
+		glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, textureWidth, textureHeight, uploadFormat, (GLsizei)dataSize, data);
+	return FenceUpload();
+}
+
+
+void* RenderAPI_OpenGLCoreES::BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize)
+{
+	BindArrayBuffer((GLuint)(size_t)bufferHandle);
+	GLint size = 0;
+	glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+	if (size <= 0)
+		return NULL;
+	*outBufferSize = size;
+
+	if (!HasMapBufferRange())
+	{
+		// Written to the buffer with glBufferSubData in EndModifyVertexBuffer
+		const size_t oldCapacity = m_VertexStaging.capacity();
+		m_VertexStaging.resize(size);
+		MemoryStatsResize(kMemBackendOpenGL, kMemCategoryStaging, oldCapacity, m_VertexStaging.capacity());
+		return &m_VertexStaging[0];
+	}
+
+	// The caller rewrites every vertex, so the old contents can be thrown away. Invalidating the whole
+	// buffer lets the driver hand out fresh storage instead of waiting for draws still reading from
+	// it; adding UNSYNCHRONIZED would gain nothing on top, and some drivers then skip the orphaning.
+	return glMapBufferRange(GL_ARRAY_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+}
+
+
+void RenderAPI_OpenGLCoreES::EndModifyVertexBuffer(void* bufferHandle)
+{
+	BindArrayBuffer((GLuint)(size_t)bufferHandle);
+	if (HasMapBufferRange())
+	{
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		return;
+	}
+
+	// Orphan first, so the upload does not have to wait for draws using the old contents
+	GLint usage = GL_DYNAMIC_DRAW;
+	glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_USAGE, &usage);
+	glBufferData(GL_ARRAY_BUFFER, m_VertexStaging.size(), NULL, usage);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, m_VertexStaging.size(), &m_VertexStaging[0]);
+}
+
+
+void RenderAPI_OpenGLCoreES::BeginGpuScope(GpuScope scope)
+{
+#	if SUPPORT_OPENGL_CORE
+	if (m_HasTimerQueries)
+		glQueryCounter(m_TimerQueries[m_TimerFrame][scope][0], GL_TIMESTAMP);
+#	endif
+}
+
+
+void RenderAPI_OpenGLCoreES::EndGpuScope(GpuScope scope)
+{
+#	if SUPPORT_OPENGL_CORE
+	if (m_HasTimerQueries)
+	{
+		glQueryCounter(m_TimerQueries[m_TimerFrame][scope][1], GL_TIMESTAMP);
+		m_TimerQueriesIssued[m_TimerFrame] |= 1u << scope;
+	}
+#	endif
+}
+
+
+void RenderAPI_OpenGLCoreES::CalibrateGpuClock()
+{
+#	if SUPPORT_OPENGL_CORE
+	// GL_TIMESTAMP is the GPU's clock right now, without waiting for queued work
+	GLint64 gpuNow = 0;
+	glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+	const long long cpuNow = (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	m_GpuToCpuClockNs = cpuNow - (long long)gpuNow;
+#	endif
+}
+
+
+bool RenderAPI_OpenGLCoreES::ResolveGpuTimings(GpuScopeTiming outTimings[kGpuScopeCount])
+{
+	if (!m_HasTimerQueries)
+		return false;
+
+#	if SUPPORT_OPENGL_CORE
+	// The clocks drift apart slowly; re-correlate every now and then
+	if (++m_ResolvesSinceCalibration >= 256)
+	{
+		CalibrateGpuClock();
+		m_ResolvesSinceCalibration = 0;
+	}
+
+	// Move on to the next set of queries; the oldest set is about to be reused. Check from oldest to
+	// newest, so the newest available result wins.
+	m_TimerFrame = (m_TimerFrame + 1) % kGpuTimerFrames;
+	for (int i = 0; i < kGpuTimerFrames; ++i)
+	{
+		const int frame = (m_TimerFrame + i) % kGpuTimerFrames;
+		for (int scope = 0; scope < kGpuScopeCount; ++scope)
+		{
+			if (!(m_TimerQueriesIssued[frame] & (1u << scope)))
+				continue;
+			GLuint available = 0;
+			glGetQueryObjectuiv(m_TimerQueries[frame][scope][1], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (available)
+			{
+				GLuint64 begin = 0, end = 0;
+				glGetQueryObjectui64v(m_TimerQueries[frame][scope][0], GL_QUERY_RESULT, &begin);
+				glGetQueryObjectui64v(m_TimerQueries[frame][scope][1], GL_QUERY_RESULT, &end);
+				outTimings[scope].ms = float(double(end - begin) * 1e-6);
+				outTimings[scope].cpuStartNs = (long long)begin + m_GpuToCpuClockNs;
+				m_TimerQueriesIssued[frame] &= ~(1u << scope);
+			}
+		}
+	}
+	// Whatever the GPU did not get to in the set that gets reused next is dropped
+	m_TimerQueriesIssued[m_TimerFrame] = 0;
+#	endif // if SUPPORT_OPENGL_CORE
+	return true;
 }
 
 #endif // #if SUPPORT_OPENGL_UNIFIED
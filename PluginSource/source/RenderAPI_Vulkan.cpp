@@ -1,10 +1,15 @@
 #include "RenderAPI.h"
 #include "PlatformBase.h"
+#include "FrameRetireQueue.h"
+#include "MemoryStats.h"
+#include "MemorySubAllocator.h"
+#include "PluginProfiler.h"
+#include "ShaderCache.h"
 
 #if SUPPORT_VULKAN
 
 #include <string.h>
-#include <map>
+#include <unordered_map>
 #include <vector>
 #include <math.h>
 
@@ -32,12 +37,21 @@
     apply(vkCreateShaderModule); \
     apply(vkDestroyShaderModule); \
     apply(vkCreateGraphicsPipelines); \
+    apply(vkCreatePipelineCache); \
+    apply(vkDestroyPipelineCache); \
+    apply(vkGetPipelineCacheData); \
     apply(vkCmdBindPipeline); \
     apply(vkCmdDraw); \
     apply(vkCmdPushConstants); \
     apply(vkCmdBindVertexBuffers); \
     apply(vkDestroyPipeline); \
-    apply(vkDestroyPipelineLayout);
+    apply(vkDestroyPipelineLayout); \
+    apply(vkGetPhysicalDeviceProperties); \
+    apply(vkCreateQueryPool); \
+    apply(vkDestroyQueryPool); \
+    apply(vkCmdResetQueryPool); \
+    apply(vkCmdWriteTimestamp); \
+    apply(vkGetQueryPoolResults);
     
 #define VULKAN_DEFINE_API_FUNCPTR(func) static PFN_##func func
 VULKAN_DEFINE_API_FUNCPTR(vkGetInstanceProcAddr);
@@ -138,16 +152,72 @@ extern "C" void RenderAPI_Vulkan_OnPluginLoad(IUnityInterfaces* interfaces)
         vulkanInterface->InterceptInitialization(InterceptVulkanInitialization, NULL);
 }
 
+// Device memory comes in big blocks, mapped for as long as they live, that buffers are carved out
+// of; one vkAllocateMemory per block instead of per buffer. Per frame data (vertices to draw,
+// texture staging) doesn't even get a buffer of its own: it goes into a ring at the start of one
+// big buffer, so streaming it takes no Vulkan calls at all.
+static const VkDeviceSize kVulkanMemoryBlockSize = 32 * 1024 * 1024;
+static const VkDeviceSize kVulkanUploadRingSize = 16 * 1024 * 1024;
+
+struct VulkanMemoryBlock
+{
+    VkDeviceMemory memory;
+    void* mapped;
+    VkDeviceSize size;
+    uint32_t memoryTypeIndex;
+    TlsfSubAllocator allocator;
+};
+
 struct VulkanBuffer
 {
     VkBuffer buffer;
+    VkDeviceSize bufferOffset;          // where the data starts in buffer; only per frame data shares one
     VkDeviceMemory deviceMemory;
+    VkDeviceSize memoryOffset;          // where the data starts in deviceMemory
     void* mapped;
     VkDeviceSize sizeInBytes;
     VkDeviceSize deviceMemorySize;
     VkMemoryPropertyFlags deviceMemoryFlags;
+    VkBufferUsageFlags usage;
+    VulkanMemoryBlock* memoryBlock;     // NULL for per frame data, which the upload ring owns
+    unsigned allocation;                // in memoryBlock
+};
+
+// Something the GPU may still use, destroyed once the frame it was last used in is done
+struct VulkanRetiredObject
+{
+    enum Type { kBuffer, kPipeline, kPipelineLayout, kPipelineCache, kQueryPool };
+
+    Type type;
+    VulkanBuffer buffer;                // kBuffer
+    union                               // the others
+    {
+        VkPipeline pipeline;
+        VkPipelineLayout pipelineLayout;
+        VkPipelineCache pipelineCache;
+        VkQueryPool queryPool;
+    };
 };
 
+// Handles of different types are all uint64_t on 32 bit platforms, so no overloads for these
+static VulkanRetiredObject RetiredObject(VulkanRetiredObject::Type type)
+{
+    VulkanRetiredObject object;
+    memset(&object, 0, sizeof(object));
+    object.type = type;
+    return object;
+}
+
+static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static MemoryCategory GetBufferMemoryCategory(VkBufferUsageFlags usage)
+{
+    return (usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT) ? kMemCategoryStaging : kMemCategoryBuffer;
+}
+
 static VkPipelineLayout CreateTrianglePipelineLayout(VkDevice device)
 {
     VkPushConstantRange pushConstantRange;
@@ -435,6 +505,25 @@ static VkPipeline CreateTrianglePipeline(VkDevice device, VkPipelineLayout pipel
     return success ? pipeline : VK_NULL_HANDLE;
 }
 
+// Pipeline cache data starts with a VkPipelineCacheHeaderVersionOne, least significant bytes
+// first. Not every driver checks it before trusting the rest, so data from another GPU or driver
+// is turned away here.
+static bool IsPipelineCacheDataFor(const std::vector<unsigned char>& data, const VkPhysicalDeviceProperties& properties)
+{
+    const size_t headerSize = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+    if (data.size() < headerSize)
+        return false;
+    uint32_t header[4];
+    memcpy(header, &data[0], sizeof(header));
+    return header[0] >= headerSize && header[0] <= data.size()
+        && header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+        && header[2] == properties.vendorID
+        && header[3] == properties.deviceID
+        && memcmp(&data[sizeof(header)], properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+static const char* const kPipelineCacheName = "vulkan_pipeline_cache";
+
 class RenderAPI_Vulkan : public RenderAPI
 {
 public:
@@ -446,28 +535,73 @@ public:
     virtual void DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4);
     virtual void* BeginModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int* outRowPitch);
     virtual void EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+    virtual TexturePixelLayout GetTexturePixelLayout(void* textureHandle);
+    virtual UploadTicket EndModifyTextureAsync(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr);
+    virtual UploadTicket PollCompletedUploads();
+    virtual bool WaitForUpload(UploadTicket ticket);
+    virtual void UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data);
+    virtual UploadTicket UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize);
     virtual void* BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize);
     virtual void EndModifyVertexBuffer(void* bufferHandle);
 
+    virtual void BeginGpuScope(GpuScope scope);
+    virtual void EndGpuScope(GpuScope scope);
+    virtual bool ResolveGpuTimings(GpuScopeTiming outTimings[kGpuScopeCount]);
+
 private:
-    typedef std::vector<VulkanBuffer> VulkanBuffers;
-    typedef std::map<unsigned long long, VulkanBuffers> DeleteQueue;
+    typedef FrameRetireQueue<VulkanRetiredObject> RetireQueue;
+    typedef std::unordered_map<VkRenderPass, VkPipeline> TrianglePipelines;
 
 private:
+    void CacheMemoryProperties();
+    bool AllocateMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags flags, VulkanBuffer* buffer);
+    void FreeMemory(const VulkanBuffer& buffer);
+    void DestroyMemoryBlock(VulkanMemoryBlock* block);
     bool CreateVulkanBuffer(size_t bytes, VulkanBuffer* buffer, VkBufferUsageFlags usage);
+    bool CreateTransientBuffer(size_t bytes, unsigned long long frameNumber, VulkanBuffer* buffer);
+    void FlushMappedBuffer(const VulkanBuffer& buffer);
     void ImmediateDestroyVulkanBuffer(const VulkanBuffer& buffer);
     void SafeDestroy(unsigned long long frameNumber, const VulkanBuffer& buffer);
+    void SafeDestroy(unsigned long long frameNumber, const VulkanRetiredObject& object);
+    void ImmediateDestroy(const VulkanRetiredObject& object);
     void GarbageCollect(bool force = false);
+    VkPipeline GetTrianglePipeline(VkRenderPass renderPass);
+    void CreatePipelineCache();
+    void SavePipelineCache();
+    void CreateTimerQueryPool();
+    void ReadTimerQueries(int slot);
+    bool PrepareTimerSlot(const UnityVulkanRecordingState& recordingState, unsigned long long frameNumber);
+
+    // Timestamp queries: a begin/end pair per scope for each of the last few frames
+    enum { kGpuTimerFrames = 4 };
 
 private:
     IUnityGraphicsVulkan* m_UnityVulkan;
     UnityVulkanInstance m_Instance;
+    VkPhysicalDeviceMemoryProperties m_MemoryProperties;
+    VkDeviceSize m_NonCoherentAtomSize;
+    VkDeviceSize m_TransientAlignment;                      // of per frame data in the upload ring
+    std::vector<VulkanMemoryBlock*> m_MemoryBlocks;
+    VulkanBuffer m_UploadRingBuffer;                        // vertex and transfer source data for the frames in flight
+    RingSubAllocator m_UploadRing;
     VulkanBuffer m_TextureStagingBuffer;
     VulkanBuffer m_VertexStagingBuffer;
-    std::map<unsigned long long, VulkanBuffers> m_DeleteQueue;
+    RetireQueue m_RetireQueue;                              // by the frame the objects were last used in
+    unsigned long long m_LastFrameNumber;                   // Unity's current frame, last seen
     VkPipelineLayout m_TrianglePipelineLayout;
-    VkPipeline m_TrianglePipeline;
+    TrianglePipelines m_TrianglePipelines;                  // by the render pass they were made for
+    VkPipeline m_TrianglePipeline;                          // of the last render pass drawn in
     VkRenderPass m_TrianglePipelineRenderPass;
+    VkPipelineCache m_PipelineCache;                        // loaded from the shader cache directory on first use
+    unsigned long long m_PipelineCacheKey;
+    bool m_PipelineCacheChanged;
+    VkQueryPool m_TimerQueryPool;
+    float m_TimestampPeriodNs;
+    unsigned long long m_TimerSlotFrame[kGpuTimerFrames];  // frame the slot was last reset for
+    unsigned m_TimerSlotBegun[kGpuTimerFrames];            // bit per scope with its begin timestamp written
+    unsigned m_TimerSlotIssued[kGpuTimerFrames];           // bit per scope with both timestamps written
+    float m_TimerResults[kGpuScopeCount];                   // latest read results, until handed out
+    unsigned m_TimerResultsValid;
 };
 
 
@@ -478,11 +612,21 @@ RenderAPI* CreateRenderAPI_Vulkan()
 
 RenderAPI_Vulkan::RenderAPI_Vulkan()
     : m_UnityVulkan(NULL)
+    , m_NonCoherentAtomSize(1)
+    , m_TransientAlignment(16)
+    , m_UploadRingBuffer()
     , m_TextureStagingBuffer()
     , m_VertexStagingBuffer()
+    , m_LastFrameNumber(0)
     , m_TrianglePipelineLayout(VK_NULL_HANDLE)
     , m_TrianglePipeline(VK_NULL_HANDLE)
     , m_TrianglePipelineRenderPass(VK_NULL_HANDLE)
+    , m_PipelineCache(VK_NULL_HANDLE)
+    , m_PipelineCacheKey(0)
+    , m_PipelineCacheChanged(false)
+    , m_TimerQueryPool(VK_NULL_HANDLE)
+    , m_TimestampPeriodNs(0.0f)
+    , m_TimerResultsValid(0)
 {
 }
 
@@ -496,6 +640,7 @@ void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityIn
 
         // Make sure Vulkan API functions are loaded
         LoadVulkanAPI(m_Instance.getInstanceProcAddr, m_Instance.instance);
+        CacheMemoryProperties();
 
         UnityVulkanPluginEventConfig config_1;
         config_1.graphicsQueueAccess = kUnityVulkanGraphicsQueueAccess_DontCare;
@@ -505,22 +650,60 @@ void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityIn
 
         // alternative way to intercept API
         m_UnityVulkan->InterceptVulkanAPI("vkCmdBeginRenderPass", (PFN_vkVoidFunction)Hook_vkCmdBeginRenderPass);
+
+        CreateTimerQueryPool();
         break;
     case kUnityGfxDeviceEventShutdown:
 
         if (m_Instance.device != VK_NULL_HANDLE)
         {
-            GarbageCollect(true);
-            if (m_TrianglePipeline != VK_NULL_HANDLE)
+            // Everything goes the way objects retired at runtime go, and the forced collection
+            // destroys it all. The texture staging buffer is per frame data, so it's in the ring or
+            // in the queue already.
+            m_TextureStagingBuffer = VulkanBuffer();
+            SafeDestroy(m_LastFrameNumber, m_VertexStagingBuffer);
+            m_VertexStagingBuffer = VulkanBuffer();
+            for (TrianglePipelines::iterator it = m_TrianglePipelines.begin(); it != m_TrianglePipelines.end(); ++it)
             {
-                vkDestroyPipeline(m_Instance.device, m_TrianglePipeline, NULL);
-                m_TrianglePipeline = VK_NULL_HANDLE;
+                if (it->second == VK_NULL_HANDLE)
+                    continue;
+                VulkanRetiredObject pipeline = RetiredObject(VulkanRetiredObject::kPipeline);
+                pipeline.pipeline = it->second;
+                SafeDestroy(m_LastFrameNumber, pipeline);
+            }
+            m_TrianglePipelines.clear();
+            m_TrianglePipeline = VK_NULL_HANDLE;
+            if (m_PipelineCache != VK_NULL_HANDLE)
+            {
+                SavePipelineCache();
+                VulkanRetiredObject pipelineCache = RetiredObject(VulkanRetiredObject::kPipelineCache);
+                pipelineCache.pipelineCache = m_PipelineCache;
+                SafeDestroy(m_LastFrameNumber, pipelineCache);
+                m_PipelineCache = VK_NULL_HANDLE;
             }
             if (m_TrianglePipelineLayout != VK_NULL_HANDLE)
             {
-                vkDestroyPipelineLayout(m_Instance.device, m_TrianglePipelineLayout, NULL);
+                VulkanRetiredObject pipelineLayout = RetiredObject(VulkanRetiredObject::kPipelineLayout);
+                pipelineLayout.pipelineLayout = m_TrianglePipelineLayout;
+                SafeDestroy(m_LastFrameNumber, pipelineLayout);
                 m_TrianglePipelineLayout = VK_NULL_HANDLE;
             }
+            if (m_TimerQueryPool != VK_NULL_HANDLE)
+            {
+                VulkanRetiredObject queryPool = RetiredObject(VulkanRetiredObject::kQueryPool);
+                queryPool.queryPool = m_TimerQueryPool;
+                SafeDestroy(m_LastFrameNumber, queryPool);
+                m_TimerQueryPool = VK_NULL_HANDLE;
+            }
+            GarbageCollect(true);
+
+            // The ring's buffer goes last, it has no frame of its own
+            ImmediateDestroyVulkanBuffer(m_UploadRingBuffer);
+            m_UploadRingBuffer = VulkanBuffer();
+            m_UploadRing.Init(0);
+            // Whatever is left in them leaked
+            while (!m_MemoryBlocks.empty())
+                DestroyMemoryBlock(m_MemoryBlocks.back());
         }
 
         m_UnityVulkan = NULL;
@@ -532,6 +715,127 @@ void RenderAPI_Vulkan::ProcessDeviceEvent(UnityGfxDeviceEventType type, IUnityIn
 }
 
 
+void RenderAPI_Vulkan::CacheMemoryProperties()
+{
+    vkGetPhysicalDeviceMemoryProperties(m_Instance.physicalDevice, &m_MemoryProperties);
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(m_Instance.physicalDevice, &properties);
+    m_NonCoherentAtomSize = properties.limits.nonCoherentAtomSize > 0 ? properties.limits.nonCoherentAtomSize : 1;
+    // Copies to images want buffer offsets that are a multiple of the texel block size (at most 16
+    // bytes for the formats the plugin uploads); the optimal alignment is the driver's hint on top
+    m_TransientAlignment = 16;
+    if (properties.limits.optimalBufferCopyOffsetAlignment > m_TransientAlignment)
+        m_TransientAlignment = properties.limits.optimalBufferCopyOffsetAlignment;
+}
+
+bool RenderAPI_Vulkan::AllocateMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags flags, VulkanBuffer* buffer)
+{
+    const int memoryTypeIndex = FindMemoryTypeIndex(m_MemoryProperties, requirements, flags);
+    if (memoryTypeIndex < 0)
+        return false;
+    const VkMemoryPropertyFlags memoryFlags = m_MemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+
+    // Flushing non-coherent memory works in whole atoms, so allocations must not share one
+    VkDeviceSize alignment = requirements.alignment;
+    VkDeviceSize size = requirements.size;
+    if ((memoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && !(memoryFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        alignment = alignment > m_NonCoherentAtomSize ? alignment : m_NonCoherentAtomSize;
+        size = AlignUp(size, m_NonCoherentAtomSize);
+    }
+
+    VulkanMemoryBlock* block = NULL;
+    uint64_t offset = 0;
+    unsigned allocation = kSubAllocationFailed;
+    for (size_t i = 0; i < m_MemoryBlocks.size() && allocation == kSubAllocationFailed; ++i)
+    {
+        if (m_MemoryBlocks[i]->memoryTypeIndex != (uint32_t)memoryTypeIndex)
+            continue;
+        block = m_MemoryBlocks[i];
+        allocation = block->allocator.Allocate(size, alignment, &offset);
+    }
+
+    if (allocation == kSubAllocationFailed)
+    {
+        // Anything bigger than half a block gets a block to itself, with room for the alignment
+        VkMemoryAllocateInfo memoryAllocateInfo;
+        memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memoryAllocateInfo.pNext = NULL;
+        memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+        memoryAllocateInfo.allocationSize = size > kVulkanMemoryBlockSize / 2 ? AlignUp(size + alignment, 64 * 1024) : kVulkanMemoryBlockSize;
+
+        VkDeviceMemory memory;
+        if (vkAllocateMemory(m_Instance.device, &memoryAllocateInfo, NULL, &memory) != VK_SUCCESS)
+            return false;
+        void* mapped = NULL;
+        if ((memoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && vkMapMemory(m_Instance.device, memory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS)
+        {
+            vkFreeMemory(m_Instance.device, memory, NULL);
+            return false;
+        }
+
+        block = new VulkanMemoryBlock();
+        block->memory = memory;
+        block->mapped = mapped;
+        block->size = memoryAllocateInfo.allocationSize;
+        block->memoryTypeIndex = memoryTypeIndex;
+        block->allocator.Init(block->size);
+        m_MemoryBlocks.push_back(block);
+
+        allocation = block->allocator.Allocate(size, alignment, &offset);
+        if (allocation == kSubAllocationFailed)
+        {
+            DestroyMemoryBlock(block);
+            return false;
+        }
+    }
+
+    buffer->deviceMemory = block->memory;
+    buffer->memoryOffset = offset;
+    buffer->mapped = block->mapped ? (char*)block->mapped + offset : NULL;
+    buffer->deviceMemorySize = size;
+    buffer->deviceMemoryFlags = memoryFlags;
+    buffer->memoryBlock = block;
+    buffer->allocation = allocation;
+    return true;
+}
+
+void RenderAPI_Vulkan::FreeMemory(const VulkanBuffer& buffer)
+{
+    VulkanMemoryBlock* block = buffer.memoryBlock;
+    block->allocator.Free(buffer.allocation);
+    if (!block->allocator.IsEmpty())
+        return;
+
+    // Keep one empty block per memory type around, so that a buffer coming and going doesn't
+    // allocate and free a block every time
+    for (size_t i = 0; i < m_MemoryBlocks.size(); ++i)
+    {
+        if (m_MemoryBlocks[i] != block && m_MemoryBlocks[i]->memoryTypeIndex == block->memoryTypeIndex && m_MemoryBlocks[i]->allocator.IsEmpty())
+        {
+            DestroyMemoryBlock(block);
+            return;
+        }
+    }
+}
+
+void RenderAPI_Vulkan::DestroyMemoryBlock(VulkanMemoryBlock* block)
+{
+    if (block->mapped)
+        vkUnmapMemory(m_Instance.device, block->memory);
+    vkFreeMemory(m_Instance.device, block->memory, NULL);
+    for (size_t i = 0; i < m_MemoryBlocks.size(); ++i)
+    {
+        if (m_MemoryBlocks[i] == block)
+        {
+            m_MemoryBlocks.erase(m_MemoryBlocks.begin() + i);
+            break;
+        }
+    }
+    delete block;
+}
+
 bool RenderAPI_Vulkan::CreateVulkanBuffer(size_t sizeInBytes, VulkanBuffer* buffer, VkBufferUsageFlags usage)
 {
     if (sizeInBytes == 0)
@@ -552,89 +856,263 @@ bool RenderAPI_Vulkan::CreateVulkanBuffer(size_t sizeInBytes, VulkanBuffer* buff
     if (vkCreateBuffer(m_Instance.device, &bufferCreateInfo, NULL, &buffer->buffer) != VK_SUCCESS)
         return false;
 
-    VkPhysicalDeviceMemoryProperties physicalDeviceProperties;
-    vkGetPhysicalDeviceMemoryProperties(m_Instance.physicalDevice, &physicalDeviceProperties);
-
     VkMemoryRequirements memoryRequirements;
     vkGetBufferMemoryRequirements(m_Instance.device, buffer->buffer, &memoryRequirements);
 
-    const int memoryTypeIndex = FindMemoryTypeIndex(physicalDeviceProperties, memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
-    if (memoryTypeIndex < 0)
+    if (!AllocateMemory(memoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, buffer))
     {
-        ImmediateDestroyVulkanBuffer(*buffer);
+        vkDestroyBuffer(m_Instance.device, buffer->buffer, NULL);
+        *buffer = VulkanBuffer();
         return false;
     }
 
-    VkMemoryAllocateInfo memoryAllocateInfo;
-    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    memoryAllocateInfo.pNext = NULL;
-    memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
-    memoryAllocateInfo.allocationSize = memoryRequirements.size;
-
-    if (vkAllocateMemory(m_Instance.device, &memoryAllocateInfo, NULL, &buffer->deviceMemory) != VK_SUCCESS)
+    if (vkBindBufferMemory(m_Instance.device, buffer->buffer, buffer->deviceMemory, buffer->memoryOffset) != VK_SUCCESS)
     {
-        ImmediateDestroyVulkanBuffer(*buffer);
+        vkDestroyBuffer(m_Instance.device, buffer->buffer, NULL);
+        FreeMemory(*buffer);
+        *buffer = VulkanBuffer();
         return false;
     }
 
-    if (vkMapMemory(m_Instance.device, buffer->deviceMemory, 0, VK_WHOLE_SIZE, 0, &buffer->mapped) != VK_SUCCESS)
-    {
-        ImmediateDestroyVulkanBuffer(*buffer);
+    buffer->sizeInBytes = sizeInBytes;
+    buffer->usage = usage;
+    MemoryStatsAlloc(kMemBackendVulkan, GetBufferMemoryCategory(usage), (size_t)buffer->deviceMemorySize);
+
+    return true;
+}
+
+// For data the GPU reads during frameNumber only: a range of the upload ring, or when the ring is
+// full, a buffer of its own that goes into the delete queue right away. Usable as vertex buffer
+// and as copy source either way.
+bool RenderAPI_Vulkan::CreateTransientBuffer(size_t sizeInBytes, unsigned long long frameNumber, VulkanBuffer* buffer)
+{
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    if (sizeInBytes == 0)
         return false;
-    }
 
-    if (vkBindBufferMemory(m_Instance.device, buffer->buffer, buffer->deviceMemory, 0) != VK_SUCCESS)
+    if (m_UploadRingBuffer.buffer == VK_NULL_HANDLE)
     {
-        ImmediateDestroyVulkanBuffer(*buffer);
-        return false;
+        if (CreateVulkanBuffer(kVulkanUploadRingSize, &m_UploadRingBuffer, usage))
+            m_UploadRing.Init(kVulkanUploadRingSize);
     }
 
-    buffer->sizeInBytes = sizeInBytes;
-    buffer->deviceMemoryFlags = physicalDeviceProperties.memoryTypes[memoryTypeIndex].propertyFlags;
-    buffer->deviceMemorySize = memoryAllocateInfo.allocationSize;
+    if (m_UploadRingBuffer.buffer != VK_NULL_HANDLE)
+    {
+        // The ring's memory offset is aligned to the atom already; sizes are rounded up to it so
+        // that flushing one range doesn't touch the next
+        const bool coherent = (m_UploadRingBuffer.deviceMemoryFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+        const VkDeviceSize alignment = !coherent && m_NonCoherentAtomSize > m_TransientAlignment ? m_NonCoherentAtomSize : m_TransientAlignment;
+        const VkDeviceSize size = coherent ? sizeInBytes : AlignUp(sizeInBytes, m_NonCoherentAtomSize);
+
+        uint64_t offset = m_UploadRing.Allocate(size, alignment, frameNumber);
+        if (offset == kSubAllocationNoOffset)
+        {
+            GarbageCollect();
+            offset = m_UploadRing.Allocate(size, alignment, frameNumber);
+        }
+        if (offset != kSubAllocationNoOffset)
+        {
+            *buffer = m_UploadRingBuffer;
+            buffer->bufferOffset = offset;
+            buffer->memoryOffset = m_UploadRingBuffer.memoryOffset + offset;
+            buffer->mapped = (char*)m_UploadRingBuffer.mapped + offset;
+            buffer->sizeInBytes = sizeInBytes;
+            buffer->deviceMemorySize = size;
+            buffer->memoryBlock = NULL;
+            buffer->allocation = kSubAllocationFailed;
+            return true;
+        }
+    }
 
+    if (!CreateVulkanBuffer(sizeInBytes, buffer, usage))
+        return false;
+    SafeDestroy(frameNumber, *buffer);
     return true;
 }
 
-void RenderAPI_Vulkan::ImmediateDestroyVulkanBuffer(const VulkanBuffer& buffer)
+void RenderAPI_Vulkan::FlushMappedBuffer(const VulkanBuffer& buffer)
 {
-    if (buffer.buffer != VK_NULL_HANDLE)
-        vkDestroyBuffer(m_Instance.device, buffer.buffer, NULL);
+    if (buffer.deviceMemoryFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        return;
+
+    // Offset and size are multiples of nonCoherentAtomSize for memory like this
+    VkMappedMemoryRange range;
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.pNext = NULL;
+    range.memory = buffer.deviceMemory;
+    range.offset = buffer.memoryOffset;
+    range.size = buffer.deviceMemorySize;
+    vkFlushMappedMemoryRanges(m_Instance.device, 1, &range);
+}
 
-    if (buffer.mapped && buffer.deviceMemory != VK_NULL_HANDLE)
-        vkUnmapMemory(m_Instance.device, buffer.deviceMemory);
+void RenderAPI_Vulkan::ImmediateDestroyVulkanBuffer(const VulkanBuffer& buffer)
+{
+    // Per frame data in the ring goes when the ring retires its frame
+    if (!buffer.memoryBlock)
+        return;
 
-    if (buffer.deviceMemory != VK_NULL_HANDLE)
-        vkFreeMemory(m_Instance.device, buffer.deviceMemory, NULL);
+    vkDestroyBuffer(m_Instance.device, buffer.buffer, NULL);
+    FreeMemory(buffer);
+    MemoryStatsFree(kMemBackendVulkan, GetBufferMemoryCategory(buffer.usage), (size_t)buffer.deviceMemorySize);
 }
 
 
 void RenderAPI_Vulkan::SafeDestroy(unsigned long long frameNumber, const VulkanBuffer& buffer)
 {
-    m_DeleteQueue[frameNumber].push_back(buffer);
+    // Nothing to do for per frame data in the ring, or for a buffer that was never created
+    if (!buffer.memoryBlock)
+        return;
+    VulkanRetiredObject object = RetiredObject(VulkanRetiredObject::kBuffer);
+    object.buffer = buffer;
+    SafeDestroy(frameNumber, object);
+}
+
+void RenderAPI_Vulkan::SafeDestroy(unsigned long long frameNumber, const VulkanRetiredObject& object)
+{
+    m_RetireQueue.Push(frameNumber, object);
+}
+
+void RenderAPI_Vulkan::ImmediateDestroy(const VulkanRetiredObject& object)
+{
+    switch (object.type)
+    {
+    case VulkanRetiredObject::kBuffer:
+        ImmediateDestroyVulkanBuffer(object.buffer);
+        break;
+    case VulkanRetiredObject::kPipeline:
+        vkDestroyPipeline(m_Instance.device, object.pipeline, NULL);
+        MemoryStatsFree(kMemBackendVulkan, kMemCategoryShader, 0);
+        break;
+    case VulkanRetiredObject::kPipelineLayout:
+        vkDestroyPipelineLayout(m_Instance.device, object.pipelineLayout, NULL);
+        MemoryStatsFree(kMemBackendVulkan, kMemCategoryOther, 0);
+        break;
+    case VulkanRetiredObject::kPipelineCache:
+        vkDestroyPipelineCache(m_Instance.device, object.pipelineCache, NULL);
+        MemoryStatsFree(kMemBackendVulkan, kMemCategoryShader, 0);
+        break;
+    case VulkanRetiredObject::kQueryPool:
+        vkDestroyQueryPool(m_Instance.device, object.queryPool, NULL);
+        MemoryStatsFree(kMemBackendVulkan, kMemCategoryQuery, 0);
+        break;
+    }
 }
 
+// Unity's safe frame number says which frames the GPU is done with
 void RenderAPI_Vulkan::GarbageCollect(bool force /*= false*/)
 {
     UnityVulkanRecordingState recordingState;
     if (force)
         recordingState.safeFrameNumber = ~0ull;
     else
+    {
         if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
             return;
+        m_LastFrameNumber = recordingState.currentFrameNumber;
+    }
 
-    DeleteQueue::iterator it = m_DeleteQueue.begin();
-    while (it != m_DeleteQueue.end())
+    if (!m_RetireQueue.IsEmpty())
     {
-        if (it->first <= recordingState.safeFrameNumber)
+        struct Destroy
         {
-            for (size_t i = 0; i < it->second.size(); ++i)
-                ImmediateDestroyVulkanBuffer(it->second[i]);
-            m_DeleteQueue.erase(it++);
-        }
-        else
-            ++it;
+            RenderAPI_Vulkan* api;
+            void operator()(const VulkanRetiredObject& object) const { api->ImmediateDestroy(object); }
+        };
+        Destroy destroy = { this };
+        m_RetireQueue.Retire(recordingState.safeFrameNumber, destroy);
+    }
+    m_UploadRing.Retire(recordingState.safeFrameNumber);
+}
+
+// Pipelines stay around until the device shuts down, one per render pass drawn in: with several
+// cameras, the render pass changes between draws every frame. Unity does not destroy render
+// passes, so keying by them is safe regarding ABA-problem.
+VkPipeline RenderAPI_Vulkan::GetTrianglePipeline(VkRenderPass renderPass)
+{
+    TrianglePipelines::iterator it = m_TrianglePipelines.find(renderPass);
+    if (it != m_TrianglePipelines.end())
+        return it->second;
+
+    PLUGIN_PROFILE_SCOPE(kProfileCreatePipeline);
+    if (m_TrianglePipelineLayout == VK_NULL_HANDLE)
+    {
+        m_TrianglePipelineLayout = CreateTrianglePipelineLayout(m_Instance.device);
+        if (m_TrianglePipelineLayout != VK_NULL_HANDLE)
+            MemoryStatsAlloc(kMemBackendVulkan, kMemCategoryOther, 0);
+    }
+    if (m_PipelineCache == VK_NULL_HANDLE)
+        CreatePipelineCache();
+
+    VkPipeline pipeline = CreateTrianglePipeline(m_Instance.device, m_TrianglePipelineLayout, renderPass, m_PipelineCache);
+    if (pipeline != VK_NULL_HANDLE)
+    {
+        MemoryStatsAlloc(kMemBackendVulkan, kMemCategoryShader, 0);
+        m_PipelineCacheChanged = true;
     }
+    // Failures are remembered too, so that they aren't retried on every draw
+    m_TrianglePipelines[renderPass] = pipeline;
+    return pipeline;
+}
+
+// The pipeline cache is a shader cache file (see ShaderCache.h) whose key covers the GPU and its
+// driver; the data gets its header checked on top before the driver sees it. Without a shader
+// cache directory the cache still saves recompiling across the render passes of this run.
+void RenderAPI_Vulkan::CreatePipelineCache()
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(m_Instance.physicalDevice, &properties);
+    m_PipelineCacheKey = kShaderCacheHashSeed;
+    m_PipelineCacheKey = HashShaderCacheData(&properties.vendorID, sizeof(properties.vendorID), m_PipelineCacheKey);
+    m_PipelineCacheKey = HashShaderCacheData(&properties.deviceID, sizeof(properties.deviceID), m_PipelineCacheKey);
+    m_PipelineCacheKey = HashShaderCacheData(&properties.driverVersion, sizeof(properties.driverVersion), m_PipelineCacheKey);
+    m_PipelineCacheKey = HashShaderCacheData(properties.pipelineCacheUUID, VK_UUID_SIZE, m_PipelineCacheKey);
+
+    std::vector<unsigned char> data;
+    unsigned int format = 0;
+    if (LoadShaderCache(kPipelineCacheName, m_PipelineCacheKey, &format, data) && !IsPipelineCacheDataFor(data, properties))
+    {
+        DeleteShaderCache(kPipelineCacheName);
+        data.clear();
+    }
+
+    VkPipelineCacheCreateInfo createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.pNext = NULL;
+    createInfo.flags = 0;
+    createInfo.initialDataSize = data.size();
+    createInfo.pInitialData = data.empty() ? NULL : &data[0];
+    VkResult result = vkCreatePipelineCache(m_Instance.device, &createInfo, NULL, &m_PipelineCache);
+    if (result != VK_SUCCESS && !data.empty())
+    {
+        // Drivers may turn down data for reasons the key does not capture; start empty and
+        // replace the file
+        DeleteShaderCache(kPipelineCacheName);
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = NULL;
+        result = vkCreatePipelineCache(m_Instance.device, &createInfo, NULL, &m_PipelineCache);
+    }
+    if (result != VK_SUCCESS)
+    {
+        m_PipelineCache = VK_NULL_HANDLE;
+        return;
+    }
+    MemoryStatsAlloc(kMemBackendVulkan, kMemCategoryShader, 0);
+    m_PipelineCacheChanged = false;
+}
+
+// Only at shutdown: reading the data back copies the whole cache
+void RenderAPI_Vulkan::SavePipelineCache()
+{
+    if (!m_PipelineCacheChanged || !HasShaderCacheDirectory())
+        return;
+    size_t size = 0;
+    if (vkGetPipelineCacheData(m_Instance.device, m_PipelineCache, &size, NULL) != VK_SUCCESS || size == 0)
+        return;
+    std::vector<unsigned char> data(size);
+    if (vkGetPipelineCacheData(m_Instance.device, m_PipelineCache, &size, &data[0]) != VK_SUCCESS || size == 0)
+        return;
+    SaveShaderCache(kPipelineCacheName, m_PipelineCacheKey, VK_PIPELINE_CACHE_HEADER_VERSION_ONE, &data[0], size);
+    m_PipelineCacheChanged = false;
 }
 
 void RenderAPI_Vulkan::DrawSimpleTriangles(const float worldMatrix[16], int triangleCount, const void* verticesFloat3Byte4)
@@ -646,41 +1124,25 @@ void RenderAPI_Vulkan::DrawSimpleTriangles(const float worldMatrix[16], int tria
     if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
         return;
 
-    // Unity does not destroy render passes, so this is safe regarding ABA-problem
     if (recordingState.renderPass != m_TrianglePipelineRenderPass)
     {
-        if (m_TrianglePipelineLayout == VK_NULL_HANDLE)
-            m_TrianglePipelineLayout = CreateTrianglePipelineLayout(m_Instance.device);
-
-        m_TrianglePipeline = CreateTrianglePipeline(m_Instance.device, m_TrianglePipelineLayout, recordingState.renderPass, VK_NULL_HANDLE);
-		m_TrianglePipelineRenderPass = recordingState.renderPass;
+        m_TrianglePipeline = GetTrianglePipeline(recordingState.renderPass);
+        m_TrianglePipelineRenderPass = recordingState.renderPass;
     }
 
     if (m_TrianglePipeline != VK_NULL_HANDLE && m_TrianglePipelineLayout != VK_NULL_HANDLE)
     {
         VulkanBuffer buffer;
-        if (!CreateVulkanBuffer(16 * 3 * triangleCount, &buffer, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT))
+        if (!CreateTransientBuffer(16 * 3 * triangleCount, recordingState.currentFrameNumber, &buffer))
             return;
 
         memcpy(buffer.mapped, verticesFloat3Byte4, static_cast<size_t>(buffer.sizeInBytes));
-        if (!(buffer.deviceMemoryFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
-        {
-            VkMappedMemoryRange range;
-            range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-            range.pNext = NULL;
-            range.memory = buffer.deviceMemory;
-            range.offset = 0;
-            range.size = buffer.deviceMemorySize;
-            vkFlushMappedMemoryRanges(m_Instance.device, 1, &range);
-        }
+        FlushMappedBuffer(buffer);
 
-        const VkDeviceSize offset = 0;
-        vkCmdBindVertexBuffers(recordingState.commandBuffer, 0, 1, &buffer.buffer, &offset);
+        vkCmdBindVertexBuffers(recordingState.commandBuffer, 0, 1, &buffer.buffer, &buffer.bufferOffset);
         vkCmdPushConstants(recordingState.commandBuffer, m_TrianglePipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, 64, (const void*)worldMatrix);
         vkCmdBindPipeline(recordingState.commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_TrianglePipeline);
         vkCmdDraw(recordingState.commandBuffer, triangleCount * 3, 1, 0, 0);
-
-        SafeDestroy(recordingState.currentFrameNumber, buffer);
     }
 
     GarbageCollect();
@@ -695,9 +1157,8 @@ void* RenderAPI_Vulkan::BeginModifyTexture(void* textureHandle, int textureWidth
     if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
         return NULL;
 
-    SafeDestroy(recordingState.currentFrameNumber, m_TextureStagingBuffer);
     m_TextureStagingBuffer = VulkanBuffer();
-    if (!CreateVulkanBuffer(stagingBufferSizeRequirements, &m_TextureStagingBuffer, VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
+    if (!CreateTransientBuffer(stagingBufferSizeRequirements, recordingState.currentFrameNumber, &m_TextureStagingBuffer))
         return NULL;
 
     return m_TextureStagingBuffer.mapped;
@@ -705,22 +1166,41 @@ void* RenderAPI_Vulkan::BeginModifyTexture(void* textureHandle, int textureWidth
 
 void RenderAPI_Vulkan::EndModifyTexture(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
 {
+    EndModifyTextureAsync(textureHandle, textureWidth, textureHeight, rowPitch, dataPtr);
+}
+
+TexturePixelLayout RenderAPI_Vulkan::GetTexturePixelLayout(void* textureHandle)
+{
+    // vkCmdCopyBufferToImage copies bytes as they are; swapchain-like BGRA images need BGRA data
+    UnityVulkanImage image;
+    if (!m_UnityVulkan->AccessTexture(textureHandle, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_UNDEFINED,
+        0, 0, kUnityVulkanResourceAccess_ObserveOnly, &image))
+        return kTexturePixelRGBA8;
+    return image.format == VK_FORMAT_B8G8R8A8_UNORM || image.format == VK_FORMAT_B8G8R8A8_SRGB ? kTexturePixelBGRA8 : kTexturePixelRGBA8;
+}
+
+UploadTicket RenderAPI_Vulkan::EndModifyTextureAsync(void* textureHandle, int textureWidth, int textureHeight, int rowPitch, void* dataPtr)
+{
+    if (m_TextureStagingBuffer.buffer == VK_NULL_HANDLE)
+        return 0;
+    FlushMappedBuffer(m_TextureStagingBuffer);
+
     // cannot do resource uploads inside renderpass
     m_UnityVulkan->EnsureOutsideRenderPass();
 
     UnityVulkanImage image;
     if (!m_UnityVulkan->AccessTexture(textureHandle, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
         VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &image))
-        return;
+        return 0;
 
     UnityVulkanRecordingState recordingState;
     if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
-        return;
+        return 0;
 
     VkBufferImageCopy region;
     region.bufferImageHeight = 0;
     region.bufferRowLength = 0;
-    region.bufferOffset = 0;
+    region.bufferOffset = m_TextureStagingBuffer.bufferOffset;
     region.imageOffset.x = 0;
     region.imageOffset.y = 0;
     region.imageOffset.z = 0;
@@ -732,6 +1212,146 @@ void RenderAPI_Vulkan::EndModifyTexture(void* textureHandle, int textureWidth, i
     region.imageSubresource.layerCount = 1;
     region.imageSubresource.mipLevel = 0;
     vkCmdCopyBufferToImage(recordingState.commandBuffer, m_TextureStagingBuffer.buffer, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+    // The copy is recorded into Unity's command buffer for the current frame, so Unity's frame
+    // number doubles as the ticket. Each upload has its own staging range in the upload ring (retired
+    // with the frame), which is what allows several uploads to be in flight.
+    m_LastUploadTicket = recordingState.currentFrameNumber;
+    return m_LastUploadTicket;
+}
+
+UploadTicket RenderAPI_Vulkan::PollCompletedUploads()
+{
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return 0;
+    return recordingState.safeFrameNumber;
+}
+
+bool RenderAPI_Vulkan::WaitForUpload(UploadTicket ticket)
+{
+    // Completion follows Unity's frame retirement; the copy may sit in a command buffer that
+    // has not even been submitted yet, so there is nothing we could block on here.
+    return ticket <= PollCompletedUploads();
+}
+
+void RenderAPI_Vulkan::UpdateTextureRegion(void* textureHandle, int mipLevel, int x, int y, int width, int height, int rowPitch, const void* data)
+{
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+
+    // Tightly packed staging copy of the region, free again once the frame is done on the GPU
+    const size_t packedRowSize = width * 4;
+    VulkanBuffer staging;
+    if (!CreateTransientBuffer(packedRowSize * height, recordingState.currentFrameNumber, &staging))
+        return;
+    for (int row = 0; row < height; ++row)
+        memcpy((char*)staging.mapped + row * packedRowSize, (const char*)data + row * rowPitch, packedRowSize);
+    FlushMappedBuffer(staging);
+
+    // cannot do resource uploads inside renderpass
+    m_UnityVulkan->EnsureOutsideRenderPass();
+
+    UnityVulkanImage image;
+    if (!m_UnityVulkan->AccessTexture(textureHandle, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &image))
+        return;
+
+    // Recording state may have changed after leaving the render pass
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+
+    VkBufferImageCopy region;
+    region.bufferImageHeight = 0;
+    region.bufferRowLength = 0;
+    region.bufferOffset = staging.bufferOffset;
+    region.imageOffset.x = x;
+    region.imageOffset.y = y;
+    region.imageOffset.z = 0;
+    region.imageExtent.width = width;
+    region.imageExtent.height = height;
+    region.imageExtent.depth = 1;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageSubresource.mipLevel = mipLevel;
+    vkCmdCopyBufferToImage(recordingState.commandBuffer, staging.buffer, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+}
+
+// Image formats that take the blocks of a TextureBlockFormat; Unity picks the sRGB or alpha
+// variants as it sees fit, the blocks are the same
+static bool IsBlockFormatOfImage(TextureBlockFormat format, VkFormat imageFormat)
+{
+    switch (format)
+    {
+    case kBlockFormatBC1:
+        return imageFormat == VK_FORMAT_BC1_RGB_UNORM_BLOCK || imageFormat == VK_FORMAT_BC1_RGB_SRGB_BLOCK
+            || imageFormat == VK_FORMAT_BC1_RGBA_UNORM_BLOCK || imageFormat == VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+    case kBlockFormatBC4:
+        return imageFormat == VK_FORMAT_BC4_UNORM_BLOCK;
+    case kBlockFormatETC2RGB:
+        return imageFormat == VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK || imageFormat == VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK;
+    case kBlockFormatEACR11:
+        return imageFormat == VK_FORMAT_EAC_R11_UNORM_BLOCK;
+    default:
+        return false;
+    }
+}
+
+UploadTicket RenderAPI_Vulkan::UpdateCompressedTexture(void* textureHandle, int textureWidth, int textureHeight, TextureBlockFormat format, const void* data, size_t dataSize)
+{
+    // The copy reads as many blocks as the image has, whatever data holds
+    if (dataSize != GetBlockCompressedSize(format, textureWidth, textureHeight))
+        return 0;
+    UnityVulkanImage image;
+    if (!m_UnityVulkan->AccessTexture(textureHandle, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_UNDEFINED,
+        0, 0, kUnityVulkanResourceAccess_ObserveOnly, &image) || !IsBlockFormatOfImage(format, image.format))
+        return 0;
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return 0;
+
+    // The blocks are tightly packed already; the staging copy is free again once the frame is done on the GPU
+    VulkanBuffer staging;
+    if (!CreateTransientBuffer(dataSize, recordingState.currentFrameNumber, &staging))
+        return 0;
+    memcpy(staging.mapped, data, dataSize);
+    FlushMappedBuffer(staging);
+
+    // cannot do resource uploads inside renderpass
+    m_UnityVulkan->EnsureOutsideRenderPass();
+
+    if (!m_UnityVulkan->AccessTexture(textureHandle, UnityVulkanWholeImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, kUnityVulkanResourceAccess_PipelineBarrier, &image))
+        return 0;
+
+    // Recording state may have changed after leaving the render pass
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return 0;
+
+    // Buffer rows and image extent are in texels for compressed formats too; an extent that isn't a
+    // multiple of the block size is fine as long as it reaches the edge of the image
+    VkBufferImageCopy region;
+    region.bufferImageHeight = 0;
+    region.bufferRowLength = 0;
+    region.bufferOffset = staging.bufferOffset;
+    region.imageOffset.x = 0;
+    region.imageOffset.y = 0;
+    region.imageOffset.z = 0;
+    region.imageExtent.width = textureWidth;
+    region.imageExtent.height = textureHeight;
+    region.imageExtent.depth = 1;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageSubresource.mipLevel = 0;
+    vkCmdCopyBufferToImage(recordingState.commandBuffer, staging.buffer, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+    // Same as EndModifyTextureAsync: the frame number is the ticket
+    m_LastUploadTicket = recordingState.currentFrameNumber;
+    return m_LastUploadTicket;
 }
 
 void* RenderAPI_Vulkan::BeginModifyVertexBuffer(void* bufferHandle, size_t* outBufferSize)
@@ -780,4 +1400,143 @@ void RenderAPI_Vulkan::EndModifyVertexBuffer(void* bufferHandle)
     }
 }
 
+void RenderAPI_Vulkan::CreateTimerQueryPool()
+{
+    m_TimerQueryPool = VK_NULL_HANDLE;
+    m_TimerResultsValid = 0;
+    for (int i = 0; i < kGpuTimerFrames; ++i)
+    {
+        m_TimerSlotFrame[i] = ~0ull;
+        m_TimerSlotBegun[i] = 0;
+        m_TimerSlotIssued[i] = 0;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(m_Instance.physicalDevice, &properties);
+    // Without this, the graphics queue may not support timestamps at all
+    if (!properties.limits.timestampComputeAndGraphics || properties.limits.timestampPeriod <= 0.0f)
+        return;
+    m_TimestampPeriodNs = properties.limits.timestampPeriod;
+
+    VkQueryPoolCreateInfo createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    createInfo.pNext = NULL;
+    createInfo.flags = 0;
+    createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    createInfo.queryCount = kGpuTimerFrames * kGpuScopeCount * 2;
+    createInfo.pipelineStatistics = 0;
+    if (vkCreateQueryPool(m_Instance.device, &createInfo, NULL, &m_TimerQueryPool) != VK_SUCCESS)
+        m_TimerQueryPool = VK_NULL_HANDLE;
+    else
+        MemoryStatsAlloc(kMemBackendVulkan, kMemCategoryQuery, 0);
+}
+
+void RenderAPI_Vulkan::ReadTimerQueries(int slot)
+{
+    for (int scope = 0; scope < kGpuScopeCount; ++scope)
+    {
+        if (!(m_TimerSlotIssued[slot] & (1u << scope)))
+            continue;
+        uint64_t timestamps[2];
+        const uint32_t firstQuery = (slot * kGpuScopeCount + scope) * 2;
+        if (vkGetQueryPoolResults(m_Instance.device, m_TimerQueryPool, firstQuery, 2, sizeof(timestamps), timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT) == VK_SUCCESS)
+        {
+            m_TimerResults[scope] = float(double(timestamps[1] - timestamps[0]) * m_TimestampPeriodNs * 1e-6);
+            m_TimerResultsValid |= 1u << scope;
+            m_TimerSlotIssued[slot] &= ~(1u << scope);
+        }
+    }
+}
+
+bool RenderAPI_Vulkan::PrepareTimerSlot(const UnityVulkanRecordingState& recordingState, unsigned long long frameNumber)
+{
+    const int slot = int(frameNumber % kGpuTimerFrames);
+    if (m_TimerSlotFrame[slot] == frameNumber)
+        return true;
+
+    // Query resets are not allowed inside a render pass; that frame goes without timings then
+    if (recordingState.subPassIndex != -1)
+        return false;
+
+    // Keep what the GPU has finished in the slot before recycling it
+    if (m_TimerSlotFrame[slot] != ~0ull && m_TimerSlotFrame[slot] <= recordingState.safeFrameNumber)
+        ReadTimerQueries(slot);
+
+    vkCmdResetQueryPool(recordingState.commandBuffer, m_TimerQueryPool, slot * kGpuScopeCount * 2, kGpuScopeCount * 2);
+    m_TimerSlotFrame[slot] = frameNumber;
+    m_TimerSlotBegun[slot] = 0;
+    m_TimerSlotIssued[slot] = 0;
+    return true;
+}
+
+void RenderAPI_Vulkan::BeginGpuScope(GpuScope scope)
+{
+    if (m_TimerQueryPool == VK_NULL_HANDLE)
+        return;
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+    if (!PrepareTimerSlot(recordingState, recordingState.currentFrameNumber))
+        return;
+
+    // A query can only be written once between resets, so a scope is timed once per frame
+    const int slot = int(recordingState.currentFrameNumber % kGpuTimerFrames);
+    if (m_TimerSlotBegun[slot] & (1u << scope))
+        return;
+    vkCmdWriteTimestamp(recordingState.commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_TimerQueryPool, (slot * kGpuScopeCount + scope) * 2);
+    m_TimerSlotBegun[slot] |= 1u << scope;
+}
+
+void RenderAPI_Vulkan::EndGpuScope(GpuScope scope)
+{
+    if (m_TimerQueryPool == VK_NULL_HANDLE)
+        return;
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return;
+
+    const int slot = int(recordingState.currentFrameNumber % kGpuTimerFrames);
+    if (m_TimerSlotFrame[slot] != recordingState.currentFrameNumber || !(m_TimerSlotBegun[slot] & (1u << scope)) || (m_TimerSlotIssued[slot] & (1u << scope)))
+        return;
+    vkCmdWriteTimestamp(recordingState.commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_TimerQueryPool, (slot * kGpuScopeCount + scope) * 2 + 1);
+    m_TimerSlotIssued[slot] |= 1u << scope;
+}
+
+bool RenderAPI_Vulkan::ResolveGpuTimings(GpuScopeTiming outTimings[kGpuScopeCount])
+{
+    if (m_TimerQueryPool == VK_NULL_HANDLE)
+        return false;
+
+    UnityVulkanRecordingState recordingState;
+    if (!m_UnityVulkan->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        return true;
+
+    // Oldest frame first, so the newest finished frame wins. Results read while recycling a slot
+    // are older than anything still in the pool, so they get overwritten the same way.
+    const unsigned long long current = recordingState.currentFrameNumber;
+    for (unsigned long long frame = current >= kGpuTimerFrames - 1 ? current - (kGpuTimerFrames - 1) : 0; frame <= current; ++frame)
+    {
+        const int slot = int(frame % kGpuTimerFrames);
+        if (m_TimerSlotFrame[slot] == frame && frame <= recordingState.safeFrameNumber)
+            ReadTimerQueries(slot);
+    }
+    // No calibrated timestamps here, so results can't be placed on the CPU timeline
+    for (int scope = 0; scope < kGpuScopeCount; ++scope)
+    {
+        if (m_TimerResultsValid & (1u << scope))
+        {
+            outTimings[scope].ms = m_TimerResults[scope];
+            outTimings[scope].cpuStartNs = -1;
+        }
+    }
+    m_TimerResultsValid = 0;
+
+    // Reset next frame's queries while we are likely outside of a render pass, so that events which
+    // start inside one (like the triangle drawing) still get timed
+    PrepareTimerSlot(recordingState, recordingState.currentFrameNumber + 1);
+    return true;
+}
+
 #endif // #if SUPPORT_VULKAN
@@ -2,12 +2,65 @@
 
 #include "PlatformBase.h"
 #include "RenderAPI.h"
+#include "BlockCompression.h"
+#include "ChromeTrace.h"
+#include "DebugMessages.h"
+#include "FrameTrace.h"
+#include "GLUploadThread.h"
+#include "MemoryStats.h"
+#include "PluginProfiler.h"
+#include "RenderAPI_Null.h"
+#include "ShaderCache.h"
+#include "VirtualTexture.h"
 
 #include <assert.h>
 #include <math.h>
+#include <atomic>
+#include <chrono>
+#include <stdlib.h>
 #include <vector>
 
-#include <simd/simd.h>
+
+// --------------------------------------------------------------------------
+// Frame trace capture. While a capture is running, every exported call that changes plugin state
+// and every render event gets appended to a binary trace (see FrameTrace.h), so problems seen
+// in a player can be replayed offline with ReplayFrameTrace. Setting the RENDERING_PLUGIN_TRACE
+// environment variable to a file path captures from plugin load on.
+
+static FrameTraceWriter g_FrameTrace;
+static bool g_FrameTraceReplaying = false;
+
+static bool IsCapturingFrameTrace()
+{
+	return g_FrameTrace.IsOpen() && !g_FrameTraceReplaying;
+}
+
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API StartFrameTraceCapture(const char* path)
+{
+	return path && g_FrameTrace.Open(path) ? 1 : 0;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API StopFrameTraceCapture()
+{
+	g_FrameTrace.Close();
+}
+
+
+// --------------------------------------------------------------------------
+// Chrome trace capture: profiler scopes, render events, upload sizes and GPU timings as a
+// trace-event JSON file for chrome://tracing or Perfetto (see ChromeTrace.h). Setting the
+// RENDERING_PLUGIN_CHROME_TRACE environment variable to a file path captures from plugin load on.
+
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API StartChromeTraceCapture(const char* path)
+{
+	return StartChromeTrace(path) ? 1 : 0;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API StopChromeTraceCapture()
+{
+	StopChromeTrace();
+}
+
 
 
 // --------------------------------------------------------------------------
@@ -15,7 +68,14 @@
 
 static float g_Time;
 
-extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTimeFromUnity (float t) { g_Time = t; }
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTimeFromUnity (float t)
+{
+	if (IsCapturingFrameTrace())
+		g_FrameTrace.Write(kTraceSetTime, &t, sizeof(t));
+	g_Time = t;
+	MemoryStatsNextFrame();
+	DebugMessagesNextFrame();
+}
 
 
 
@@ -31,12 +91,151 @@ extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTextureFromUnity(v
 	// A script calls this at initialization time; just remember the texture pointer here.
 	// Will update texture pixels each frame from the plugin rendering event (texture update
 	// needs to happen on the rendering thread).
+	if (IsCapturingFrameTrace())
+	{
+		TraceSetTexture rec = { (uint64_t)(uintptr_t)textureHandle, w, h };
+		g_FrameTrace.Write(kTraceSetTexture, &rec, sizeof(rec));
+	}
 	g_TextureHandle = textureHandle;
 	g_TextureWidth = w;
 	g_TextureHeight = h;
 }
 
 
+// --------------------------------------------------------------------------
+// Texture upload tickets. The per-frame texture update is uploaded asynchronously; scripts can
+// get the ticket of the latest update and poll whether it has finished on the GPU. Completion
+// state is refreshed on the render thread, so these are safe to call from any thread.
+
+static std::atomic<unsigned long long> g_TextureUploadTicket(0);
+static std::atomic<unsigned long long> g_CompletedUploadTicket(0);
+
+extern "C" unsigned long long UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetTextureUploadTicket()
+{
+	return g_TextureUploadTicket;
+}
+
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API IsTextureUploadComplete(unsigned long long ticket)
+{
+	return ticket != 0 && ticket <= g_CompletedUploadTicket ? 1 : 0;
+}
+
+// On OpenGL, do the upload itself on a worker thread with its own context, so large updates stop
+// costing render thread time. Needs Unity's context to be an EGL one (Android, EmbeddedLinux, and
+// Linux when not on GLX); elsewhere the upload stays on the render thread. Off by default.
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTextureUploadThreadEnabled(int enabled)
+{
+	SetGLUploadThreadEnabled(enabled != 0);
+}
+
+
+// --------------------------------------------------------------------------
+// Block compression of the per-frame texture update. When the texture from SetTextureFromUnity was
+// created in a block compressed format, scripts say which TextureBlockFormat it is (1 BC1, 2 BC4,
+// 3 ETC2 RGB, 4 EAC R11); the pixels then get encoded on the CPU and uploaded as blocks, an eighth
+// of the RGBA8 upload. 0 goes back to RGBA8. Picking a format the device supports is up to the
+// script (SystemInfo.SupportsTextureFormat); the upload is skipped on backends that can't do it.
+
+static TextureBlockFormat g_TextureBlockFormat = kBlockFormatNone;
+static BlockCompressor g_TextureCompressor;
+static std::vector<unsigned char> g_TexturePixels;	// the kernel's output, before encoding
+static std::vector<unsigned char> g_TextureBlocks;
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTextureBlockFormatFromUnity(int blockFormat)
+{
+	if (IsCapturingFrameTrace())
+		g_FrameTrace.Write(kTraceSetTextureBlockFormat, &blockFormat, sizeof(blockFormat));
+	g_TextureBlockFormat = blockFormat > kBlockFormatNone && blockFormat < kBlockFormatCount ? (TextureBlockFormat)blockFormat : kBlockFormatNone;
+}
+
+
+// --------------------------------------------------------------------------
+// GPU timings of the plugin's work, measured with timer queries on backends that have them
+// (OpenGL core 3.3+ and Vulkan). Results come in a few frames late since the render thread never
+// waits for them; a scope reads -1 until it has been measured once.
+
+static std::atomic<float> g_GpuTimingsMs[kGpuScopeCount];
+static std::atomic<bool> g_GpuTimersSupported(false);
+
+static const char* const kGpuScopeNames[kGpuScopeCount] =
+{
+	"GPU DrawTriangles",
+	"GPU TextureUpload",
+	"GPU VertexBufferUpload",
+	"GPU VirtualTextureUpload",
+};
+
+static void ResetGpuTimings()
+{
+	for (int i = 0; i < kGpuScopeCount; ++i)
+		g_GpuTimingsMs[i] = -1.0f;
+}
+
+// Fills outMs with the latest GPU milliseconds per scope, in GpuScope order: triangle drawing,
+// texture upload, vertex buffer upload, virtual texture upload. Returns the number of values
+// written, 0 if the current graphics device has no GPU timers.
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetPluginGpuTimings(float* outMs, int maxCount)
+{
+	if (!g_GpuTimersSupported || !outMs)
+		return 0;
+	const int count = maxCount < kGpuScopeCount ? maxCount : kGpuScopeCount;
+	for (int i = 0; i < count; ++i)
+		outMs[i] = g_GpuTimingsMs[i];
+	return count > 0 ? count : 0;
+}
+
+
+// --------------------------------------------------------------------------
+// CPU timings of the render thread hot paths (see PluginProfiler.h for the scopes). Stats cover
+// the most recent samples of every thread; the profiler can be compiled out with
+// SUPPORT_PLUGIN_PROFILER=0, in which case no scopes get reported.
+
+// Fills up to maxCount entries in ProfilerScope order; returns the number filled.
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetPluginCpuTimings(ProfilerScopeStats* outStats, int maxCount)
+{
+	return GetProfilerStats(outStats, maxCount);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API ResetPluginCpuTimings()
+{
+	ResetProfilerStats();
+}
+
+
+// --------------------------------------------------------------------------
+// Memory held by the plugin, per backend and category (see MemoryStats.h). Entries are backend
+// major: index = backend * kMemCategoryCount + category.
+
+// Fills up to maxCount entries; returns the number filled.
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetPluginMemoryStats(MemoryStats* outStats, int maxCount)
+{
+	return GetMemoryStats(outStats, maxCount);
+}
+
+
+// --------------------------------------------------------------------------
+// Messages from the graphics driver about the plugin's work (see DebugMessages.h): counts per
+// type, and performance warnings of the last frame per plugin scope. Only in debug and profiling
+// builds, and only on backends that get such messages (GL with KHR_debug).
+
+// Returns 0, with zeroed stats, when debug messages are compiled out.
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetPluginDebugMessageStats(DebugMessageStats* outStats)
+{
+	return GetDebugMessageStats(outStats) ? 1 : 0;
+}
+
+
+// --------------------------------------------------------------------------
+// SetShaderCacheDirectoryFromUnity: where compiled programs get cached between runs (see
+// ShaderCache.h); scripts pass a writable directory such as Application.persistentDataPath.
+// Takes effect for programs created after the call, which the backends do on first use.
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetShaderCacheDirectoryFromUnity(const char* path)
+{
+	SetShaderCacheDirectory(path);
+}
+
+
 // --------------------------------------------------------------------------
 // SetMeshBuffersFromUnity, an example function we export which is called by one of the scripts.
 
@@ -58,6 +257,18 @@ extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetMeshBuffersFromUni
 	// A script calls this at initialization time; just remember the pointer here.
 	// Will update buffer data each frame from the plugin rendering event (buffer update
 	// needs to happen on the rendering thread).
+	if (IsCapturingFrameTrace())
+	{
+		TraceSetMeshBuffers rec = { (uint64_t)(uintptr_t)vertexBufferHandle, vertexCount, 0 };
+		FrameTraceWriter::Part parts[4] =
+		{
+			{ &rec, sizeof(rec) },
+			{ sourceVertices, vertexCount * 3 * sizeof(float) },
+			{ sourceNormals, vertexCount * 3 * sizeof(float) },
+			{ sourceUV, vertexCount * 2 * sizeof(float) },
+		};
+		g_FrameTrace.Write(kTraceSetMeshBuffers, parts, 4);
+	}
 	g_VertexBufferHandle = vertexBufferHandle;
 	g_VertexBufferVertexCount = vertexCount;
 
@@ -85,6 +296,123 @@ extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetMeshBuffersFromUni
 
 
 
+// --------------------------------------------------------------------------
+// Virtual texture streaming, for huge procedural surfaces that can't be resident at full resolution.
+// A script passes a tile cache texture and a page table texture (see VirtualTexture.h for the layout),
+// then requests pages each frame, either from a GPU feedback buffer it read back or from a
+// CPU-side UV region query. Pages are generated and streamed in from the plugin rendering event.
+
+static VirtualTexture g_VirtualTexture;
+
+// Same plasma pattern as the regular texture, but static and evaluated at virtual texel positions,
+// so any page of any mip level can be generated on its own.
+static void GeneratePlasmaTile(int mipLevel, int x, int y, int width, int height, unsigned char* dst, int rowPitch, void* userData)
+{
+	const float scale = float(1 << mipLevel);
+	for (int row = 0; row < height; ++row)
+	{
+		unsigned char* ptr = dst + row * rowPitch;
+		const float vy = (y + row) * scale;
+		for (int col = 0; col < width; ++col)
+		{
+			const float vx = (x + col) * scale;
+			int vv = int(
+				(127.0f + (127.0f * sinf(vx / 7.0f))) +
+				(127.0f + (127.0f * sinf(vy / 5.0f))) +
+				(127.0f + (127.0f * sinf((vx + vy) / 6.0f))) +
+				(127.0f + (127.0f * sinf(sqrtf(vx*vx + vy*vy) / 4.0f)))
+				) / 4;
+			ptr[0] = vv;
+			ptr[1] = vv;
+			ptr[2] = vv;
+			ptr[3] = 255;
+			ptr += 4;
+		}
+	}
+}
+
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetVirtualTextureFromUnity(void* cacheTextureHandle, int cacheWidth, int cacheHeight,
+	void* pageTableTextureHandle, int virtualWidth, int virtualHeight, int pageSize, int border)
+{
+	// Like the other setup functions, a script calls this at initialization time
+	if (IsCapturingFrameTrace())
+	{
+		TraceSetVirtualTexture rec = { (uint64_t)(uintptr_t)cacheTextureHandle, (uint64_t)(uintptr_t)pageTableTextureHandle,
+			cacheWidth, cacheHeight, virtualWidth, virtualHeight, pageSize, border };
+		g_FrameTrace.Write(kTraceSetVirtualTexture, &rec, sizeof(rec));
+	}
+	g_VirtualTexture.SetGenerator(GeneratePlasmaTile, NULL);
+	return g_VirtualTexture.Configure(cacheTextureHandle, cacheWidth, cacheHeight, pageTableTextureHandle, virtualWidth, virtualHeight, pageSize, border) ? 1 : 0;
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API RequestVirtualTexturePages(const unsigned int* feedback, int count)
+{
+	if (IsCapturingFrameTrace() && feedback && count > 0)
+		g_FrameTrace.Write(kTraceRequestVirtualTexturePages, feedback, count * sizeof(unsigned int));
+	g_VirtualTexture.RequestPages(feedback, count);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API RequestVirtualTextureRegion(float u0, float v0, float u1, float v1, int mipLevel)
+{
+	if (IsCapturingFrameTrace())
+	{
+		TraceRequestVirtualTextureRegion rec = { u0, v0, u1, v1, mipLevel };
+		g_FrameTrace.Write(kTraceRequestVirtualTextureRegion, &rec, sizeof(rec));
+	}
+	g_VirtualTexture.RequestRegion(u0, v0, u1, v1, mipLevel);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetVirtualTextureUploadBudget(int bytesPerFrame)
+{
+	if (IsCapturingFrameTrace())
+		g_FrameTrace.Write(kTraceSetVirtualTextureUploadBudget, &bytesPerFrame, sizeof(bytesPerFrame));
+	g_VirtualTexture.SetUploadBudget(bytesPerFrame);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetVirtualTextureStats(int* outResidentPages, int* outPendingPages, int* outUploadedBytes)
+{
+	*outResidentPages = g_VirtualTexture.GetResidentPageCount();
+	*outPendingPages = g_VirtualTexture.GetPendingPageCount();
+	*outUploadedBytes = g_VirtualTexture.GetUploadedBytesLastUpdate();
+}
+
+
+
+// --------------------------------------------------------------------------
+// Null device command log. When running without a graphics device (batch mode, headless hosts)
+// the plugin records what it would have sent to the GPU; scripts and tools read it back from here.
+
+#if SUPPORT_NULL_RENDERER
+
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetNullRendererCommandLog(NullCommand* outCommands, int maxCount)
+{
+	return GetNullCommandLog(outCommands, maxCount);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetNullRendererCommandTotals(NullCommandTotals* outTotals)
+{
+	GetNullCommandTotals(outTotals);
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API ClearNullRendererCommandLog()
+{
+	ClearNullCommandLog();
+}
+
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API RegisterNullRendererBuffer(void* bufferHandle, int bufferSize)
+{
+	if (IsCapturingFrameTrace())
+	{
+		TraceRegisterNullBuffer rec = { (uint64_t)(uintptr_t)bufferHandle, bufferSize, 0 };
+		g_FrameTrace.Write(kTraceRegisterNullBuffer, &rec, sizeof(rec));
+	}
+	RegisterNullVertexBuffer(bufferHandle, bufferSize > 0 ? (size_t)bufferSize : 0);
+}
+
+#endif // #if SUPPORT_NULL_RENDERER
+
+
+
 // --------------------------------------------------------------------------
 // UnitySetInterfaces
 
@@ -98,7 +426,16 @@ extern "C" void	UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API UnityPluginLoad(IUnit
 	s_UnityInterfaces = unityInterfaces;
 	s_Graphics = s_UnityInterfaces->Get<IUnityGraphics>();
 	s_Graphics->RegisterDeviceEventCallback(OnGraphicsDeviceEvent);
-	
+
+#if !UNITY_METRO
+	const char* tracePath = getenv("RENDERING_PLUGIN_TRACE");
+	if (tracePath && *tracePath)
+		StartFrameTraceCapture(tracePath);
+	const char* chromeTracePath = getenv("RENDERING_PLUGIN_CHROME_TRACE");
+	if (chromeTracePath && *chromeTracePath)
+		StartChromeTraceCapture(chromeTracePath);
+#endif
+
 #if SUPPORT_VULKAN
 	if (s_Graphics->GetRenderer() == kUnityGfxRendererNull)
 	{
@@ -114,6 +451,10 @@ extern "C" void	UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API UnityPluginLoad(IUnit
 extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API UnityPluginUnload()
 {
 	s_Graphics->UnregisterDeviceEventCallback(OnGraphicsDeviceEvent);
+	// Threads can't be joined once the library is being unloaded
+	g_TextureCompressor.Stop();
+	StopFrameTraceCapture();
+	StopChromeTraceCapture();
 }
 
 #if UNITY_WEBGL
@@ -141,9 +482,23 @@ static void UNITY_INTERFACE_API OnGraphicsDeviceEvent(UnityGfxDeviceEventType ev
 	// Create graphics API implementation upon initialization
 	if (eventType == kUnityGfxDeviceEventInitialize)
 	{
-		assert(s_CurrentAPI == NULL);
+		// The manual initialize on plugin load can run before the real device exists and end up with
+		// the null device; replace it once the actual device gets initialized.
+		if (s_CurrentAPI)
+		{
+			s_CurrentAPI->ProcessDeviceEvent(kUnityGfxDeviceEventShutdown, s_UnityInterfaces);
+			delete s_CurrentAPI;
+			s_CurrentAPI = NULL;
+			ReportMemoryLeaks(GetMemoryBackend(s_DeviceType));
+		}
 		s_DeviceType = s_Graphics->GetRenderer();
 		s_CurrentAPI = CreateRenderAPI(s_DeviceType);
+
+		// Tickets are per RenderAPI instance
+		g_TextureUploadTicket = 0;
+		g_CompletedUploadTicket = 0;
+		g_GpuTimersSupported = false;
+		ResetGpuTimings();
 	}
 
 	// Let the implementation process the device related events
@@ -155,8 +510,12 @@ static void UNITY_INTERFACE_API OnGraphicsDeviceEvent(UnityGfxDeviceEventType ev
 	// Cleanup graphics API implementation upon shutdown
 	if (eventType == kUnityGfxDeviceEventShutdown)
 	{
+		// Textures are gone along with the device
+		g_VirtualTexture.Reset();
+		g_GpuTimersSupported = false;
 		delete s_CurrentAPI;
 		s_CurrentAPI = NULL;
+		ReportMemoryLeaks(GetMemoryBackend(s_DeviceType));
 		s_DeviceType = kUnityGfxRendererNull;
 	}
 }
@@ -166,12 +525,25 @@ static void UNITY_INTERFACE_API OnGraphicsDeviceEvent(UnityGfxDeviceEventType ev
 // --------------------------------------------------------------------------
 // OnRenderEvent
 // This will be called for GL.IssuePluginEvent script calls; eventID will
-// be the integer passed to IssuePluginEvent. In this example, we just ignore
-// that value.
+// be the integer passed to IssuePluginEvent. The sample scripts pass 1 and
+// get everything done in one event; the other IDs run a single step each,
+// which is what hosts and benchmarks use to time them separately. Unknown
+// IDs behave like kEventAll.
+
+enum RenderEventID
+{
+	kEventAll = 1,
+	kEventDrawTriangle = 2,
+	kEventModifyTexture = 3,
+	kEventModifyVertexBuffer = 4,
+	kEventUpdateVirtualTexture = 5,
+};
 
 
 static void DrawColoredTriangle()
 {
+	PLUGIN_PROFILE_SCOPE(kProfileDrawColoredTriangle);
+
 	// Draw a colored triangle. Note that colors will come out differently
 	// in D3D and OpenGL, for example, since they expect color bytes
 	// in different ordering.
@@ -200,43 +572,44 @@ static void DrawColoredTriangle()
 		0,0,finalDepth,1,
 	};
 
-	s_CurrentAPI->DrawSimpleTriangles(worldMatrix, 1, verts);
-    
-    simd_float4 positions[3] =
-    {
-        simd_make_float4( -0.5f, -0.25f,  0, 1.0f),
-        simd_make_float4( 0.5f, -0.25f,  0, 1.0f),
-        simd_make_float4( 0,     0.5f ,  0, 1.0f),
-    };
-    
-    simd_float4 colors[3] =
-    {
-        simd_make_float4( 0, 0,  1.0f, 1.0f),
-        simd_make_float4( 0, 1.0f,  0, 1.0f),
-        simd_make_float4( 1.0f, 0,  0, 1.0f),
-    };
-    
-    
-    s_CurrentAPI->DrawMesh(worldMatrix, positions, colors, 3);
+	s_CurrentAPI->BeginGpuScope(kGpuScopeDrawTriangles);
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileDrawSimpleTriangles);
+		// A single draw; batching it (DrawSimpleTrianglesBatch) would only add the indirect command
+		s_CurrentAPI->DrawSimpleTriangles(worldMatrix, 1, verts);
+	}
+	s_CurrentAPI->EndGpuScope(kGpuScopeDrawTriangles);
+
+	// Same triangle through the mesh shader path; float4 position and color per vertex
+	// (plain arrays rather than simd types, so this builds on every platform)
+	float positions[3][4] =
+	{
+		{ -0.5f, -0.25f,  0, 1.0f },
+		{ 0.5f, -0.25f,  0, 1.0f },
+		{ 0,     0.5f ,  0, 1.0f },
+	};
+	float colors[3][4] =
+	{
+		{ 0, 0,  1.0f, 1.0f },
+		{ 0, 1.0f,  0, 1.0f },
+		{ 1.0f, 0,  0, 1.0f },
+	};
+
+	PLUGIN_PROFILE_SCOPE(kProfileDrawMesh);
+	s_CurrentAPI->DrawMesh(worldMatrix, positions, colors, 3);
 }
 
 
-static void ModifyTexturePixels()
+// Pixels in the texture's own byte order (RenderAPI::GetTexturePixelLayout), so the upload needs
+// no swizzle
+static void GenerateTexturePixels(unsigned char* dst, int width, int height, int textureRowPitch, TexturePixelLayout layout)
 {
-	void* textureHandle = g_TextureHandle;
-	int width = g_TextureWidth;
-	int height = g_TextureHeight;
-	if (!textureHandle)
-		return;
-
-	int textureRowPitch;
-	void* textureDataPtr = s_CurrentAPI->BeginModifyTexture(textureHandle, width, height, &textureRowPitch);
-	if (!textureDataPtr)
-		return;
+	PLUGIN_PROFILE_SCOPE(kProfileTextureKernel);
 
 	const float t = g_Time * 4.0f;
+	const int red = layout == kTexturePixelBGRA8 ? 2 : 0;
+	const int blue = 2 - red;
 
-	unsigned char* dst = (unsigned char*)textureDataPtr;
 	for (int y = 0; y < height; ++y)
 	{
 		unsigned char* ptr = dst;
@@ -251,9 +624,9 @@ static void ModifyTexturePixels()
 				) / 4;
 
 			// Write the texture pixel
-			ptr[0] = vv;
+			ptr[red] = vv;
 			ptr[1] = vv;
-			ptr[2] = vv;
+			ptr[blue] = vv;
 			ptr[3] = vv;
 
 			// To next pixel (our pixels are 4 bpp)
@@ -263,20 +636,100 @@ static void ModifyTexturePixels()
 		// To next image row
 		dst += textureRowPitch;
 	}
+}
+
+
+// The same pixels, generated into plugin memory and encoded to blocks before they get uploaded
+static void ModifyCompressedTexturePixels(void* textureHandle, int width, int height, TextureBlockFormat format)
+{
+	const int rowPitch = width * 4;
+	const size_t blocksSize = GetBlockCompressedSize(format, width, height);
+	const size_t oldPixelsCapacity = g_TexturePixels.capacity();
+	const size_t oldBlocksCapacity = g_TextureBlocks.capacity();
+	g_TexturePixels.resize((size_t)rowPitch * height);
+	g_TextureBlocks.resize(blocksSize);
+	MemoryStatsResize(kMemBackendPlugin, kMemCategoryStaging, oldPixelsCapacity, g_TexturePixels.capacity());
+	MemoryStatsResize(kMemBackendPlugin, kMemCategoryStaging, oldBlocksCapacity, g_TextureBlocks.capacity());
+
+	// The block encoders take RGBA
+	GenerateTexturePixels(&g_TexturePixels[0], width, height, rowPitch, kTexturePixelRGBA8);
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileTextureCompress);
+		g_TextureCompressor.Compress(format, &g_TexturePixels[0], width, height, rowPitch, &g_TextureBlocks[0]);
+	}
+
+	s_CurrentAPI->BeginGpuScope(kGpuScopeTextureUpload);
+	UploadTicket ticket;
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileUpdateCompressedTexture);
+		ticket = s_CurrentAPI->UpdateCompressedTexture(textureHandle, width, height, format, &g_TextureBlocks[0], blocksSize);
+	}
+	if (IsChromeTraceActive())
+		ChromeTraceCounter("TextureUploadBytes", double(blocksSize));
+	s_CurrentAPI->EndGpuScope(kGpuScopeTextureUpload);
+	if (ticket != 0)
+		g_TextureUploadTicket = ticket;
+}
+
+
+static void ModifyTexturePixels()
+{
+	PLUGIN_PROFILE_SCOPE(kProfileModifyTexturePixels);
+
+	void* textureHandle = g_TextureHandle;
+	int width = g_TextureWidth;
+	int height = g_TextureHeight;
+	if (!textureHandle)
+		return;
+	if (g_TextureBlockFormat != kBlockFormatNone)
+	{
+		ModifyCompressedTexturePixels(textureHandle, width, height, g_TextureBlockFormat);
+		return;
+	}
 
-	s_CurrentAPI->EndModifyTexture(textureHandle, width, height, textureRowPitch, textureDataPtr);
+	int textureRowPitch;
+	void* textureDataPtr;
+	TexturePixelLayout layout;
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileBeginModifyTexture);
+		layout = s_CurrentAPI->GetTexturePixelLayout(textureHandle);
+		textureDataPtr = s_CurrentAPI->BeginModifyTexture(textureHandle, width, height, &textureRowPitch);
+	}
+	if (!textureDataPtr)
+		return;
+
+	GenerateTexturePixels((unsigned char*)textureDataPtr, width, height, textureRowPitch, layout);
+
+	// Don't wait for the upload; completion is picked up by PollCompletedUploads on later events
+	s_CurrentAPI->BeginGpuScope(kGpuScopeTextureUpload);
+	UploadTicket ticket;
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileEndModifyTexture);
+		ticket = s_CurrentAPI->EndModifyTextureAsync(textureHandle, width, height, textureRowPitch, textureDataPtr);
+	}
+	if (IsChromeTraceActive())
+		ChromeTraceCounter("TextureUploadBytes", double(textureRowPitch) * height);
+	s_CurrentAPI->EndGpuScope(kGpuScopeTextureUpload);
+	if (ticket != 0)
+		g_TextureUploadTicket = ticket;
 }
 
 
 static void ModifyVertexBuffer()
 {
+	PLUGIN_PROFILE_SCOPE(kProfileModifyVertexBuffer);
+
 	void* bufferHandle = g_VertexBufferHandle;
 	int vertexCount = g_VertexBufferVertexCount;
 	if (!bufferHandle)
 		return;
 
 	size_t bufferSize;
-	void* bufferDataPtr = s_CurrentAPI->BeginModifyVertexBuffer(bufferHandle, &bufferSize);
+	void* bufferDataPtr;
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileBeginModifyVertexBuffer);
+		bufferDataPtr = s_CurrentAPI->BeginModifyVertexBuffer(bufferHandle, &bufferSize);
+	}
 	if (!bufferDataPtr)
 		return;
 	int vertexStride = int(bufferSize / vertexCount);
@@ -288,27 +741,49 @@ static void ModifyVertexBuffer()
 	if (static_cast<unsigned int>(vertexStride) != sizeof(MeshVertex))
 		return;
 
-	const float t = g_Time * 3.0f;
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileVertexBufferKernel);
 
-	char* bufferPtr = (char*)bufferDataPtr;
-	// modify vertex Y position with several scrolling sine waves,
-	// copy the rest of the source data unmodified
-	for (int i = 0; i < vertexCount; ++i)
+		const float t = g_Time * 3.0f;
+
+		char* bufferPtr = (char*)bufferDataPtr;
+		// modify vertex Y position with several scrolling sine waves,
+		// copy the rest of the source data unmodified
+		for (int i = 0; i < vertexCount; ++i)
+		{
+			const MeshVertex& src = g_VertexSource[i];
+			MeshVertex& dst = *(MeshVertex*)bufferPtr;
+			dst.pos[0] = src.pos[0];
+			dst.pos[1] = src.pos[1] + sinf(src.pos[0] * 1.1f + t) * 0.4f + sinf(src.pos[2] * 0.9f - t) * 0.3f;
+			dst.pos[2] = src.pos[2];
+			dst.normal[0] = src.normal[0];
+			dst.normal[1] = src.normal[1];
+			dst.normal[2] = src.normal[2];
+			dst.uv[0] = src.uv[0];
+			dst.uv[1] = src.uv[1];
+			bufferPtr += vertexStride;
+		}
+	}
+
+	s_CurrentAPI->BeginGpuScope(kGpuScopeVertexBufferUpload);
 	{
-		const MeshVertex& src = g_VertexSource[i];
-		MeshVertex& dst = *(MeshVertex*)bufferPtr;
-		dst.pos[0] = src.pos[0];
-		dst.pos[1] = src.pos[1] + sinf(src.pos[0] * 1.1f + t) * 0.4f + sinf(src.pos[2] * 0.9f - t) * 0.3f;
-		dst.pos[2] = src.pos[2];
-		dst.normal[0] = src.normal[0];
-		dst.normal[1] = src.normal[1];
-		dst.normal[2] = src.normal[2];
-		dst.uv[0] = src.uv[0];
-		dst.uv[1] = src.uv[1];
-		bufferPtr += vertexStride;
+		PLUGIN_PROFILE_SCOPE(kProfileEndModifyVertexBuffer);
+		s_CurrentAPI->EndModifyVertexBuffer(bufferHandle);
 	}
+	if (IsChromeTraceActive())
+		ChromeTraceCounter("VertexBufferUploadBytes", double(bufferSize));
+	s_CurrentAPI->EndGpuScope(kGpuScopeVertexBufferUpload);
+}
+
 
-	s_CurrentAPI->EndModifyVertexBuffer(bufferHandle);
+static void UpdateVirtualTexture()
+{
+	PLUGIN_PROFILE_SCOPE(kProfileUpdateVirtualTexture);
+	s_CurrentAPI->BeginGpuScope(kGpuScopeVirtualTextureUpload);
+	g_VirtualTexture.Update(s_CurrentAPI);
+	s_CurrentAPI->EndGpuScope(kGpuScopeVirtualTextureUpload);
+	if (IsChromeTraceActive())
+		ChromeTraceCounter("VirtualTextureUploadBytes", g_VirtualTexture.GetUploadedBytesLastUpdate());
 }
 
 
@@ -318,9 +793,60 @@ static void UNITY_INTERFACE_API OnRenderEvent(int eventID)
 	if (s_CurrentAPI == NULL)
 		return;
 
-	DrawColoredTriangle();
-	ModifyTexturePixels();
-	ModifyVertexBuffer();
+	PLUGIN_PROFILE_SCOPE(kProfileRenderEvent);
+
+	if (IsCapturingFrameTrace())
+		g_FrameTrace.Write(kTraceRenderEvent, &eventID, sizeof(eventID));
+	if (IsChromeTraceActive())
+		ChromeTraceInstant("RenderEvent", eventID);
+
+	s_CurrentAPI->BeginRenderEvent();
+	switch (eventID)
+	{
+	case kEventDrawTriangle:
+		DrawColoredTriangle();
+		break;
+	case kEventModifyTexture:
+		ModifyTexturePixels();
+		break;
+	case kEventModifyVertexBuffer:
+		ModifyVertexBuffer();
+		break;
+	case kEventUpdateVirtualTexture:
+		UpdateVirtualTexture();
+		break;
+	default:
+		DrawColoredTriangle();
+		ModifyTexturePixels();
+		ModifyVertexBuffer();
+		UpdateVirtualTexture();
+		break;
+	}
+	s_CurrentAPI->EndRenderEvent();
+
+	g_CompletedUploadTicket = s_CurrentAPI->PollCompletedUploads();
+
+	GpuScopeTiming timings[kGpuScopeCount];
+	for (int i = 0; i < kGpuScopeCount; ++i)
+		timings[i].ms = -1.0f;
+	if (s_CurrentAPI->ResolveGpuTimings(timings))
+	{
+		for (int i = 0; i < kGpuScopeCount; ++i)
+		{
+			if (timings[i].ms < 0.0f)
+				continue;
+			g_GpuTimingsMs[i] = timings[i].ms;
+			if (IsChromeTraceActive())
+			{
+				// Results that can't be placed on the CPU timeline go into a counter track instead
+				if (timings[i].cpuStartNs >= 0)
+					ChromeTraceGpuScope(kGpuScopeNames[i], timings[i].cpuStartNs, (unsigned long long)(timings[i].ms * 1e6));
+				else
+					ChromeTraceCounter(kGpuScopeNames[i], timings[i].ms);
+			}
+		}
+		g_GpuTimersSupported = true;
+	}
 }
 
 
@@ -332,3 +858,174 @@ extern "C" UnityRenderingEvent UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetRen
 	return OnRenderEvent;
 }
 
+
+
+
+// --------------------------------------------------------------------------
+// ReplayFrameTrace, feeds a captured trace back through the exported functions and OnRenderEvent
+// as fast as possible, on the calling thread -- so it is meant for hosts that own the graphics
+// device (or run the null device), not for scripts in a running player.
+//
+// Handles in the trace belong to the process that captured it. The remap callback gets to replace
+// each of them with a resource of the replaying process; without one, handles are passed through
+// as they are, which only works with the null device. Vertex buffers get registered with the null
+// device automatically.
+//
+// A frame starts at each SetTimeFromUnity record. Wall clock milliseconds spent on each frame are
+// written into outFrameMs (if given). Returns the number of frames replayed, or -1 if the trace
+// can't be opened. CountFrameTraceFrames tells how many frames a trace has without replaying it,
+// to size outFrameMs.
+
+typedef void* (UNITY_INTERFACE_API * FrameTraceHandleRemapFunc)(void* recordedHandle, int handleKind, int width, int height);
+
+static void* RemapTraceHandle(FrameTraceHandleRemapFunc remap, uint64_t handle, FrameTraceHandleKind kind, int width, int height)
+{
+	void* recorded = (void*)(uintptr_t)handle;
+	return remap ? remap(recorded, kind, width, height) : recorded;
+}
+
+// Whether the payload is as big as its type says; a corrupt or truncated trace must not make the
+// replay read past a record. Types this version doesn't know pass, they get skipped anyway.
+static bool IsFrameTraceRecordComplete(const FrameTraceReader::Record& record)
+{
+	size_t minSize = 0;
+	switch (record.type)
+	{
+	case kTraceSetTime: minSize = sizeof(float); break;
+	case kTraceSetTexture: minSize = sizeof(TraceSetTexture); break;
+	case kTraceSetMeshBuffers:
+	{
+		if (record.size < sizeof(TraceSetMeshBuffers))
+			return false;
+		const TraceSetMeshBuffers& rec = *(const TraceSetMeshBuffers*)record.payload;
+		// Positions, normals and uvs follow
+		return rec.vertexCount >= 0 && sizeof(TraceSetMeshBuffers) + (uint64_t)rec.vertexCount * 9 * sizeof(float) <= record.size;
+	}
+	case kTraceRenderEvent: minSize = sizeof(int); break;
+	case kTraceSetVirtualTexture: minSize = sizeof(TraceSetVirtualTexture); break;
+	case kTraceRequestVirtualTextureRegion: minSize = sizeof(TraceRequestVirtualTextureRegion); break;
+	case kTraceSetVirtualTextureUploadBudget: minSize = sizeof(int); break;
+	case kTraceSetTextureBlockFormat: minSize = sizeof(int); break;
+	case kTraceRegisterNullBuffer: minSize = sizeof(TraceRegisterNullBuffer); break;
+	default: break;
+	}
+	return record.size >= minSize;
+}
+
+static void ReplayFrameTraceRecord(const FrameTraceReader::Record& record, FrameTraceHandleRemapFunc remap)
+{
+	// Skipped like records of unknown types
+	if (!IsFrameTraceRecordComplete(record))
+		return;
+
+	switch (record.type)
+	{
+	case kTraceSetTime:
+		SetTimeFromUnity(*(const float*)record.payload);
+		break;
+	case kTraceSetTexture:
+	{
+		const TraceSetTexture& rec = *(const TraceSetTexture*)record.payload;
+		SetTextureFromUnity(RemapTraceHandle(remap, rec.handle, kTraceHandleTexture, rec.width, rec.height), rec.width, rec.height);
+		break;
+	}
+	case kTraceSetMeshBuffers:
+	{
+		const TraceSetMeshBuffers& rec = *(const TraceSetMeshBuffers*)record.payload;
+		float* positions = (float*)(&rec + 1);
+		float* normals = positions + rec.vertexCount * 3;
+		float* uvs = normals + rec.vertexCount * 3;
+		void* buffer = RemapTraceHandle(remap, rec.handle, kTraceHandleVertexBuffer, rec.vertexCount, sizeof(MeshVertex));
+#if SUPPORT_NULL_RENDERER
+		if (s_DeviceType == kUnityGfxRendererNull)
+			RegisterNullVertexBuffer(buffer, rec.vertexCount * sizeof(MeshVertex));
+#endif
+		SetMeshBuffersFromUnity(buffer, rec.vertexCount, positions, normals, uvs);
+		break;
+	}
+	case kTraceRenderEvent:
+		OnRenderEvent(*(const int*)record.payload);
+		break;
+	case kTraceSetVirtualTexture:
+	{
+		const TraceSetVirtualTexture& rec = *(const TraceSetVirtualTexture*)record.payload;
+		SetVirtualTextureFromUnity(
+			RemapTraceHandle(remap, rec.cacheHandle, kTraceHandleVirtualTextureCache, rec.cacheWidth, rec.cacheHeight), rec.cacheWidth, rec.cacheHeight,
+			RemapTraceHandle(remap, rec.pageTableHandle, kTraceHandleVirtualTexturePageTable, rec.virtualWidth, rec.virtualHeight),
+			rec.virtualWidth, rec.virtualHeight, rec.pageSize, rec.border);
+		break;
+	}
+	case kTraceRequestVirtualTexturePages:
+		RequestVirtualTexturePages((const unsigned int*)record.payload, int(record.size / sizeof(unsigned int)));
+		break;
+	case kTraceRequestVirtualTextureRegion:
+	{
+		const TraceRequestVirtualTextureRegion& rec = *(const TraceRequestVirtualTextureRegion*)record.payload;
+		RequestVirtualTextureRegion(rec.u0, rec.v0, rec.u1, rec.v1, rec.mipLevel);
+		break;
+	}
+	case kTraceSetVirtualTextureUploadBudget:
+		SetVirtualTextureUploadBudget(*(const int*)record.payload);
+		break;
+	case kTraceSetTextureBlockFormat:
+		SetTextureBlockFormatFromUnity(*(const int*)record.payload);
+		break;
+	case kTraceRegisterNullBuffer:
+	{
+#if SUPPORT_NULL_RENDERER
+		const TraceRegisterNullBuffer& rec = *(const TraceRegisterNullBuffer*)record.payload;
+		RegisterNullVertexBuffer(RemapTraceHandle(remap, rec.handle, kTraceHandleVertexBuffer, 0, 0), rec.size);
+#endif
+		break;
+	}
+	default:
+		// Newer record type; skip it
+		break;
+	}
+}
+
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API CountFrameTraceFrames(const char* path)
+{
+	FrameTraceReader reader;
+	if (!path || !reader.Open(path))
+		return -1;
+	int frameCount = 0;
+	FrameTraceReader::Record record;
+	while (reader.Next(record))
+	{
+		if (record.type == kTraceSetTime)
+			++frameCount;
+	}
+	return frameCount;
+}
+
+extern "C" int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API ReplayFrameTrace(const char* path, FrameTraceHandleRemapFunc remap, float* outFrameMs, int maxFrames)
+{
+	FrameTraceReader reader;
+	if (!path || !reader.Open(path))
+		return -1;
+
+	// Don't capture the replay into a running capture
+	g_FrameTraceReplaying = true;
+
+	int frameCount = 0;
+	std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+	FrameTraceReader::Record record;
+	while (reader.Next(record))
+	{
+		if (record.type == kTraceSetTime)
+		{
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			if (frameCount > 0 && outFrameMs && frameCount <= maxFrames)
+				outFrameMs[frameCount - 1] = std::chrono::duration<float, std::milli>(now - frameStart).count();
+			frameStart = now;
+			++frameCount;
+		}
+		ReplayFrameTraceRecord(record, remap);
+	}
+	if (frameCount > 0 && outFrameMs && frameCount <= maxFrames)
+		outFrameMs[frameCount - 1] = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+	g_FrameTraceReplaying = false;
+	return frameCount;
+}
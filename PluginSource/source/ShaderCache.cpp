@@ -0,0 +1,153 @@
+#include "ShaderCache.h"
+
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+// Shader cache files; see ShaderCache.h.
+
+
+static std::mutex s_ShaderCacheMutex;
+static std::string s_ShaderCacheDirectory;
+
+// File layout: this header, then the data
+struct ShaderCacheHeader
+{
+	char magic[4];
+	unsigned int version;
+	unsigned long long key;
+	unsigned long long dataHash;
+	unsigned int format;
+	unsigned int dataSize;
+};
+
+static const char kShaderCacheMagic[4] = { 'R', 'P', 'S', 'C' };
+
+
+void SetShaderCacheDirectory(const char* path)
+{
+	std::lock_guard<std::mutex> lock(s_ShaderCacheMutex);
+	s_ShaderCacheDirectory = path ? path : "";
+}
+
+
+bool HasShaderCacheDirectory()
+{
+	std::lock_guard<std::mutex> lock(s_ShaderCacheMutex);
+	return !s_ShaderCacheDirectory.empty();
+}
+
+
+unsigned long long HashShaderCacheData(const void* data, size_t size, unsigned long long hash)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+
+unsigned long long HashShaderCacheString(const char* text, unsigned long long hash)
+{
+	// Include the terminator, so "ab" + "c" and "a" + "bc" hash differently
+	return text ? HashShaderCacheData(text, strlen(text) + 1, hash) : HashShaderCacheData("", 1, hash);
+}
+
+
+static bool GetShaderCachePath(const char* name, std::string& outPath)
+{
+	std::lock_guard<std::mutex> lock(s_ShaderCacheMutex);
+	if (s_ShaderCacheDirectory.empty())
+		return false;
+	char fileName[128];
+	snprintf(fileName, sizeof(fileName), "RenderingPlugin_%s.v%d.bin", name, (int)kShaderCacheVersion);
+	outPath = s_ShaderCacheDirectory;
+	const char last = outPath[outPath.size() - 1];
+	if (last != '/' && last != '\\')
+		outPath += '/';
+	outPath += fileName;
+	return true;
+}
+
+
+bool LoadShaderCache(const char* name, unsigned long long key, unsigned int* outFormat, std::vector<unsigned char>& outData)
+{
+	std::string path;
+	if (!GetShaderCachePath(name, path))
+		return false;
+	FILE* file = fopen(path.c_str(), "rb");
+	if (!file)
+		return false;
+
+	ShaderCacheHeader header;
+	bool ok = fread(&header, sizeof(header), 1, file) == 1
+		&& memcmp(header.magic, kShaderCacheMagic, sizeof(kShaderCacheMagic)) == 0
+		&& header.version == kShaderCacheVersion
+		&& header.key == key
+		&& header.dataSize > 0;
+	// A damaged header can claim any size; only allocate what the file actually holds
+	bool damaged = false;
+	if (ok)
+	{
+		long fileSize = -1;
+		if (fseek(file, 0, SEEK_END) == 0)
+			fileSize = ftell(file);
+		damaged = fileSize < 0 || (unsigned long long)fileSize != sizeof(header) + (unsigned long long)header.dataSize;
+		ok = !damaged && fseek(file, sizeof(header), SEEK_SET) == 0;
+	}
+	if (ok)
+	{
+		outData.resize(header.dataSize);
+		ok = fread(&outData[0], header.dataSize, 1, file) == 1
+			&& HashShaderCacheData(&outData[0], outData.size(), kShaderCacheHashSeed) == header.dataHash;
+		damaged = !ok;
+	}
+	fclose(file);
+	if (!ok)
+	{
+		outData.clear();
+		// It would fail the same way on every start until something saves over it
+		if (damaged)
+			remove(path.c_str());
+		return false;
+	}
+	*outFormat = header.format;
+	return true;
+}
+
+
+bool SaveShaderCache(const char* name, unsigned long long key, unsigned int format, const void* data, size_t size)
+{
+	std::string path;
+	if (!data || size == 0 || !GetShaderCachePath(name, path))
+		return false;
+	FILE* file = fopen(path.c_str(), "wb");
+	if (!file)
+		return false;
+
+	ShaderCacheHeader header;
+	memcpy(header.magic, kShaderCacheMagic, sizeof(kShaderCacheMagic));
+	header.version = kShaderCacheVersion;
+	header.key = key;
+	header.dataHash = HashShaderCacheData(data, size, kShaderCacheHashSeed);
+	header.format = format;
+	header.dataSize = (unsigned int)size;
+	bool ok = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(data, size, 1, file) == 1;
+	ok = fclose(file) == 0 && ok;
+	// A partly written file would only fail the hash check, but don't leave it around
+	if (!ok)
+		remove(path.c_str());
+	return ok;
+}
+
+
+void DeleteShaderCache(const char* name)
+{
+	std::string path;
+	if (GetShaderCachePath(name, path))
+		remove(path.c_str());
+}
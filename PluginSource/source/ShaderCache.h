@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+// On-disk cache of compiled GPU programs (GL program binaries and the like), so that a warm start
+// skips compiling shaders from source. Scripts point it at a writable directory next to the player
+// data with SetShaderCacheDirectory; until they do, nothing gets cached.
+//
+// Every cache is one file, named after it. The file starts with a format version and the key of
+// what it was built from (a hash of the shader sources and the driver); a file that does not match
+// both, or whose contents are damaged, is a miss; damaged ones get deleted as well. Can be called
+// from any thread.
+
+enum { kShaderCacheVersion = 1 };
+
+void SetShaderCacheDirectory(const char* path);
+bool HasShaderCacheDirectory();
+
+// FNV-1a; chain calls, starting from kShaderCacheHashSeed, to hash several inputs into one key
+static const unsigned long long kShaderCacheHashSeed = 14695981039346656037ull;
+unsigned long long HashShaderCacheData(const void* data, size_t size, unsigned long long hash);
+unsigned long long HashShaderCacheString(const char* text, unsigned long long hash);
+
+// format is whatever the backend needs to interpret the data (e.g. the GL binary format)
+bool LoadShaderCache(const char* name, unsigned long long key, unsigned int* outFormat, std::vector<unsigned char>& outData);
+bool SaveShaderCache(const char* name, unsigned long long key, unsigned int format, const void* data, size_t size);
+// Drop a cache the driver turned down, so it does not get loaded again
+void DeleteShaderCache(const char* name);
@@ -0,0 +1,324 @@
+#include "VirtualTexture.h"
+#include "RenderAPI.h"
+#include "PluginProfiler.h"
+#include "MemoryStats.h"
+
+#include <algorithm>
+#include <functional>
+#include <math.h>
+#include <unordered_set>
+
+
+static bool IsPowerOfTwo(int v)
+{
+	return v > 0 && (v & (v - 1)) == 0;
+}
+
+
+static void ResizeStaging(std::vector<unsigned char>& buffer, size_t bytes)
+{
+	const size_t oldCapacity = buffer.capacity();
+	buffer.resize(bytes);
+	MemoryStatsResize(kMemBackendPlugin, kMemCategoryStaging, oldCapacity, buffer.capacity());
+}
+
+static void ReleaseStaging(std::vector<unsigned char>& buffer)
+{
+	MemoryStatsResize(kMemBackendPlugin, kMemCategoryStaging, buffer.capacity(), 0);
+	std::vector<unsigned char>().swap(buffer);
+}
+
+
+VirtualTexture::VirtualTexture()
+	: m_Generator(NULL)
+	, m_GeneratorUserData(NULL)
+{
+	Reset();
+	m_UploadBudgetBytes = 1024 * 1024;
+}
+
+
+void VirtualTexture::Reset()
+{
+	m_CacheTexture = NULL;
+	m_PageTableTexture = NULL;
+	m_PageSize = 0;
+	m_Border = 0;
+	m_SlotSize = 0;
+	m_SlotsX = 0;
+	m_SlotsY = 0;
+	m_PagesX = 0;
+	m_PagesY = 0;
+	m_MipCount = 0;
+	m_ResidentCount = 0;
+	m_UploadedBytes = 0;
+	m_PageTableDirtyMip = -1;
+	m_UpdateIndex = 0;
+	m_Slots.clear();
+	m_ResidentPages.clear();
+	m_Missing.clear();
+	ReleaseStaging(m_TileStaging);
+	ReleaseStaging(m_PageTableStaging);
+
+	std::lock_guard<std::mutex> lock(m_RequestMutex);
+	m_Requests.clear();
+}
+
+
+bool VirtualTexture::Configure(void* cacheTexture, int cacheWidth, int cacheHeight, void* pageTableTexture,
+	int virtualWidth, int virtualHeight, int pageSize, int border)
+{
+	Reset();
+
+	if (!cacheTexture || !pageTableTexture)
+		return false;
+	if (!IsPowerOfTwo(virtualWidth) || !IsPowerOfTwo(virtualHeight) || !IsPowerOfTwo(pageSize) || border < 0)
+		return false;
+
+	const int slotSize = pageSize + 2 * border;
+	const int slotsX = cacheWidth / slotSize;
+	const int slotsY = cacheHeight / slotSize;
+	const int pagesX = std::max(virtualWidth / pageSize, 1);
+	const int pagesY = std::max(virtualHeight / pageSize, 1);
+	// Need room for the pinned mip tail plus something to stream into, and the page
+	// coordinates have to fit into the packed feedback format.
+	if (slotsX * slotsY < 2 || slotsX > 255 || slotsY > 255 || pagesX > 4096 || pagesY > 4096)
+		return false;
+
+	int mipCount = 1;
+	while ((pagesX >> (mipCount - 1)) > 1 || (pagesY >> (mipCount - 1)) > 1)
+		++mipCount;
+
+	m_CacheTexture = cacheTexture;
+	m_PageTableTexture = pageTableTexture;
+	m_PageSize = pageSize;
+	m_Border = border;
+	m_SlotSize = slotSize;
+	m_SlotsX = slotsX;
+	m_SlotsY = slotsY;
+	m_PagesX = pagesX;
+	m_PagesY = pagesY;
+	m_MipCount = mipCount;
+
+	Slot emptySlot = { kNoPage, 0 };
+	m_Slots.assign(slotsX * slotsY, emptySlot);
+
+	// The mip tail goes in first, and is never evicted
+	m_Missing.push_back(PackPage(m_MipCount - 1, 0, 0));
+	return true;
+}
+
+
+bool VirtualTexture::IsValidPage(unsigned int page) const
+{
+	const int mip = page >> 24;
+	const int y = (page >> 12) & 0xFFF;
+	const int x = page & 0xFFF;
+	return mip < m_MipCount && x < PagesX(mip) && y < PagesY(mip);
+}
+
+
+void VirtualTexture::RequestPages(const unsigned int* feedback, int count)
+{
+	if (!feedback || count <= 0)
+		return;
+	std::lock_guard<std::mutex> lock(m_RequestMutex);
+	m_Requests.insert(m_Requests.end(), feedback, feedback + count);
+}
+
+
+void VirtualTexture::RequestRegion(float u0, float v0, float u1, float v1, int mipLevel)
+{
+	if (!IsConfigured() || mipLevel < 0 || mipLevel >= m_MipCount)
+		return;
+
+	const int pagesX = PagesX(mipLevel);
+	const int pagesY = PagesY(mipLevel);
+	const int x0 = std::max((int)floorf(std::min(u0, u1) * pagesX), 0);
+	const int y0 = std::max((int)floorf(std::min(v0, v1) * pagesY), 0);
+	const int x1 = std::min((int)ceilf(std::max(u0, u1) * pagesX), pagesX);
+	const int y1 = std::min((int)ceilf(std::max(v0, v1) * pagesY), pagesY);
+
+	std::lock_guard<std::mutex> lock(m_RequestMutex);
+	for (int y = y0; y < y1; ++y)
+		for (int x = x0; x < x1; ++x)
+			m_Requests.push_back(PackPage(mipLevel, x, y));
+}
+
+
+int VirtualTexture::AcquireSlot()
+{
+	// Free slot first, otherwise the least recently used one that was not requested in this update
+	int best = -1;
+	for (size_t i = 0; i < m_Slots.size(); ++i)
+	{
+		const Slot& slot = m_Slots[i];
+		if (slot.page == kNoPage)
+			return (int)i;
+		if (slot.lastUsed < m_UpdateIndex && (best < 0 || slot.lastUsed < m_Slots[best].lastUsed))
+			best = (int)i;
+	}
+	if (best < 0)
+		return -1;
+
+	// Evict; the page table falls back to a coarser page for it
+	const unsigned int evicted = m_Slots[best].page;
+	m_ResidentPages.erase(evicted);
+	--m_ResidentCount;
+	m_PageTableDirtyMip = std::max(m_PageTableDirtyMip, (int)(evicted >> 24));
+	m_Slots[best].page = kNoPage;
+	return best;
+}
+
+
+void VirtualTexture::UploadPage(RenderAPI* api, unsigned int page, int slot)
+{
+	const int mip = page >> 24;
+	const int pageY = (page >> 12) & 0xFFF;
+	const int pageX = page & 0xFFF;
+
+	const int rowPitch = m_SlotSize * 4;
+	ResizeStaging(m_TileStaging, rowPitch * m_SlotSize);
+	m_Generator(mip, pageX * m_PageSize - m_Border, pageY * m_PageSize - m_Border, m_SlotSize, m_SlotSize,
+		&m_TileStaging[0], rowPitch, m_GeneratorUserData);
+
+	const int slotX = slot % m_SlotsX;
+	const int slotY = slot / m_SlotsX;
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileUpdateTextureRegion);
+		api->UpdateTextureRegion(m_CacheTexture, 0, slotX * m_SlotSize, slotY * m_SlotSize, m_SlotSize, m_SlotSize, rowPitch, &m_TileStaging[0]);
+	}
+
+	const bool isMipTail = mip == m_MipCount - 1;
+	m_Slots[slot].page = page;
+	m_Slots[slot].lastUsed = isMipTail ? ~0ull : m_UpdateIndex;
+	m_ResidentPages[page] = slot;
+	++m_ResidentCount;
+	m_PageTableDirtyMip = std::max(m_PageTableDirtyMip, mip);
+}
+
+
+void VirtualTexture::UploadPageTable(RenderAPI* api)
+{
+	// Entries of a mip level fall back to the (already resolved) entries of the next coarser level,
+	// so build from the tail down. A change at mip N only affects levels N and finer, but the
+	// coarser levels still have to be resolved to get the fallbacks right.
+	size_t totalEntries = 0;
+	for (int mip = 0; mip < m_MipCount; ++mip)
+		totalEntries += PagesX(mip) * PagesY(mip);
+	ResizeStaging(m_PageTableStaging, totalEntries * 4);
+
+	std::vector<size_t> mipOffsets(m_MipCount);
+	size_t offset = 0;
+	for (int mip = 0; mip < m_MipCount; ++mip)
+	{
+		mipOffsets[mip] = offset;
+		offset += PagesX(mip) * PagesY(mip) * 4;
+	}
+
+	for (int mip = m_MipCount - 1; mip >= 0; --mip)
+	{
+		const int pagesX = PagesX(mip);
+		const int pagesY = PagesY(mip);
+		unsigned char* dst = &m_PageTableStaging[mipOffsets[mip]];
+		for (int y = 0; y < pagesY; ++y)
+		{
+			for (int x = 0; x < pagesX; ++x, dst += 4)
+			{
+				std::unordered_map<unsigned int, int>::const_iterator it = m_ResidentPages.find(PackPage(mip, x, y));
+				if (it != m_ResidentPages.end())
+				{
+					dst[0] = (unsigned char)(it->second % m_SlotsX);
+					dst[1] = (unsigned char)(it->second / m_SlotsX);
+					dst[2] = (unsigned char)mip;
+					dst[3] = 255;
+				}
+				else if (mip + 1 < m_MipCount)
+				{
+					const int parentX = std::min(x >> 1, PagesX(mip + 1) - 1);
+					const int parentY = std::min(y >> 1, PagesY(mip + 1) - 1);
+					const unsigned char* parent = &m_PageTableStaging[mipOffsets[mip + 1] + (parentY * PagesX(mip + 1) + parentX) * 4];
+					dst[0] = parent[0];
+					dst[1] = parent[1];
+					dst[2] = parent[2];
+					dst[3] = parent[3];
+				}
+				else
+				{
+					dst[0] = dst[1] = dst[2] = dst[3] = 0;
+				}
+			}
+		}
+	}
+
+	for (int mip = 0; mip <= m_PageTableDirtyMip; ++mip)
+	{
+		PLUGIN_PROFILE_SCOPE(kProfileUpdateTextureRegion);
+		api->UpdateTextureRegion(m_PageTableTexture, mip, 0, 0, PagesX(mip), PagesY(mip), PagesX(mip) * 4, &m_PageTableStaging[mipOffsets[mip]]);
+	}
+	m_PageTableDirtyMip = -1;
+}
+
+
+void VirtualTexture::Update(RenderAPI* api)
+{
+	m_UploadedBytes = 0;
+	if (!IsConfigured() || !m_Generator)
+		return;
+	++m_UpdateIndex;
+
+	std::vector<unsigned int> requests;
+	{
+		std::lock_guard<std::mutex> lock(m_RequestMutex);
+		requests.swap(m_Requests);
+	}
+
+	// Mark requested pages (and all their coarser ancestors, which serve as fallbacks) as used
+	// this update, and collect the ones that are not resident yet. Pages that did not fit into
+	// the budget earlier stay in the missing list.
+	std::unordered_set<unsigned int> missing(m_Missing.begin(), m_Missing.end());
+	for (size_t i = 0; i < requests.size(); ++i)
+	{
+		if (!IsValidPage(requests[i]))
+			continue;
+		const int mip = requests[i] >> 24;
+		const int pageY = (requests[i] >> 12) & 0xFFF;
+		const int pageX = requests[i] & 0xFFF;
+		for (int level = mip; level < m_MipCount; ++level)
+		{
+			const int shift = level - mip;
+			const unsigned int page = PackPage(level, std::min(pageX >> shift, PagesX(level) - 1), std::min(pageY >> shift, PagesY(level) - 1));
+			std::unordered_map<unsigned int, int>::const_iterator it = m_ResidentPages.find(page);
+			if (it != m_ResidentPages.end())
+			{
+				Slot& slot = m_Slots[it->second];
+				if (slot.lastUsed < m_UpdateIndex)
+					slot.lastUsed = m_UpdateIndex;
+			}
+			else
+				missing.insert(page);
+		}
+	}
+
+	// Coarse pages first, so fallbacks exist before their children get streamed in
+	m_Missing.assign(missing.begin(), missing.end());
+	std::sort(m_Missing.begin(), m_Missing.end(), std::greater<unsigned int>());
+
+	const int tileBytes = m_SlotSize * m_SlotSize * 4;
+	size_t uploaded = 0;
+	for (; uploaded < m_Missing.size(); ++uploaded)
+	{
+		// Always let at least one tile through, so a budget below the tile size still makes progress
+		if (m_UploadedBytes > 0 && m_UploadedBytes + tileBytes > m_UploadBudgetBytes)
+			break;
+		const int slot = AcquireSlot();
+		if (slot < 0)
+			break;
+		UploadPage(api, m_Missing[uploaded], slot);
+		m_UploadedBytes += tileBytes;
+	}
+	m_Missing.erase(m_Missing.begin(), m_Missing.begin() + uploaded);
+
+	if (m_PageTableDirtyMip >= 0)
+		UploadPageTable(api);
+}
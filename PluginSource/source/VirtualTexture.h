@@ -0,0 +1,106 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class RenderAPI;
+
+
+// Tiled "virtual texture" streaming for procedurally generated surfaces that are far too big to be
+// resident at full resolution (16k-32k texels on a side).
+//
+// The virtual texture is split into square pages. Only pages that were requested (from a GPU feedback
+// buffer read back by a script, or from a CPU-side region query) get generated and uploaded into slots
+// of a physical tile cache texture, within a per-frame upload budget. Least recently used slots get
+// recycled, so GPU memory is bounded by the size of the cache texture, not by the virtual size.
+//
+// A page table texture (one RGBA8 texel per page, with a mip chain matching the virtual texture's)
+// tells shaders where each page lives: R,G = cache slot x,y; B = mip level the slot actually holds;
+// A = 255. Pages that are not resident point to the closest resident coarser page instead, so
+// lookups always hit something valid. The mip tail -- the coarsest mip, which fits into a single
+// page -- is pinned in the cache for that reason. A shader samples the cache at
+//
+//   (slot * slotSize + border + frac(uv * pageCount(B)) * pageSize) / cacheSize
+//
+// where slotSize = pageSize + 2 * border; the border texels allow bilinear filtering across pages.
+class VirtualTexture
+{
+public:
+	// Fills a width x height RGBA8 block of the given virtual mip level, starting at virtual texel (x,y)
+	// of that mip. Coordinates can be outside of the mip level for border texels.
+	typedef void (*TileGenerator)(int mipLevel, int x, int y, int width, int height, unsigned char* dst, int rowPitch, void* userData);
+
+	VirtualTexture();
+
+	// Set up the textures. Virtual size and page size have to be powers of two; the page table texture
+	// needs (virtualSize / pageSize) texels on each side and a full mip chain. Returns false if the
+	// configuration can not be used.
+	bool Configure(void* cacheTexture, int cacheWidth, int cacheHeight, void* pageTableTexture,
+		int virtualWidth, int virtualHeight, int pageSize, int border);
+	void Reset();
+	bool IsConfigured() const { return m_CacheTexture != NULL; }
+
+	void SetGenerator(TileGenerator generator, void* userData) { m_Generator = generator; m_GeneratorUserData = userData; }
+	void SetUploadBudget(int bytesPerFrame) { m_UploadBudgetBytes = bytesPerFrame; }
+
+	// Page requests. These can be called from any thread; they are processed by the next Update.
+	// Feedback entries are packed as (mipLevel << 24) | (pageY << 12) | pageX.
+	void RequestPages(const unsigned int* feedback, int count);
+	// Request all pages of a mip level that cover the given UV rectangle (CPU-side camera query).
+	void RequestRegion(float u0, float v0, float u1, float v1, int mipLevel);
+
+	// Stream in requested pages and update the page table. Render thread only.
+	void Update(RenderAPI* api);
+
+	int GetResidentPageCount() const { return m_ResidentCount; }
+	int GetPendingPageCount() const { return (int)m_Missing.size(); }
+	int GetUploadedBytesLastUpdate() const { return m_UploadedBytes; }
+	int GetMipCount() const { return m_MipCount; }
+
+	static unsigned int PackPage(int mipLevel, int pageX, int pageY) { return (mipLevel << 24) | (pageY << 12) | pageX; }
+
+private:
+	struct Slot
+	{
+		unsigned int page;			// packed page key, or kNoPage
+		unsigned long long lastUsed;	// update index the page was last requested in
+	};
+	enum { kNoPage = 0xFFFFFFFF };
+
+	int PagesX(int mipLevel) const { int n = m_PagesX >> mipLevel; return n > 0 ? n : 1; }
+	int PagesY(int mipLevel) const { int n = m_PagesY >> mipLevel; return n > 0 ? n : 1; }
+	bool IsValidPage(unsigned int page) const;
+	int AcquireSlot();
+	void UploadPage(RenderAPI* api, unsigned int page, int slot);
+	void UploadPageTable(RenderAPI* api);
+
+private:
+	void*	m_CacheTexture;
+	void*	m_PageTableTexture;
+	int		m_PageSize;
+	int		m_Border;
+	int		m_SlotSize;
+	int		m_SlotsX;
+	int		m_SlotsY;
+	int		m_PagesX;
+	int		m_PagesY;
+	int		m_MipCount;
+	int		m_UploadBudgetBytes;
+	int		m_ResidentCount;
+	int		m_UploadedBytes;
+	int		m_PageTableDirtyMip;	// coarsest mip level with page table changes, -1 if none
+	unsigned long long m_UpdateIndex;
+
+	TileGenerator	m_Generator;
+	void*			m_GeneratorUserData;
+
+	std::vector<Slot>						m_Slots;
+	std::unordered_map<unsigned int, int>	m_ResidentPages;	// page key -> slot index
+	std::vector<unsigned int>				m_Missing;			// requested pages not resident yet, carried over frames
+	std::vector<unsigned char>				m_TileStaging;
+	std::vector<unsigned char>				m_PageTableStaging;
+
+	std::mutex					m_RequestMutex;
+	std::vector<unsigned int>	m_Requests;
+};
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+# Generates the plugin's GL dispatch table (source/GLLoaderFunctions.h/.cpp, see source/GLLoader.h):
+# one entry for every GL function the GL backend calls, each starting out at a stub that resolves
+# the function on first use. Prototypes come from the Khronos glcorearb.h.
+#
+# Run after the plugin starts calling a GL function it didn't call before; the output is checked in,
+# so building the plugin doesn't need Python:
+#
+#   make -C projects/GNUMake gl-loader
+#   python3 tools/GenerateGLLoader.py [--header source/gl3w/glcorearb.h] [--out source] [sources...]
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+DEFAULT_HEADER = os.path.join(ROOT, 'source', 'gl3w', 'glcorearb.h')
+DEFAULT_SOURCES = [os.path.join(ROOT, 'source', 'RenderAPI_OpenGLCoreES.cpp')]
+DEFAULT_OUT = os.path.join(ROOT, 'source')
+
+PROTOTYPE = re.compile(r'^GLAPI\s+(.+?)\s*APIENTRY\s+(gl\w+)\s*\((.*)\);', re.M)
+CALL = re.compile(r'\b(gl[A-Z]\w*)\s*\(')
+
+
+def parse_prototypes(header):
+    with open(header) as f:
+        text = f.read()
+    prototypes = {}
+    for ret, name, params in PROTOTYPE.findall(text):
+        params = params.strip()
+        if params in ('', 'void'):
+            names = []
+            params = 'void'
+        else:
+            # The parameter name is the last identifier of each declaration
+            names = [re.findall(r'\w+', p)[-1] for p in params.split(',')]
+        prototypes[name] = (ret.strip(), params, names)
+    return prototypes
+
+
+def find_calls(sources):
+    calls = set()
+    for path in sources:
+        with open(path) as f:
+            text = f.read()
+        # Comments mention functions the code doesn't call
+        text = re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.S)
+        calls.update(CALL.findall(text))
+    return calls
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, newline='') as f:
+            if f.read() == text:
+                return
+    with open(path, 'w', newline='\n') as f:
+        f.write(text)
+    print('wrote %s' % os.path.relpath(path, ROOT))
+
+
+def generate(prototypes, functions, sources, header):
+    source_names = ', '.join(os.path.basename(s) for s in sources)
+    banner = ('// Generated by tools/GenerateGLLoader.py from the GL calls in %s\n'
+              '// and the prototypes in %s; do not edit.\n' % (source_names, os.path.basename(header)))
+
+    h = [banner, '\n#pragma once\n\n// Included by GLLoader.h, after the GL headers\n\n']
+    for name in functions:
+        ret, params, _ = prototypes[name]
+        h.append('typedef %s (APIENTRY* GLLoaderProc_%s)(%s);\n' % (ret, name, params))
+    h.append('\nstruct GLLoaderDispatch\n{\n')
+    for name in functions:
+        h.append('\tGLLoaderProc_%s %s;\n' % (name, name[2:]))
+    h.append('};\n\nextern GLLoaderDispatch g_GLDispatch;\n\n')
+    for name in functions:
+        h.append('#define %s g_GLDispatch.%s\n' % (name, name[2:]))
+
+    cpp = [banner, '\n#include "GLLoader.h"\n\n#if SUPPORT_GL_LOADER\n\n#include <assert.h>\n\n\n']
+    cpp.append('// Every entry starts out at one of these: it puts the real function in the table and calls it.\n'
+               '// Threads racing through a stub store the same pointer, so that needs no lock.\n')
+    for name in functions:
+        ret, params, names = prototypes[name]
+        cpp.append('static %s APIENTRY Load_%s(%s)\n{\n' % (ret, name, params))
+        cpp.append('\tg_GLDispatch.%s = (GLLoaderProc_%s)GLLoaderGetProcAddress("%s");\n' % (name[2:], name, name))
+        cpp.append('\tassert(g_GLDispatch.%s);\n' % name[2:])
+        cpp.append('\treturn g_GLDispatch.%s(%s);\n}\n\n' % (name[2:], ', '.join(names)))
+    cpp.append('\nstatic const GLLoaderDispatch kLoaders =\n{\n')
+    for name in functions:
+        cpp.append('\tLoad_%s,\n' % name)
+    cpp.append('};\n\nGLLoaderDispatch g_GLDispatch = kLoaders;\n\n')
+    cpp.append('void GLLoaderReset()\n{\n\tg_GLDispatch = kLoaders;\n}\n\n#endif // if SUPPORT_GL_LOADER\n')
+    return ''.join(h), ''.join(cpp)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the GL dispatch table of the plugin')
+    parser.add_argument('--header', default=DEFAULT_HEADER, help='glcorearb.h to take prototypes from')
+    parser.add_argument('--out', default=DEFAULT_OUT, help='directory for GLLoaderFunctions.h/.cpp')
+    parser.add_argument('sources', nargs='*', default=DEFAULT_SOURCES, help='sources to scan for GL calls')
+    args = parser.parse_args()
+
+    prototypes = parse_prototypes(args.header)
+    calls = find_calls(args.sources)
+    # Calls the header doesn't know are platform specific (ES-only paths) or not GL at all
+    functions = sorted(c for c in calls if c in prototypes)
+    for c in sorted(calls - set(functions)):
+        print('skipped %s: not in %s' % (c, os.path.basename(args.header)), file=sys.stderr)
+
+    h, cpp = generate(prototypes, functions, args.sources, args.header)
+    write_if_changed(os.path.join(args.out, 'GLLoaderFunctions.h'), h)
+    write_if_changed(os.path.join(args.out, 'GLLoaderFunctions.cpp'), cpp)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,169 @@
+#include "HeadlessGL.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+static EGLDisplay s_Display = EGL_NO_DISPLAY;
+static EGLSurface s_Surface = EGL_NO_SURFACE;
+static EGLContext s_Context = EGL_NO_CONTEXT;
+
+
+static EGLDisplay OpenDisplay(bool* outSurfaceless)
+{
+	*outSurfaceless = false;
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay)
+	{
+		EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		if (display != EGL_NO_DISPLAY && eglInitialize(display, NULL, NULL))
+		{
+			*outSurfaceless = true;
+			return display;
+		}
+	}
+	EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (display != EGL_NO_DISPLAY && eglInitialize(display, NULL, NULL))
+		return display;
+	return EGL_NO_DISPLAY;
+}
+
+
+// Mesa creates the newest version it has, whatever was asked for; its override variables make it
+// stick to the requested one. They are read when eglInitialize creates the screen, and other drivers
+// ignore them.
+// Left alone when already set, so runs can pick a version from outside.
+static const char* OverrideMesaVersion(bool gles, int majorVersion, int minorVersion)
+{
+	const char* name = gles ? "MESA_GLES_VERSION_OVERRIDE" : "MESA_GL_VERSION_OVERRIDE";
+	if (majorVersion <= 0 || getenv(name))
+		return NULL;
+	char version[16];
+	snprintf(version, sizeof(version), "%d.%d", majorVersion, minorVersion);
+	setenv(name, version, 1);
+	return name;
+}
+
+
+bool CreateHeadlessGLContext(UnityGfxRenderer renderer, int majorVersion, int minorVersion)
+{
+	DestroyHeadlessGLContext();
+
+	const bool gles = renderer == kUnityGfxRendererOpenGLES20 || renderer == kUnityGfxRendererOpenGLES30;
+	if (!gles && renderer != kUnityGfxRendererOpenGLCore)
+		return false;
+	if (majorVersion <= 0)
+		majorVersion = renderer == kUnityGfxRendererOpenGLES20 ? 2 : gles ? 3 : 0;
+
+	const char* overridden = OverrideMesaVersion(gles, majorVersion, minorVersion);
+	bool surfaceless;
+	s_Display = OpenDisplay(&surfaceless);
+	if (overridden)
+		unsetenv(overridden);
+	if (s_Display == EGL_NO_DISPLAY)
+		return false;
+	if (!eglBindAPI(gles ? EGL_OPENGL_ES_API : EGL_OPENGL_API))
+	{
+		DestroyHeadlessGLContext();
+		return false;
+	}
+
+	const EGLint configAttribs[] =
+	{
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, renderer == kUnityGfxRendererOpenGLES20 ? EGL_OPENGL_ES2_BIT : gles ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_BIT,
+		EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+		EGL_DEPTH_SIZE, 24,
+		EGL_NONE
+	};
+	EGLConfig config = NULL;
+	EGLint configCount = 0;
+	if (!eglChooseConfig(s_Display, configAttribs, &config, 1, &configCount) || configCount < 1)
+	{
+		DestroyHeadlessGLContext();
+		return false;
+	}
+
+	if (gles)
+	{
+		const EGLint contextAttribs[] = { EGL_CONTEXT_MAJOR_VERSION, majorVersion, EGL_CONTEXT_MINOR_VERSION, minorVersion, EGL_NONE };
+		s_Context = eglCreateContext(s_Display, config, EGL_NO_CONTEXT, contextAttribs);
+	}
+	else
+	{
+		// Highest core version first, the plugin's GL paths check for features themselves
+		static const EGLint kVersions[][2] = { { 4, 5 }, { 4, 3 }, { 3, 2 } };
+		for (size_t i = 0; i < sizeof(kVersions) / sizeof(kVersions[0]) && s_Context == EGL_NO_CONTEXT; ++i)
+		{
+			const EGLint contextAttribs[] =
+			{
+				EGL_CONTEXT_MAJOR_VERSION, majorVersion > 0 ? majorVersion : kVersions[i][0],
+				EGL_CONTEXT_MINOR_VERSION, majorVersion > 0 ? minorVersion : kVersions[i][1],
+				EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+				EGL_NONE
+			};
+			s_Context = eglCreateContext(s_Display, config, EGL_NO_CONTEXT, contextAttribs);
+		}
+	}
+	if (s_Context == EGL_NO_CONTEXT)
+	{
+		DestroyHeadlessGLContext();
+		return false;
+	}
+
+	if (!surfaceless)
+	{
+		const EGLint surfaceAttribs[] = { EGL_WIDTH, 16, EGL_HEIGHT, 16, EGL_NONE };
+		s_Surface = eglCreatePbufferSurface(s_Display, config, surfaceAttribs);
+		if (s_Surface == EGL_NO_SURFACE)
+		{
+			DestroyHeadlessGLContext();
+			return false;
+		}
+	}
+
+	if (!eglMakeCurrent(s_Display, s_Surface, s_Surface, s_Context))
+	{
+		DestroyHeadlessGLContext();
+		return false;
+	}
+	return true;
+}
+
+
+void DestroyHeadlessGLContext()
+{
+	if (s_Display == EGL_NO_DISPLAY)
+		return;
+	eglMakeCurrent(s_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	if (s_Context != EGL_NO_CONTEXT)
+		eglDestroyContext(s_Display, s_Context);
+	if (s_Surface != EGL_NO_SURFACE)
+		eglDestroySurface(s_Display, s_Surface);
+	eglTerminate(s_Display);
+	s_Display = EGL_NO_DISPLAY;
+	s_Surface = EGL_NO_SURFACE;
+	s_Context = EGL_NO_CONTEXT;
+}
+
+
+const char* GetHeadlessGLRendererName()
+{
+	if (s_Context == EGL_NO_CONTEXT)
+		return "";
+	const char* name = (const char*)glGetString(GL_RENDERER);
+	return name ? name : "";
+}
+
+
+const char* GetHeadlessGLVersion()
+{
+	if (s_Context == EGL_NO_CONTEXT)
+		return "";
+	const char* version = (const char*)glGetString(GL_VERSION);
+	return version ? version : "";
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "../source/Unity/IUnityGraphics.h"
+
+// Window-less OpenGL context through EGL, for running the plugin's GL backend on build agents.
+// Uses the surfaceless platform when the driver has it (Mesa does, including its software
+// rasterizers), the default display with a tiny pbuffer otherwise.
+
+// Create a context for kUnityGfxRendererOpenGLCore, kUnityGfxRendererOpenGLES20 or
+// kUnityGfxRendererOpenGLES30, and make it current on the calling thread. majorVersion 0 asks for
+// the newest core version (4.5, falling back to 3.2) or the ES version the renderer stands for;
+// otherwise for exactly that version, which on Mesa also caps what the context reports. Newer
+// extensions stay visible either way, unless MESA_EXTENSION_MAX_YEAR hides them for the process.
+bool CreateHeadlessGLContext(UnityGfxRenderer renderer, int majorVersion, int minorVersion);
+void DestroyHeadlessGLContext();
+
+// GL_RENDERER and GL_VERSION of the current context, for reports
+const char* GetHeadlessGLRendererName();
+const char* GetHeadlessGLVersion();
@@ -0,0 +1,100 @@
+#include "HostInterfaces.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+
+struct GUIDLess
+{
+	bool operator()(const UnityInterfaceGUID& a, const UnityInterfaceGUID& b) const { return a < b; }
+};
+
+static std::map<UnityInterfaceGUID, IUnityInterface*, GUIDLess> s_Interfaces;
+
+static IUnityInterface* UNITY_INTERFACE_API HostGetInterface(UnityInterfaceGUID guid)
+{
+	std::map<UnityInterfaceGUID, IUnityInterface*, GUIDLess>::const_iterator it = s_Interfaces.find(guid);
+	return it != s_Interfaces.end() ? it->second : NULL;
+}
+
+static void UNITY_INTERFACE_API HostRegisterInterface(UnityInterfaceGUID guid, IUnityInterface* ptr)
+{
+	s_Interfaces[guid] = ptr;
+}
+
+static IUnityInterface* UNITY_INTERFACE_API HostGetInterfaceSplit(unsigned long long guidHigh, unsigned long long guidLow)
+{
+	return HostGetInterface(UnityInterfaceGUID(guidHigh, guidLow));
+}
+
+static void UNITY_INTERFACE_API HostRegisterInterfaceSplit(unsigned long long guidHigh, unsigned long long guidLow, IUnityInterface* ptr)
+{
+	HostRegisterInterface(UnityInterfaceGUID(guidHigh, guidLow), ptr);
+}
+
+
+static UnityGfxRenderer s_Renderer = kUnityGfxRendererNull;
+static std::vector<IUnityGraphicsDeviceEventCallback> s_DeviceCallbacks;
+static int s_NextEventID = 0;
+
+static UnityGfxRenderer UNITY_INTERFACE_API HostGetRenderer()
+{
+	return s_Renderer;
+}
+
+static void UNITY_INTERFACE_API HostRegisterDeviceEventCallback(IUnityGraphicsDeviceEventCallback callback)
+{
+	if (callback)
+		s_DeviceCallbacks.push_back(callback);
+}
+
+static void UNITY_INTERFACE_API HostUnregisterDeviceEventCallback(IUnityGraphicsDeviceEventCallback callback)
+{
+	s_DeviceCallbacks.erase(std::remove(s_DeviceCallbacks.begin(), s_DeviceCallbacks.end(), callback), s_DeviceCallbacks.end());
+}
+
+static int UNITY_INTERFACE_API HostReserveEventIDRange(int count)
+{
+	// Unity's own events live below this; start well clear of them
+	const int base = 0x10000 + s_NextEventID;
+	s_NextEventID += count;
+	return base;
+}
+
+
+IUnityInterfaces* HostInterfacesInit(UnityGfxRenderer renderer)
+{
+	static IUnityGraphics graphics;
+	graphics.GetRenderer = HostGetRenderer;
+	graphics.RegisterDeviceEventCallback = HostRegisterDeviceEventCallback;
+	graphics.UnregisterDeviceEventCallback = HostUnregisterDeviceEventCallback;
+	graphics.ReserveEventIDRange = HostReserveEventIDRange;
+
+	static IUnityInterfaces interfaces;
+	interfaces.GetInterface = HostGetInterface;
+	interfaces.RegisterInterface = HostRegisterInterface;
+	interfaces.GetInterfaceSplit = HostGetInterfaceSplit;
+	interfaces.RegisterInterfaceSplit = HostRegisterInterfaceSplit;
+	interfaces.Register<IUnityGraphics>(&graphics);
+
+	s_Renderer = renderer;
+	return &interfaces;
+}
+
+
+void HostSetRenderer(UnityGfxRenderer renderer)
+{
+	HostSendDeviceEvent(kUnityGfxDeviceEventShutdown);
+	s_Renderer = renderer;
+	HostSendDeviceEvent(kUnityGfxDeviceEventInitialize);
+}
+
+
+void HostSendDeviceEvent(UnityGfxDeviceEventType type)
+{
+	// Copy, callbacks may unregister themselves
+	std::vector<IUnityGraphicsDeviceEventCallback> callbacks = s_DeviceCallbacks;
+	for (size_t i = 0; i < callbacks.size(); ++i)
+		callbacks[i](type);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "../source/Unity/IUnityGraphics.h"
+
+// Minimal stand-in for the Unity side of the plugin interface: an IUnityInterfaces registry with
+// an IUnityGraphics in it. Used by the tools that run the plugin outside of the player.
+
+// Set up the registry; GetRenderer reports the given renderer.
+IUnityInterfaces* HostInterfacesInit(UnityGfxRenderer renderer);
+
+// Switch to another renderer, like Unity does on a device change: sends shutdown for the old device
+// and initialize for the new one to every registered callback.
+void HostSetRenderer(UnityGfxRenderer renderer);
+
+// Send a device event to every registered callback.
+void HostSendDeviceEvent(UnityGfxDeviceEventType type);
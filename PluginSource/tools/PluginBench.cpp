@@ -0,0 +1,1785 @@
+// Microbenchmarks for the plugin's CPU kernels and the RenderAPI entry points, against the null
+// device and (when an EGL driver is around, e.g. Mesa's software rasterizers) OpenGL Core, Core 3.2,
+// ES2 and ES3. The plugin sources are linked in statically, so the backends can be driven directly
+// as well.
+//
+// Each benchmark is calibrated to run for at least --min-time-ms per repetition, then repeated;
+// results (per iteration times for every repetition, plus mean/median/stddev/min/max) go out as
+// JSON, for tracking regressions between releases:
+//
+//   ./RenderingPluginBench --out bench.json
+//   ./RenderingPluginBench --backends null --filter ModifyTexture --repetitions 20
+//
+// Before a GL backend gets timed, its upload and draw paths run once on known data, and the results
+// are read back and compared with what went in; timing a path that silently broke is no use. Any
+// mismatch makes the tool exit with an error, so CI without a GPU catches those too.
+// Backend independent helpers (FrameRetireQueue.h, MemorySubAllocator.h) are checked the same way,
+// on plain data.
+//
+// Draw submission is timed with many draws per render event, one by one and batched (GL Core 4.3+
+// submits those with a single multi-draw-indirect call).
+//
+// Texture updates upload in the byte order the driver keeps the texture in; on GL Core the raw
+// upload in RGBA and BGRA is timed as well, which shows what a mismatch costs.
+//
+// On GL backends the texture update runs once more with the upload thread (GLUploadThread.h) on.
+// That moves the upload off the calling thread, which only shows in the times with a spare core.
+//
+// GL backends also get device startup timed, with the program binary cache (ShaderCache.h) cold
+// and warm; the cache lives in --shader-cache-dir.
+//
+// Block compression (BlockCompression.h) is timed on its own, per format and thread count, and
+// the compressed upload per format the backend takes. The driver decodes the uploaded blocks again
+// for the readback check (on ES by drawing the texture), which compares them with the source
+// within a tolerance.
+
+#include "HeadlessGL.h"
+#include "HostInterfaces.h"
+#include "../source/PlatformBase.h"
+#include "../source/BlockCompression.h"
+#include "../source/FrameRetireQueue.h"
+#include "../source/GLUploadThread.h"
+#include "../source/MemoryStats.h"
+#include "../source/MemorySubAllocator.h"
+#include "../source/RenderAPI.h"
+#include "../source/RenderAPI_Null.h"
+#include "../source/ShaderCache.h"
+
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+
+// Plugin exports, linked in statically
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTimeFromUnity(float t);
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTextureFromUnity(void* textureHandle, int w, int h);
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetTextureBlockFormatFromUnity(int format);
+extern "C" void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API SetMeshBuffersFromUnity(void* vertexBufferHandle, int vertexCount, float* sourceVertices, float* sourceNormals, float* sourceUV);
+extern "C" UnityRenderingEvent UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API GetRenderEventFunc();
+
+// Same values as RenderEventID in RenderingPlugin.cpp
+enum { kEventModifyTexture = 3, kEventModifyVertexBuffer = 4 };
+// Same layout as the plugin's MeshVertex
+enum { kMeshVertexSize = (3 + 3 + 4 + 2) * 4 };
+
+static const int kTextureSizes[] = { 256, 512, 1024, 2048 };
+static const int kVertexCounts[] = { 1024, 16384, 65536, 262144 };
+static const int kDrawCounts[] = { 1000, 10000 };
+static const int kCompressThreadCounts[] = { 1, 4 };
+
+#ifndef GL_ETC1_RGB8_OES
+#	define GL_ETC1_RGB8_OES 0x8D64
+#endif
+
+
+
+// --------------------------------------------------------------------------
+// Benchmark runner
+
+
+struct BenchOptions
+{
+	int repetitions;
+	double minTimeMs;
+	const char* filter;
+	const char* outPath;
+	std::vector<std::string> backends;
+};
+
+struct BenchResult
+{
+	std::string name;
+	std::string backend;
+	long long iterations;			// per repetition
+	double bytesPerIteration;
+	std::vector<double> nsPerIteration;	// one per repetition
+};
+
+static BenchOptions s_Options;
+static std::vector<BenchResult> s_Results;
+
+
+struct Benchmark
+{
+	virtual ~Benchmark() { }
+	virtual void Run() = 0;
+	// Called after each timed batch, inside the timing; GL benchmarks wait for the GPU here
+	virtual void Sync() { }
+};
+
+static double RunBatch(Benchmark& bench, long long iterations)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (long long i = 0; i < iterations; ++i)
+		bench.Run();
+	bench.Sync();
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void RunBenchmark(const std::string& name, const std::string& backend, double bytesPerIteration, Benchmark& bench)
+{
+	const std::string fullName = backend + "/" + name;
+	if (s_Options.filter && fullName.find(s_Options.filter) == std::string::npos)
+		return;
+
+	// Warm up (first touch of staging memory, driver resource creation), then find an iteration
+	// count that takes at least the minimum time
+	RunBatch(bench, 1);
+	const double minTimeNs = s_Options.minTimeMs * 1e6;
+	long long iterations = 1;
+	double elapsed = RunBatch(bench, iterations);
+	while (elapsed < minTimeNs && iterations < (1LL << 30))
+	{
+		const double scale = elapsed > 0.0 ? std::min(std::max(minTimeNs * 1.2 / elapsed, 2.0), 100.0) : 100.0;
+		iterations = (long long)(iterations * scale);
+		elapsed = RunBatch(bench, iterations);
+	}
+
+	BenchResult result;
+	result.name = name;
+	result.backend = backend;
+	result.iterations = iterations;
+	result.bytesPerIteration = bytesPerIteration;
+	for (int rep = 0; rep < s_Options.repetitions; ++rep)
+		result.nsPerIteration.push_back(RunBatch(bench, iterations) / iterations);
+
+	std::vector<double> sorted = result.nsPerIteration;
+	std::sort(sorted.begin(), sorted.end());
+	fprintf(stderr, "%-48s %10lld iters  median %12.1f ns  min %12.1f ns\n", fullName.c_str(), iterations, sorted[sorted.size() / 2], sorted.front());
+	s_Results.push_back(result);
+}
+
+
+
+// --------------------------------------------------------------------------
+// Benchmarks
+
+
+struct SyntheticMesh
+{
+	std::vector<float> positions;
+	std::vector<float> normals;
+	std::vector<float> uvs;
+};
+
+static void MakeMesh(int vertexCount, SyntheticMesh& mesh)
+{
+	mesh.positions.resize(vertexCount * 3);
+	mesh.normals.resize(vertexCount * 3);
+	mesh.uvs.resize(vertexCount * 2);
+	for (int i = 0; i < vertexCount; ++i)
+	{
+		mesh.positions[i * 3 + 0] = float(i % 256) * 0.1f;
+		mesh.positions[i * 3 + 1] = 0.0f;
+		mesh.positions[i * 3 + 2] = float(i / 256) * 0.1f;
+		mesh.normals[i * 3 + 0] = 0.0f;
+		mesh.normals[i * 3 + 1] = 1.0f;
+		mesh.normals[i * 3 + 2] = 0.0f;
+		mesh.uvs[i * 2 + 0] = float(i % 256) / 255.0f;
+		mesh.uvs[i * 2 + 1] = float(i / 256) / 255.0f;
+	}
+}
+
+
+// Resources the benchmarks run on: GL objects for the GL backends, dummy handles for the null device
+struct BackendResources
+{
+	UnityGfxRenderer renderer;
+	std::vector<unsigned char> nullHandles;
+
+	GLuint renderTargetTexture;
+	GLuint renderTargetFramebuffer;
+
+	explicit BackendResources(UnityGfxRenderer r) : renderer(r), nullHandles(64), renderTargetTexture(0), renderTargetFramebuffer(0) { }
+	bool IsGL() const { return renderer != kUnityGfxRendererNull; }
+
+	// Something for draws to render into; without a complete framebuffer GL draws only raise an
+	// error. Tiny, so that software rasterizers spend their time on submission rather than pixels.
+	enum { kRenderTargetSize = 4 };
+	void BindRenderTarget()
+	{
+		if (!IsGL() || renderTargetFramebuffer)
+			return;
+		glGenTextures(1, &renderTargetTexture);
+		glBindTexture(GL_TEXTURE_2D, renderTargetTexture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, kRenderTargetSize, kRenderTargetSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		glGenFramebuffers(1, &renderTargetFramebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, renderTargetFramebuffer);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, renderTargetTexture, 0);
+		glViewport(0, 0, kRenderTargetSize, kRenderTargetSize);
+	}
+	void ReleaseRenderTarget()
+	{
+		if (!renderTargetFramebuffer)
+			return;
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glDeleteFramebuffers(1, &renderTargetFramebuffer);
+		glDeleteTextures(1, &renderTargetTexture);
+		renderTargetFramebuffer = renderTargetTexture = 0;
+	}
+
+	void* CreateTexture(int size, int index)
+	{
+		if (!IsGL())
+			return &nullHandles[index];
+		GLuint tex = 0;
+		glGenTextures(1, &tex);
+		glBindTexture(GL_TEXTURE_2D, tex);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		return (void*)(size_t)tex;
+	}
+	// NULL where the driver doesn't have the format
+	void* CreateCompressedTexture(TextureBlockFormat format, int width, int height, int index)
+	{
+		if (!IsGL())
+			return &nullHandles[index];
+		const GLenum glFormat = GetCompressedFormat(format);
+		if (!glFormat)
+			return NULL;
+		while (glGetError() != GL_NO_ERROR) { }
+		GLuint tex = 0;
+		glGenTextures(1, &tex);
+		glBindTexture(GL_TEXTURE_2D, tex);
+		glCompressedTexImage2D(GL_TEXTURE_2D, 0, glFormat, width, height, 0, (GLsizei)GetBlockCompressedSize(format, width, height), NULL);
+		if (glGetError() != GL_NO_ERROR)
+		{
+			glDeleteTextures(1, &tex);
+			return NULL;
+		}
+		return (void*)(size_t)tex;
+	}
+	// Same mapping as the GL backend uses on ES
+	GLenum GetCompressedFormat(TextureBlockFormat format) const
+	{
+		const bool es2 = renderer == kUnityGfxRendererOpenGLES20;
+		switch (format)
+		{
+		case kBlockFormatBC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+		case kBlockFormatBC4: return GL_COMPRESSED_RED_RGTC1;
+		case kBlockFormatETC2RGB: return es2 ? GL_ETC1_RGB8_OES : GL_COMPRESSED_RGB8_ETC2;
+		case kBlockFormatEACR11: return es2 ? 0 : GL_COMPRESSED_R11_EAC;
+		default: return 0;
+		}
+	}
+	void DestroyTexture(void* handle)
+	{
+		if (!IsGL())
+			return;
+		GLuint tex = (GLuint)(size_t)handle;
+		glDeleteTextures(1, &tex);
+	}
+	void* CreateVertexBuffer(size_t size, int index)
+	{
+		if (!IsGL())
+		{
+			RegisterNullVertexBuffer(&nullHandles[index], size);
+			return &nullHandles[index];
+		}
+		GLuint vb = 0;
+		glGenBuffers(1, &vb);
+		glBindBuffer(GL_ARRAY_BUFFER, vb);
+		glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+		return (void*)(size_t)vb;
+	}
+	void DestroyVertexBuffer(void* handle)
+	{
+		if (!IsGL())
+		{
+			RegisterNullVertexBuffer(handle, 0);
+			return;
+		}
+		GLuint vb = (GLuint)(size_t)handle;
+		glDeleteBuffers(1, &vb);
+	}
+	void Sync()
+	{
+		if (IsGL())
+			glFinish();
+	}
+
+	// RGBA8 pixels of a texture, rows tightly packed, through a temporary framebuffer
+	void ReadTexture(void* handle, int width, int height, std::vector<unsigned char>& out)
+	{
+		GLuint framebuffer = 0;
+		glGenFramebuffers(1, &framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, (GLuint)(size_t)handle, 0);
+		out.resize((size_t)width * height * 4);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &out[0]);
+		glBindFramebuffer(GL_FRAMEBUFFER, renderTargetFramebuffer);
+		glDeleteFramebuffers(1, &framebuffer);
+	}
+	// False where buffers can't be read back (ES2)
+	bool ReadVertexBuffer(void* handle, size_t size, std::vector<unsigned char>& out)
+	{
+		if (renderer == kUnityGfxRendererOpenGLES20)
+			return false;
+		glBindBuffer(GL_ARRAY_BUFFER, (GLuint)(size_t)handle);
+		const void* mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, GL_MAP_READ_BIT);
+		if (mapped)
+			out.assign((const unsigned char*)mapped, (const unsigned char*)mapped + size);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		return mapped != NULL;
+	}
+};
+
+
+struct RenderEventBench : Benchmark
+{
+	BackendResources& res;
+	UnityRenderingEvent func;
+	int eventID;
+	float time;
+	RenderEventBench(BackendResources& r, int id) : res(r), func(GetRenderEventFunc()), eventID(id), time(0.0f) { }
+	virtual void Run()
+	{
+		// Advance time so every iteration computes new data
+		time += 1.0f / 60.0f;
+		SetTimeFromUnity(time);
+		func(eventID);
+	}
+	virtual void Sync() { res.Sync(); }
+};
+
+struct SetMeshBuffersBench : Benchmark
+{
+	void* handle;
+	int vertexCount;
+	SyntheticMesh& mesh;
+	SetMeshBuffersBench(void* h, int count, SyntheticMesh& m) : handle(h), vertexCount(count), mesh(m) { }
+	virtual void Run() { SetMeshBuffersFromUnity(handle, vertexCount, &mesh.positions[0], &mesh.normals[0], &mesh.uvs[0]); }
+};
+
+struct ModifyTextureBench : Benchmark
+{
+	BackendResources& res;
+	RenderAPI* api;
+	void* texture;
+	int size;
+	ModifyTextureBench(BackendResources& r, RenderAPI* a, void* t, int s) : res(r), api(a), texture(t), size(s) { }
+	virtual void Run()
+	{
+		int rowPitch = 0;
+		void* data = api->BeginModifyTexture(texture, size, size, &rowPitch);
+		if (data)
+			api->EndModifyTexture(texture, size, size, rowPitch, data);
+	}
+	virtual void Sync() { res.Sync(); }
+};
+
+// Like ModifyTextureBench, without waiting for each upload; the batch waits for the last one
+struct ModifyTextureAsyncBench : Benchmark
+{
+	BackendResources& res;
+	RenderAPI* api;
+	void* texture;
+	int size;
+	UploadTicket ticket;
+	ModifyTextureAsyncBench(BackendResources& r, RenderAPI* a, void* t, int s) : res(r), api(a), texture(t), size(s), ticket(0) { }
+	virtual void Run()
+	{
+		int rowPitch = 0;
+		void* data = api->BeginModifyTexture(texture, size, size, &rowPitch);
+		if (data)
+			ticket = api->EndModifyTextureAsync(texture, size, size, rowPitch, data);
+		api->PollCompletedUploads();
+	}
+	virtual void Sync()
+	{
+		api->WaitForUpload(ticket);
+		res.Sync();
+	}
+};
+
+// The driver's upload alone, in a given client format; against an RGBA8 texture, the format that
+// isn't the driver's own costs a swizzle on every upload (GL Core only, ES has no BGRA uploads)
+struct TexSubImageBench : Benchmark
+{
+	BackendResources& res;
+	GLuint texture;
+	GLenum format;
+	int size;
+	std::vector<unsigned char> data;
+	TexSubImageBench(BackendResources& r, void* t, GLenum f, int s) : res(r), texture((GLuint)(size_t)t), format(f), size(s), data((size_t)s * s * 4) { }
+	virtual void Run()
+	{
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size, size, format, GL_UNSIGNED_BYTE, &data[0]);
+	}
+	virtual void Sync() { res.Sync(); }
+};
+
+struct UpdateTextureRegionBench : Benchmark
+{
+	BackendResources& res;
+	RenderAPI* api;
+	void* texture;
+	int size;
+	std::vector<unsigned char> data;
+	UpdateTextureRegionBench(BackendResources& r, RenderAPI* a, void* t, int s) : res(r), api(a), texture(t), size(s), data((size_t)s * s * 4) { }
+	virtual void Run() { api->UpdateTextureRegion(texture, 0, 0, 0, size, size, size * 4, &data[0]); }
+	virtual void Sync() { res.Sync(); }
+};
+
+// Smooth gradients with a few hard edges, roughly what the plugin's texture kernel makes; noise
+// would only measure how badly 4x4 blocks do on noise
+static void FillSmoothPattern(unsigned char* data, int width, int height, int rowPitch)
+{
+	for (int y = 0; y < height; ++y)
+	{
+		unsigned char* row = data + (size_t)y * rowPitch;
+		for (int x = 0; x < width; ++x)
+		{
+			const float fx = float(x) / width, fy = float(y) / height;
+			const bool band = ((x / 24) + (y / 40)) % 3 == 0;
+			row[x * 4 + 0] = (unsigned char)(128.0f + 127.0f * sinf(fx * 9.0f + fy * 3.0f));
+			row[x * 4 + 1] = (unsigned char)(255.0f * fy);
+			row[x * 4 + 2] = band ? 230 : (unsigned char)(200.0f * fx);
+			row[x * 4 + 3] = 255;
+		}
+	}
+}
+
+static const char* GetBlockFormatName(TextureBlockFormat format)
+{
+	switch (format)
+	{
+	case kBlockFormatBC1: return "BC1";
+	case kBlockFormatBC4: return "BC4";
+	case kBlockFormatETC2RGB: return "ETC2RGB";
+	case kBlockFormatEACR11: return "EACR11";
+	default: return "None";
+	}
+}
+
+struct CompressTextureBench : Benchmark
+{
+	BlockCompressor& compressor;
+	TextureBlockFormat format;
+	int size;
+	std::vector<unsigned char> pixels;
+	std::vector<unsigned char> blocks;
+	CompressTextureBench(BlockCompressor& c, TextureBlockFormat f, int s)
+		: compressor(c), format(f), size(s), pixels((size_t)s * s * 4), blocks(GetBlockCompressedSize(f, s, s))
+	{
+		FillSmoothPattern(&pixels[0], size, size, size * 4);
+	}
+	virtual void Run() { compressor.Compress(format, &pixels[0], size, size, size * 4, &blocks[0]); }
+};
+
+// Uploads blocks compressed once up front, so this times the upload alone
+struct UpdateCompressedTextureBench : Benchmark
+{
+	BackendResources& res;
+	RenderAPI* api;
+	void* texture;
+	TextureBlockFormat format;
+	int size;
+	std::vector<unsigned char> blocks;
+	UploadTicket ticket;
+	UpdateCompressedTextureBench(BackendResources& r, RenderAPI* a, void* t, TextureBlockFormat f, int s, const std::vector<unsigned char>& b)
+		: res(r), api(a), texture(t), format(f), size(s), blocks(b), ticket(0) { }
+	virtual void Run()
+	{
+		ticket = api->UpdateCompressedTexture(texture, size, size, format, &blocks[0], blocks.size());
+		api->PollCompletedUploads();
+	}
+	virtual void Sync()
+	{
+		api->WaitForUpload(ticket);
+		res.Sync();
+	}
+};
+
+struct ModifyVertexBufferBench : Benchmark
+{
+	BackendResources& res;
+	RenderAPI* api;
+	void* buffer;
+	ModifyVertexBufferBench(BackendResources& r, RenderAPI* a, void* b) : res(r), api(a), buffer(b) { }
+	virtual void Run()
+	{
+		size_t size = 0;
+		if (api->BeginModifyVertexBuffer(buffer, &size))
+			api->EndModifyVertexBuffer(buffer);
+	}
+	virtual void Sync() { res.Sync(); }
+};
+
+
+// Many one triangle draws in one render event, each with its own world matrix: either one by one,
+// or through the backend's batched path. Times submission only; there's no Sync, the streaming
+// buffer throttles once the GPU falls behind.
+struct DrawTrianglesBench : Benchmark
+{
+	RenderAPI* api;
+	bool batched;
+	std::vector<float> matrices;
+	std::vector<SimpleTriangleDraw> draws;
+	DrawTrianglesBench(RenderAPI* a, int drawCount, bool b) : api(a), batched(b), matrices(drawCount * 16), draws(drawCount)
+	{
+		static const struct { float x, y, z; unsigned int color; } triangle[3] =
+		{
+			{ -0.5f, -0.25f, 0, 0xFFff0000 }, { 0.5f, -0.25f, 0, 0xFF00ff00 }, { 0, 0.5f, 0, 0xFF0000ff },
+		};
+		for (int i = 0; i < drawCount; ++i)
+		{
+			float* m = &matrices[i * 16];
+			for (int j = 0; j < 16; ++j)
+				m[j] = (j % 5) == 0 ? 1.0f : 0.0f;
+			m[12] = float(i % 100) * 0.01f - 0.5f;
+			m[13] = float(i / 100 % 100) * 0.01f - 0.5f;
+			draws[i].worldMatrix = m;
+			draws[i].triangleCount = 1;
+			draws[i].verticesFloat3Byte4 = triangle;
+		}
+	}
+	virtual void Run()
+	{
+		api->BeginRenderEvent();
+		if (batched)
+			api->DrawSimpleTrianglesBatch(&draws[0], (int)draws.size());
+		else
+			api->RenderAPI::DrawSimpleTrianglesBatch(&draws[0], (int)draws.size());
+		api->EndRenderEvent();
+	}
+};
+
+
+// Same names as the GL backend's GetProgramCacheName
+static const char* GetProgramCacheName(UnityGfxRenderer renderer)
+{
+	switch (renderer)
+	{
+	case kUnityGfxRendererOpenGLES20: return "gles2_simple_program";
+	case kUnityGfxRendererOpenGLES30: return "gles3_simple_program";
+	default: return "glcore_simple_program";
+	}
+}
+
+// Device initialization up to the first draw, which is when the GL backend creates its program
+struct DeviceStartupBench : Benchmark
+{
+	BackendResources& res;
+	UnityGfxRenderer renderer;
+	IUnityInterfaces* interfaces;
+	const char* cacheName;	// what the GL backend calls its program cache
+	bool coldCache;
+	DeviceStartupBench(BackendResources& r, IUnityInterfaces* i, bool cold)
+		: res(r), renderer(r.renderer), interfaces(i), cacheName(GetProgramCacheName(r.renderer)), coldCache(cold) { }
+	virtual void Run()
+	{
+		if (coldCache)
+			DeleteShaderCache(cacheName);
+		RenderAPI* api = CreateRenderAPI(renderer);
+		api->ProcessDeviceEvent(kUnityGfxDeviceEventInitialize, interfaces);
+		const float identity[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+		const struct { float x, y, z; unsigned int color; } triangle[3] =
+		{
+			{ -0.5f, -0.25f, 0, 0xFFff0000 }, { 0.5f, -0.25f, 0, 0xFF00ff00 }, { 0, 0.5f, 0, 0xFF0000ff },
+		};
+		api->DrawSimpleTriangles(identity, 1, triangle);
+		res.Sync();
+		api->ProcessDeviceEvent(kUnityGfxDeviceEventShutdown, interfaces);
+		delete api;
+	}
+};
+
+
+// --------------------------------------------------------------------------
+// Readback checks
+
+
+static int s_CheckFailures = 0;
+
+static void ReportCheck(const char* backend, const char* name, int mismatches)
+{
+	if (mismatches < 0)
+	{
+		fprintf(stderr, "check %s/%s: skipped\n", backend, name);
+		return;
+	}
+	if (mismatches == 0)
+	{
+		fprintf(stderr, "check %s/%s: ok\n", backend, name);
+		return;
+	}
+	fprintf(stderr, "check %s/%s: FAILED, %d mismatches\n", backend, name, mismatches);
+	++s_CheckFailures;
+}
+
+// Different for every pixel and every seed, with all four channels in use
+static unsigned int PatternPixel(int x, int y, int seed)
+{
+	return ((unsigned int)(x * 7 + y * 13 + seed * 31) * 2654435761u) | 0x01010101u;
+}
+
+static void FillPattern(unsigned char* data, int width, int height, int rowPitch, int seed)
+{
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			const unsigned int pixel = PatternPixel(x, y, seed);
+			memcpy(data + (size_t)y * rowPitch + x * 4, &pixel, 4);
+		}
+	}
+}
+
+// Pixels of a readback that are not the pattern; within the rectangle the pattern is seed, outside
+// of it outsideSeed
+static int CountPatternMismatches(const std::vector<unsigned char>& pixels, int width, int height, int seed,
+	int rectX, int rectY, int rectWidth, int rectHeight, int outsideSeed)
+{
+	int mismatches = 0;
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			const bool inside = x >= rectX && x < rectX + rectWidth && y >= rectY && y < rectY + rectHeight;
+			const unsigned int expected = inside ? PatternPixel(x - rectX, y - rectY, seed) : PatternPixel(x, y, outsideSeed);
+			if (memcmp(&pixels[((size_t)y * width + x) * 4], &expected, 4) != 0)
+				++mismatches;
+		}
+	}
+	return mismatches;
+}
+
+static int CountPatternMismatches(const std::vector<unsigned char>& pixels, int width, int height, int seed)
+{
+	return CountPatternMismatches(pixels, width, height, seed, 0, 0, width, height, seed);
+}
+
+static void* CreateCheckTexture(int width, int height)
+{
+	GLuint tex = 0;
+	glGenTextures(1, &tex);
+	glBindTexture(GL_TEXTURE_2D, tex);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	return (void*)(size_t)tex;
+}
+
+// For what ES can't read back directly, the checks draw it and read the framebuffer. GLSL ES 1.00,
+// which ES 3 contexts take as well; vertex attributes a0 and a1 are at locations 0 and 1. Returns 0
+// if the program does not build.
+static GLuint CreateCheckProgram(const char* vertexSource, const char* fragmentSource)
+{
+	const char* sources[2] = { vertexSource, fragmentSource };
+	const GLenum types[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+	const GLuint program = glCreateProgram();
+	for (int i = 0; i < 2; ++i)
+	{
+		const GLuint shader = glCreateShader(types[i]);
+		glShaderSource(shader, 1, &sources[i], NULL);
+		glCompileShader(shader);
+		glAttachShader(program, shader);
+		glDeleteShader(shader);
+	}
+	glBindAttribLocation(program, 0, "a0");
+	glBindAttribLocation(program, 1, "a1");
+	glLinkProgram(program);
+	GLint linked = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &linked);
+	if (!linked)
+	{
+		glDeleteProgram(program);
+		return 0;
+	}
+	glUseProgram(program);
+	glDisable(GL_BLEND);
+	glDisable(GL_CULL_FACE);
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_SCISSOR_TEST);
+	return program;
+}
+
+// A render target for CreateCheckProgram draws, bound with its viewport; ReadPixels reads it as
+// RGBA8, rows tightly packed, and puts the benchmark's render target back
+struct CheckRenderTarget
+{
+	BackendResources& res;
+	int width, height;
+	void* texture;
+	GLuint framebuffer;
+
+	CheckRenderTarget(BackendResources& r, int w, int h)
+		: res(r), width(w), height(h), texture(CreateCheckTexture(w, h)), framebuffer(0)
+	{
+		glGenFramebuffers(1, &framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, (GLuint)(size_t)texture, 0);
+		glViewport(0, 0, width, height);
+		glClearColor(0, 0, 0, 0);
+		glClear(GL_COLOR_BUFFER_BIT);
+	}
+	~CheckRenderTarget()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, res.renderTargetFramebuffer);
+		glViewport(0, 0, BackendResources::kRenderTargetSize, BackendResources::kRenderTargetSize);
+		glDeleteFramebuffers(1, &framebuffer);
+		res.DestroyTexture(texture);
+	}
+	void ReadPixels(std::vector<unsigned char>& out)
+	{
+		out.resize((size_t)width * height * 4);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &out[0]);
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	}
+};
+
+// Texels of a texture that can't be a framebuffer attachment (a compressed one), drawn with
+// nearest filtering over a target of its size, one fragment per texel
+static bool ReadTextureByDrawing(BackendResources& res, void* texture, int width, int height, std::vector<unsigned char>& out)
+{
+	static const char kVertexSource[] =
+		"attribute vec2 a0;\n"
+		"varying vec2 uv;\n"
+		"void main() { uv = a0 * 0.5 + 0.5; gl_Position = vec4(a0, 0.0, 1.0); }\n";
+	static const char kFragmentSource[] =
+		"precision mediump float;\n"
+		"uniform sampler2D tex;\n"
+		"varying vec2 uv;\n"
+		"void main() { gl_FragColor = texture2D(tex, uv); }\n";
+	static const float kQuad[] = { -1, -1, 1, -1, -1, 1, 1, 1 };
+
+	CheckRenderTarget target(res, width, height);
+	const GLuint program = CreateCheckProgram(kVertexSource, kFragmentSource);
+	if (!program)
+		return false;
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, (GLuint)(size_t)texture);
+	// No mipmaps and not a power of two: anything else leaves the texture incomplete on ES2
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glUniform1i(glGetUniformLocation(program, "tex"), 0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, kQuad);
+	glEnableVertexAttribArray(0);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	glDisableVertexAttribArray(0);
+	glUseProgram(0);
+	glDeleteProgram(program);
+	target.ReadPixels(out);
+	return true;
+}
+
+
+// Texture updates through BeginModifyTexture and the given end call: 0 sync, 1 async, 2 async on
+// the upload thread. Several rounds, so every upload buffer gets reused at least once.
+static int CheckModifyTexture(BackendResources& res, RenderAPI* api, int mode)
+{
+	// Non-square, to catch mixed up dimensions
+	const int kWidth = 96, kHeight = 64, kRounds = 5;
+	void* texture = CreateCheckTexture(kWidth, kHeight);
+	SetGLUploadThreadEnabled(mode == 2);
+
+	int mismatches = 0;
+	std::vector<unsigned char> pixels;
+	for (int round = 0; round < kRounds; ++round)
+	{
+		int rowPitch = 0;
+		unsigned char* data = (unsigned char*)api->BeginModifyTexture(texture, kWidth, kHeight, &rowPitch);
+		if (!data)
+		{
+			mismatches = kWidth * kHeight;
+			break;
+		}
+		FillPattern(data, kWidth, kHeight, rowPitch, round);
+		if (mode == 0)
+			api->EndModifyTexture(texture, kWidth, kHeight, rowPitch, data);
+		else if (!api->WaitForUpload(api->EndModifyTextureAsync(texture, kWidth, kHeight, rowPitch, data)))
+		{
+			mismatches = kWidth * kHeight;
+			break;
+		}
+		res.ReadTexture(texture, kWidth, kHeight, pixels);
+		// The pattern went in the texture's byte order; reads come back as RGBA
+		if (api->GetTexturePixelLayout(texture) == kTexturePixelBGRA8)
+		{
+			for (size_t i = 0; i < pixels.size(); i += 4)
+				std::swap(pixels[i], pixels[i + 2]);
+		}
+		mismatches += CountPatternMismatches(pixels, kWidth, kHeight, round);
+	}
+
+	SetGLUploadThreadEnabled(false);
+	res.DestroyTexture(texture);
+	return mismatches;
+}
+
+// A whole texture, then a rectangle in it from rows with padding (tightly packed on ES2, which
+// can't skip padding)
+static int CheckUpdateTextureRegion(BackendResources& res, RenderAPI* api)
+{
+	const int kSize = 64, kRectX = 5, kRectY = 9, kRectWidth = 23, kRectHeight = 17;
+	void* texture = CreateCheckTexture(kSize, kSize);
+	std::vector<unsigned char> data(kSize * kSize * 4);
+	FillPattern(&data[0], kSize, kSize, kSize * 4, 0);
+	api->UpdateTextureRegion(texture, 0, 0, 0, kSize, kSize, kSize * 4, &data[0]);
+
+	const int rowPitch = res.renderer == kUnityGfxRendererOpenGLES20 ? kRectWidth * 4 : (kRectWidth + 3) * 4;
+	std::vector<unsigned char> rect(rowPitch * kRectHeight, 0xCD);
+	FillPattern(&rect[0], kRectWidth, kRectHeight, rowPitch, 1);
+	api->UpdateTextureRegion(texture, 0, kRectX, kRectY, kRectWidth, kRectHeight, rowPitch, &rect[0]);
+
+	std::vector<unsigned char> pixels;
+	res.ReadTexture(texture, kSize, kSize, pixels);
+	res.DestroyTexture(texture);
+	return CountPatternMismatches(pixels, kSize, kSize, 1, kRectX, kRectY, kRectWidth, kRectHeight, 0);
+}
+
+// Draws every vertex of a buffer of CheckModifyVertexBuffer's layout as a point, for ES2, which
+// can't map buffers for reading
+static bool ReadVertexBufferByDrawing(BackendResources& res, void* buffer, int gridSize, std::vector<unsigned char>& out)
+{
+	static const char kVertexSource[] =
+		"attribute vec2 a0;\n"
+		"attribute vec4 a1;\n"
+		"varying vec4 color;\n"
+		"void main() { color = a1; gl_Position = vec4(a0, 0.0, 1.0); gl_PointSize = 1.0; }\n";
+	static const char kFragmentSource[] =
+		"precision mediump float;\n"
+		"varying vec4 color;\n"
+		"void main() { gl_FragColor = color; }\n";
+
+	CheckRenderTarget target(res, gridSize, gridSize);
+	const GLuint program = CreateCheckProgram(kVertexSource, kFragmentSource);
+	if (!program)
+		return false;
+	glBindBuffer(GL_ARRAY_BUFFER, (GLuint)(size_t)buffer);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 12, (const void*)0);
+	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 12, (const void*)8);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glDrawArrays(GL_POINTS, 0, gridSize * gridSize);
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+	glDeleteProgram(program);
+	target.ReadPixels(out);
+	return true;
+}
+
+// Fills the buffer with one vertex per pixel of a square grid: float2 clip space position at the
+// pixel's center, then the pattern color. Read back directly where the buffer can be mapped;
+// drawn as points on ES2, where the update goes through the backend's staging copy and orphaning
+// glBufferData. Two rounds, so the second update replaces contents a draw already used. Returns -1
+// where the backend can't hand out the buffer's memory.
+static int CheckModifyVertexBuffer(BackendResources& res, RenderAPI* api)
+{
+	const int kGridSize = 128, kVertexSize = 12, kRounds = 2;
+	const size_t kSize = (size_t)kGridSize * kGridSize * kVertexSize;
+	void* buffer = res.CreateVertexBuffer(kSize, 4);
+	std::vector<unsigned char> expected(kSize);
+	std::vector<unsigned char> readback;
+	int mismatches = 0;
+	for (int round = 0; round < kRounds && mismatches >= 0; ++round)
+	{
+		for (int y = 0; y < kGridSize; ++y)
+		{
+			for (int x = 0; x < kGridSize; ++x)
+			{
+				unsigned char* vertex = &expected[((size_t)y * kGridSize + x) * kVertexSize];
+				const float position[2] = { (x + 0.5f) * 2.0f / kGridSize - 1.0f, (y + 0.5f) * 2.0f / kGridSize - 1.0f };
+				const unsigned int color = PatternPixel(x, y, round);
+				memcpy(vertex, position, sizeof(position));
+				memcpy(vertex + 8, &color, 4);
+			}
+		}
+
+		size_t size = 0;
+		unsigned char* data = (unsigned char*)api->BeginModifyVertexBuffer(buffer, &size);
+		if (!data)
+		{
+			mismatches = -1;
+			break;
+		}
+		if (size != kSize)
+		{
+			api->EndModifyVertexBuffer(buffer);
+			mismatches = (int)kSize;
+			break;
+		}
+		memcpy(data, &expected[0], kSize);
+		api->EndModifyVertexBuffer(buffer);
+
+		if (res.ReadVertexBuffer(buffer, kSize, readback))
+		{
+			for (size_t i = 0; i < kSize; ++i)
+				mismatches += readback[i] != expected[i];
+		}
+		else if (ReadVertexBufferByDrawing(res, buffer, kGridSize, readback))
+			mismatches += CountPatternMismatches(readback, kGridSize, kGridSize, round);
+		else
+			mismatches += kGridSize * kGridSize;
+	}
+	res.DestroyVertexBuffer(buffer);
+	return mismatches;
+}
+
+// Solid colored quads, one per quadrant of a small render target, drawn one by one or batched;
+// each quadrant has to come out in its color
+static int CheckDrawSimpleTriangles(BackendResources& res, RenderAPI* api, bool batched)
+{
+	const int kSize = 16;
+	struct Vertex { float x, y, z; unsigned int color; };
+	static const unsigned int kColors[4] = { 0xFF0000FFu, 0xFF00FF00u, 0xFFFF0000u, 0xFF00FFFFu };
+	// Quad over the lower left quadrant of clip space (z 0.5 is the middle of the depth range);
+	// the world matrices move it to the other ones
+	Vertex vertices[4][6];
+	float matrices[4][16];
+	SimpleTriangleDraw draws[4];
+	for (int q = 0; q < 4; ++q)
+	{
+		const Vertex corners[4] = { { -1, -1, 0.5f, kColors[q] }, { 0, -1, 0.5f, kColors[q] }, { 0, 0, 0.5f, kColors[q] }, { -1, 0, 0.5f, kColors[q] } };
+		const int order[6] = { 0, 1, 2, 0, 2, 3 };
+		for (int v = 0; v < 6; ++v)
+			vertices[q][v] = corners[order[v]];
+		for (int j = 0; j < 16; ++j)
+			matrices[q][j] = (j % 5) == 0 ? 1.0f : 0.0f;
+		matrices[q][12] = float(q & 1);
+		matrices[q][13] = float(q >> 1);
+		draws[q].worldMatrix = matrices[q];
+		draws[q].triangleCount = 2;
+		draws[q].verticesFloat3Byte4 = vertices[q];
+	}
+
+	void* target = CreateCheckTexture(kSize, kSize);
+	GLuint framebuffer = 0;
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, (GLuint)(size_t)target, 0);
+	glViewport(0, 0, kSize, kSize);
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	api->BeginRenderEvent();
+	if (batched)
+		api->DrawSimpleTrianglesBatch(draws, 4);
+	else
+	{
+		for (int q = 0; q < 4; ++q)
+			api->DrawSimpleTriangles(draws[q].worldMatrix, draws[q].triangleCount, draws[q].verticesFloat3Byte4);
+	}
+	api->EndRenderEvent();
+
+	std::vector<unsigned char> pixels(kSize * kSize * 4);
+	glReadPixels(0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+	int mismatches = 0;
+	for (int y = 0; y < kSize; ++y)
+	{
+		for (int x = 0; x < kSize; ++x)
+		{
+			const unsigned int expected = kColors[(x >= kSize / 2 ? 1 : 0) + (y >= kSize / 2 ? 2 : 0)];
+			if (memcmp(&pixels[(y * kSize + x) * 4], &expected, 4) != 0)
+				++mismatches;
+		}
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, res.renderTargetFramebuffer);
+	glViewport(0, 0, BackendResources::kRenderTargetSize, BackendResources::kRenderTargetSize);
+	glDeleteFramebuffers(1, &framebuffer);
+	res.DestroyTexture(target);
+	return mismatches;
+}
+
+// Quads in three quadrants of one render event, the middle draw big enough to make the backend
+// replace its stream buffer while the first draw's vertices are still in the old one
+static int CheckStreamBufferGrowth(BackendResources& res, RenderAPI* api)
+{
+	const int kSize = 16, kBigQuadCopies = 4096;
+	struct Vertex { float x, y, z; unsigned int color; };
+	static const unsigned int kColors[3] = { 0xFF0000FFu, 0xFF00FF00u, 0xFFFF0000u };
+	std::vector<Vertex> vertices[3];
+	float matrices[3][16];
+	for (int q = 0; q < 3; ++q)
+	{
+		const Vertex corners[4] = { { -1, -1, 0.5f, kColors[q] }, { 0, -1, 0.5f, kColors[q] }, { 0, 0, 0.5f, kColors[q] }, { -1, 0, 0.5f, kColors[q] } };
+		const int order[6] = { 0, 1, 2, 0, 2, 3 };
+		const int copies = q == 1 ? kBigQuadCopies : 1;
+		for (int c = 0; c < copies; ++c)
+		{
+			for (int v = 0; v < 6; ++v)
+				vertices[q].push_back(corners[order[v]]);
+		}
+		for (int j = 0; j < 16; ++j)
+			matrices[q][j] = (j % 5) == 0 ? 1.0f : 0.0f;
+		matrices[q][12] = float(q & 1);
+		matrices[q][13] = float(q >> 1);
+	}
+
+	void* target = CreateCheckTexture(kSize, kSize);
+	GLuint framebuffer = 0;
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, (GLuint)(size_t)target, 0);
+	glViewport(0, 0, kSize, kSize);
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	api->BeginRenderEvent();
+	for (int q = 0; q < 3; ++q)
+		api->DrawSimpleTriangles(matrices[q], (int)vertices[q].size() / 3, &vertices[q][0]);
+	api->EndRenderEvent();
+
+	std::vector<unsigned char> pixels(kSize * kSize * 4);
+	glReadPixels(0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+	int mismatches = 0;
+	for (int y = 0; y < kSize; ++y)
+	{
+		for (int x = 0; x < kSize; ++x)
+		{
+			const int q = (x >= kSize / 2 ? 1 : 0) + (y >= kSize / 2 ? 2 : 0);
+			const unsigned int expected = q < 3 ? kColors[q] : 0u;
+			if (memcmp(&pixels[(y * kSize + x) * 4], &expected, 4) != 0)
+				++mismatches;
+		}
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, res.renderTargetFramebuffer);
+	glViewport(0, 0, BackendResources::kRenderTargetSize, BackendResources::kRenderTargetSize);
+	glDeleteFramebuffers(1, &framebuffer);
+	res.DestroyTexture(target);
+	return mismatches;
+}
+
+// A device that shuts down right after retiring objects, with their frame not done yet, has to
+// delete them all the same: the backend's memory stats come back to where they were before it
+// started. Counts stats that did not.
+static int CheckShutdownReleasesRetired(BackendResources& res, IUnityInterfaces* interfaces)
+{
+	MemoryStats before[kMemoryStatsCount], after[kMemoryStatsCount];
+	GetMemoryStats(before, kMemoryStatsCount);
+	RenderAPI* api = CreateRenderAPI(res.renderer);
+	api->ProcessDeviceEvent(kUnityGfxDeviceEventInitialize, interfaces);
+	int mismatches = CheckStreamBufferGrowth(res, api);
+	api->ProcessDeviceEvent(kUnityGfxDeviceEventShutdown, interfaces);
+	delete api;
+	GetMemoryStats(after, kMemoryStatsCount);
+
+	const int first = GetMemoryBackend(res.renderer) * kMemCategoryCount;
+	for (int i = first; i < first + kMemCategoryCount; ++i)
+	{
+		if (after[i].liveBytes != before[i].liveBytes || after[i].liveObjects != before[i].liveObjects)
+			++mismatches;
+	}
+	return mismatches;
+}
+
+// Encodes, uploads, and has the driver decode the blocks again: through glGetTexImage on GL Core,
+// by drawing the texture on ES, which has no way to read it otherwise. Counts channels off from
+// the source by more than the format's tolerance: a bug in block layout or endpoint packing is far
+// off on most of them, lossy encoding isn't. Returns -1 where the driver lacks the format.
+static int CheckUpdateCompressedTexture(BackendResources& res, RenderAPI* api, TextureBlockFormat format)
+{
+	// Not a multiple of the block size, for the padded edge blocks
+	const int kWidth = 70, kHeight = 46;
+	void* texture = res.CreateCompressedTexture(format, kWidth, kHeight, 5);
+	if (!texture)
+		return -1;
+	std::vector<unsigned char> pixels(kWidth * kHeight * 4);
+	FillSmoothPattern(&pixels[0], kWidth, kHeight, kWidth * 4);
+	std::vector<unsigned char> blocks(GetBlockCompressedSize(format, kWidth, kHeight));
+	BlockCompressor compressor;
+	compressor.Compress(format, &pixels[0], kWidth, kHeight, kWidth * 4, &blocks[0]);
+
+	int mismatches = kWidth * kHeight;
+	std::vector<unsigned char> decoded(kWidth * kHeight * 4);
+	bool decodedRead = false;
+	if (api->WaitForUpload(api->UpdateCompressedTexture(texture, kWidth, kHeight, format, &blocks[0], blocks.size())))
+	{
+		if (res.renderer == kUnityGfxRendererOpenGLCore)
+		{
+			glBindTexture(GL_TEXTURE_2D, (GLuint)(size_t)texture);
+			glPixelStorei(GL_PACK_ALIGNMENT, 1);
+			glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, &decoded[0]);
+			glPixelStorei(GL_PACK_ALIGNMENT, 4);
+			decodedRead = true;
+		}
+		else
+			decodedRead = ReadTextureByDrawing(res, texture, kWidth, kHeight, decoded);
+	}
+	if (decodedRead)
+	{
+
+		// Bounding box endpoints in 565 with four colors are the loosest; the hard band edges cost a
+		// few blocks more
+		const bool singleChannel = format == kBlockFormatBC4 || format == kBlockFormatEACR11;
+		const int channels = singleChannel ? 1 : 3;
+		const int tolerance = singleChannel ? 12 : 48;
+		mismatches = 0;
+		for (int i = 0; i < kWidth * kHeight; ++i)
+		{
+			for (int c = 0; c < channels; ++c)
+			{
+				if (abs((int)decoded[i * 4 + c] - (int)pixels[i * 4 + c]) > tolerance)
+				{
+					++mismatches;
+					break;
+				}
+			}
+		}
+	}
+	res.DestroyTexture(texture);
+	return mismatches;
+}
+
+static void RunReadbackChecks(const char* backendName, BackendResources& res, RenderAPI* api, IUnityInterfaces* interfaces)
+{
+	if (!res.IsGL())
+		return;
+	const bool es2 = res.renderer == kUnityGfxRendererOpenGLES20;
+	ReportCheck(backendName, "BeginEndModifyTexture", CheckModifyTexture(res, api, 0));
+	ReportCheck(backendName, "EndModifyTextureAsync", CheckModifyTexture(res, api, 1));
+	// ES2 has no upload buffers, so there is nothing to hand to the thread
+	ReportCheck(backendName, "EndModifyTextureAsync/UploadThread", es2 ? -1 : CheckModifyTexture(res, api, 2));
+	ReportCheck(backendName, "UpdateTextureRegion", CheckUpdateTextureRegion(res, api));
+	ReportCheck(backendName, "BeginEndModifyVertexBuffer", CheckModifyVertexBuffer(res, api));
+	ReportCheck(backendName, "DrawSimpleTriangles", CheckDrawSimpleTriangles(res, api, false));
+	ReportCheck(backendName, "DrawSimpleTrianglesBatch", CheckDrawSimpleTriangles(res, api, true));
+	ReportCheck(backendName, "StreamBufferGrowth", CheckStreamBufferGrowth(res, api));
+	ReportCheck(backendName, "ShutdownReleasesRetired", CheckShutdownReleasesRetired(res, interfaces));
+	for (int f = kBlockFormatNone + 1; f < kBlockFormatCount; ++f)
+	{
+		const std::string name = std::string("UpdateCompressedTexture/") + GetBlockFormatName((TextureBlockFormat)f);
+		ReportCheck(backendName, name.c_str(), CheckUpdateCompressedTexture(res, api, (TextureBlockFormat)f));
+	}
+}
+
+
+
+// --------------------------------------------------------------------------
+// Benchmark lists
+
+
+static char s_SizeName[64];
+static const char* SizeName(const char* prefix, int value)
+{
+	snprintf(s_SizeName, sizeof(s_SizeName), "%s/%d", prefix, value);
+	return s_SizeName;
+}
+
+
+// Backend independent helpers, checked on plain data
+
+struct RetireCheckItem { unsigned long long frame; int id; };
+
+struct RetireCheckRecorder
+{
+	std::vector<RetireCheckItem>* destroyed;
+	void operator()(const RetireCheckItem& item) const { destroyed->push_back(item); }
+};
+
+// Counts items destroyed out of place: every one of frames up to completedFrame (the ids in
+// expectedIds, in that order) and nothing else
+static int CountRetireMismatches(std::vector<RetireCheckItem>& destroyed, const int* expectedIds, int expectedCount)
+{
+	int mismatches = abs((int)destroyed.size() - expectedCount);
+	for (int i = 0; i < expectedCount && i < (int)destroyed.size(); ++i)
+		mismatches += destroyed[i].id != expectedIds[i];
+	destroyed.clear();
+	return mismatches;
+}
+
+// Retire hands out whole frames up to the completed one, in push order within a frame; a frame
+// that wraps onto a list still holding an older frame takes those objects along, and they wait
+// for the newer frame
+static int CheckFrameRetireQueue()
+{
+	FrameRetireQueue<RetireCheckItem, 4> queue(2);
+	std::vector<RetireCheckItem> destroyed;
+	RetireCheckRecorder recorder = { &destroyed };
+	int mismatches = 0;
+
+	for (int frame = 1; frame <= 3; ++frame)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			const RetireCheckItem item = { (unsigned long long)frame, frame * 10 + i };
+			queue.Push(frame, item);
+		}
+	}
+	queue.Retire(0, recorder);
+	mismatches += CountRetireMismatches(destroyed, NULL, 0);
+	queue.Retire(2, recorder);
+	static const int kFirstTwoFrames[] = { 10, 11, 12, 20, 21, 22 };
+	mismatches += CountRetireMismatches(destroyed, kFirstTwoFrames, 6);
+	mismatches += !queue.HasFrame(3) + queue.HasFrame(2) + queue.IsEmpty();
+
+	// Frame 7 lands on frame 3's list
+	const RetireCheckItem late = { 7, 70 };
+	queue.Push(7, late);
+	mismatches += queue.HasFrame(3) + !queue.HasFrame(7);
+	queue.Retire(6, recorder);
+	mismatches += CountRetireMismatches(destroyed, NULL, 0);
+	queue.Retire(7, recorder);
+	static const int kMerged[] = { 30, 31, 32, 70 };
+	mismatches += CountRetireMismatches(destroyed, kMerged, 4);
+	mismatches += !queue.IsEmpty();
+
+	// Lists are reused after a full turn of the ring
+	for (int frame = 8; frame < 16; ++frame)
+	{
+		const RetireCheckItem item = { (unsigned long long)frame, frame * 10 };
+		queue.Push(frame, item);
+		queue.Retire(frame - 2, recorder);
+	}
+	queue.Retire(15, recorder);
+	static const int kRing[] = { 80, 90, 100, 110, 120, 130, 140, 150 };
+	mismatches += CountRetireMismatches(destroyed, kRing, 8);
+	mismatches += !queue.IsEmpty();
+	return mismatches;
+}
+
+// Same sequence on every run, so a failure can be reproduced
+static unsigned NextCheckRandom(unsigned& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+struct SubAllocation { unsigned long long frame; unsigned handle; uint64_t offset, size; };
+
+// Counts what is off about a new allocation: outside of the capacity, off its alignment, or
+// overlapping one still live
+static int CountSubAllocationMismatches(const std::vector<SubAllocation>& live, uint64_t capacity, uint64_t offset, uint64_t size, uint64_t alignment)
+{
+	int mismatches = (offset % alignment) != 0 || offset + size > capacity;
+	for (size_t i = 0; i < live.size(); ++i)
+		mismatches += offset < live[i].offset + live[i].size && live[i].offset < offset + size;
+	return mismatches;
+}
+
+// Allocations of random sizes and alignments, freed in random order with new ones in between,
+// mostly allocating for the first half of the rounds and mostly freeing after that. Once all are
+// freed, the free ranges have to have merged back into one that takes the whole capacity.
+static int CheckTlsfSubAllocator()
+{
+	const uint64_t kCapacity = 1 << 20;
+	const int kRounds = 4000;
+	TlsfSubAllocator allocator;
+	allocator.Init(kCapacity);
+	std::vector<SubAllocation> live;
+	unsigned random = 12345;
+	int mismatches = 0;
+	for (int round = 0; round < kRounds; ++round)
+	{
+		const unsigned allocateChance = round < kRounds / 2 ? 3 : 1;
+		if (live.empty() || NextCheckRandom(random) % 4 < allocateChance)
+		{
+			const uint64_t size = 1 + NextCheckRandom(random) % 8192;
+			const uint64_t alignment = 16ull << (NextCheckRandom(random) % 5);
+			uint64_t offset = 0;
+			const unsigned handle = allocator.Allocate(size, alignment, &offset);
+			if (handle == kSubAllocationFailed)
+				continue;
+			mismatches += CountSubAllocationMismatches(live, kCapacity, offset, size, alignment);
+			const SubAllocation allocation = { 0, handle, offset, size };
+			live.push_back(allocation);
+		}
+		else
+		{
+			const size_t i = NextCheckRandom(random) % live.size();
+			allocator.Free(live[i].handle);
+			live[i] = live.back();
+			live.pop_back();
+		}
+	}
+	while (!live.empty())
+	{
+		const size_t i = NextCheckRandom(random) % live.size();
+		allocator.Free(live[i].handle);
+		live[i] = live.back();
+		live.pop_back();
+	}
+	mismatches += !allocator.IsEmpty();
+
+	uint64_t offset = 1;
+	const unsigned whole = allocator.Allocate(kCapacity, 16, &offset);
+	mismatches += whole == kSubAllocationFailed || offset != 0;
+	if (whole != kSubAllocationFailed)
+		allocator.Free(whole);
+	mismatches += !allocator.IsEmpty();
+	return mismatches;
+}
+
+// Frames allocate random sizes until the ring is full, and get retired a few frames later, the
+// ring wrapping around many times. Retiring has to free a frame's ranges for the next ones, and
+// retiring everything leaves the ring empty, with the whole capacity to hand out again.
+static int CheckRingSubAllocator()
+{
+	const uint64_t kCapacity = 64 * 1024;
+	const unsigned long long kLatency = 3, kFrames = 200;
+	RingSubAllocator ring;
+	ring.Init(kCapacity);
+	std::vector<SubAllocation> live;
+	unsigned random = 54321;
+	int mismatches = 0;
+	for (unsigned long long frame = 1; frame <= kFrames; ++frame)
+	{
+		if (frame > kLatency)
+		{
+			ring.Retire(frame - kLatency);
+			size_t kept = 0;
+			for (size_t i = 0; i < live.size(); ++i)
+			{
+				if (live[i].frame > frame - kLatency)
+					live[kept++] = live[i];
+			}
+			live.resize(kept);
+			mismatches += live.empty() && ring.GetUsed() != 0;
+		}
+		const unsigned count = 1 + NextCheckRandom(random) % 16;
+		for (unsigned i = 0; i < count; ++i)
+		{
+			const uint64_t size = 1 + NextCheckRandom(random) % 4096;
+			const uint64_t alignment = 1ull << (NextCheckRandom(random) % 8);
+			const uint64_t offset = ring.Allocate(size, alignment, frame);
+			if (offset == kSubAllocationNoOffset)
+				break;
+			mismatches += CountSubAllocationMismatches(live, kCapacity, offset, size, alignment);
+			const SubAllocation allocation = { frame, 0, offset, size };
+			live.push_back(allocation);
+		}
+		uint64_t liveBytes = 0;
+		for (size_t i = 0; i < live.size(); ++i)
+			liveBytes += live[i].size;
+		mismatches += ring.GetUsed() < liveBytes || ring.GetUsed() > kCapacity;
+	}
+
+	ring.Retire(kFrames);
+	mismatches += ring.GetUsed() != 0;
+	// A full ring takes nothing more until its frame is retired
+	mismatches += ring.Allocate(kCapacity, 1, kFrames + 1) != 0;
+	mismatches += ring.Allocate(1, 1, kFrames + 2) != kSubAllocationNoOffset;
+	ring.Retire(kFrames + 1);
+	mismatches += ring.Allocate(1, 1, kFrames + 2) != 0;
+
+	// What does not fit at the end goes to the start, once the oldest frame there is retired; the
+	// skipped end is freed along with the frame that skipped it
+	const uint64_t kPart = kCapacity / 8 * 3;
+	ring.Init(kCapacity);
+	mismatches += ring.Allocate(kPart, 1, 1) != 0;
+	mismatches += ring.Allocate(kPart, 1, 2) != kPart;
+	mismatches += ring.Allocate(kPart, 1, 3) != kSubAllocationNoOffset;
+	ring.Retire(1);
+	mismatches += ring.Allocate(kPart, 1, 3) != 0;
+	mismatches += ring.GetUsed() != kCapacity;
+	ring.Retire(2);
+	mismatches += ring.GetUsed() != kCapacity - kPart;
+	ring.Retire(3);
+	mismatches += ring.GetUsed() != 0;
+	return mismatches;
+}
+
+static void RunHelperChecks()
+{
+	ReportCheck("any", "FrameRetireQueue", CheckFrameRetireQueue());
+	ReportCheck("any", "TlsfSubAllocator", CheckTlsfSubAllocator());
+	ReportCheck("any", "RingSubAllocator", CheckRingSubAllocator());
+}
+
+// SetMeshBuffersFromUnity only copies into plugin memory, it does not depend on the backend
+static void RunIngestionBenchmarks()
+{
+	unsigned char dummyHandle;
+	for (size_t i = 0; i < sizeof(kVertexCounts) / sizeof(kVertexCounts[0]); ++i)
+	{
+		SyntheticMesh mesh;
+		MakeMesh(kVertexCounts[i], mesh);
+		SetMeshBuffersBench bench(&dummyHandle, kVertexCounts[i], mesh);
+		RunBenchmark(SizeName("SetMeshBuffersFromUnity", kVertexCounts[i]), "any", kVertexCounts[i] * 8.0 * sizeof(float), bench);
+	}
+	SetMeshBuffersFromUnity(NULL, 0, NULL, NULL, NULL);
+}
+
+// Block compression is plain CPU work too
+static void RunCompressionBenchmarks()
+{
+	BlockCompressor compressor;
+	for (int f = kBlockFormatNone + 1; f < kBlockFormatCount; ++f)
+	{
+		const TextureBlockFormat format = (TextureBlockFormat)f;
+		for (size_t t = 0; t < sizeof(kCompressThreadCounts) / sizeof(kCompressThreadCounts[0]); ++t)
+		{
+			compressor.SetThreadCount(kCompressThreadCounts[t]);
+			for (size_t i = 0; i < sizeof(kTextureSizes) / sizeof(kTextureSizes[0]); ++i)
+			{
+				const int size = kTextureSizes[i];
+				char name[64];
+				snprintf(name, sizeof(name), "CompressTexture/%s/Threads%d/%d", GetBlockFormatName(format), kCompressThreadCounts[t], size);
+				CompressTextureBench bench(compressor, format, size);
+				RunBenchmark(name, "any", size * size * 4.0, bench);
+			}
+		}
+	}
+}
+
+
+static void RunBackendBenchmarks(const char* backendName, UnityGfxRenderer renderer, IUnityInterfaces* interfaces)
+{
+	BackendResources res(renderer);
+	res.BindRenderTarget();
+
+	// Plugin kernels, through the render event like Unity would call them
+	for (size_t i = 0; i < sizeof(kTextureSizes) / sizeof(kTextureSizes[0]); ++i)
+	{
+		const int size = kTextureSizes[i];
+		void* texture = res.CreateTexture(size, 0);
+		SetTextureFromUnity(texture, size, size);
+		RenderEventBench bench(res, kEventModifyTexture);
+		RunBenchmark(SizeName("ModifyTexturePixels", size), backendName, size * size * 4.0, bench);
+		// Same, with the GL upload done on the upload thread's shared context
+		if (renderer != kUnityGfxRendererNull && renderer != kUnityGfxRendererOpenGLES20)
+		{
+			SetGLUploadThreadEnabled(true);
+			RunBenchmark(SizeName("ModifyTexturePixelsUploadThread", size), backendName, size * size * 4.0, bench);
+			SetGLUploadThreadEnabled(false);
+		}
+		SetTextureFromUnity(NULL, 0, 0);
+		res.DestroyTexture(texture);
+	}
+	// Same with the pixels block compressed before the upload, in every format the backend has
+	for (int f = kBlockFormatNone + 1; f < kBlockFormatCount; ++f)
+	{
+		const TextureBlockFormat format = (TextureBlockFormat)f;
+		const std::string name = std::string("ModifyTexturePixels") + GetBlockFormatName(format);
+		for (size_t i = 0; i < sizeof(kTextureSizes) / sizeof(kTextureSizes[0]); ++i)
+		{
+			const int size = kTextureSizes[i];
+			void* texture = res.CreateCompressedTexture(format, size, size, 0);
+			if (!texture)
+				break;
+			SetTextureFromUnity(texture, size, size);
+			SetTextureBlockFormatFromUnity(format);
+			RenderEventBench bench(res, kEventModifyTexture);
+			RunBenchmark(SizeName(name.c_str(), size), backendName, size * size * 4.0, bench);
+			SetTextureBlockFormatFromUnity(kBlockFormatNone);
+			SetTextureFromUnity(NULL, 0, 0);
+			res.DestroyTexture(texture);
+		}
+	}
+	for (size_t i = 0; i < sizeof(kVertexCounts) / sizeof(kVertexCounts[0]); ++i)
+	{
+		const int count = kVertexCounts[i];
+		SyntheticMesh mesh;
+		MakeMesh(count, mesh);
+		void* buffer = res.CreateVertexBuffer(count * kMeshVertexSize, 1);
+		SetMeshBuffersFromUnity(buffer, count, &mesh.positions[0], &mesh.normals[0], &mesh.uvs[0]);
+		RenderEventBench bench(res, kEventModifyVertexBuffer);
+		RunBenchmark(SizeName("ModifyVertexBuffer", count), backendName, count * (double)kMeshVertexSize, bench);
+		SetMeshBuffersFromUnity(NULL, 0, NULL, NULL, NULL);
+		res.DestroyVertexBuffer(buffer);
+	}
+
+	// RenderAPI entry points on their own, on a separate backend instance
+	RenderAPI* api = CreateRenderAPI(renderer);
+	if (!api)
+		return;
+	api->ProcessDeviceEvent(kUnityGfxDeviceEventInitialize, interfaces);
+	RunReadbackChecks(backendName, res, api, interfaces);
+
+	// Every texture upload path
+	const bool hasUploadThread = res.IsGL() && renderer != kUnityGfxRendererOpenGLES20;
+	for (size_t i = 0; i < sizeof(kTextureSizes) / sizeof(kTextureSizes[0]); ++i)
+	{
+		const int size = kTextureSizes[i];
+		void* texture = res.CreateTexture(size, 2);
+		ModifyTextureBench bench(res, api, texture, size);
+		RunBenchmark(SizeName("BeginEndModifyTexture", size), backendName, size * size * 4.0, bench);
+		ModifyTextureAsyncBench async(res, api, texture, size);
+		RunBenchmark(SizeName("BeginEndModifyTextureAsync", size), backendName, size * size * 4.0, async);
+		if (hasUploadThread)
+		{
+			SetGLUploadThreadEnabled(true);
+			RunBenchmark(SizeName("BeginEndModifyTextureAsyncUploadThread", size), backendName, size * size * 4.0, async);
+			SetGLUploadThreadEnabled(false);
+		}
+		UpdateTextureRegionBench region(res, api, texture, size);
+		RunBenchmark(SizeName("UpdateTextureRegion", size), backendName, size * size * 4.0, region);
+		if (renderer == kUnityGfxRendererOpenGLCore)
+		{
+			// What BeginEndModifyTexture saves by uploading in the format GetTexturePixelLayout picked
+			TexSubImageBench rgba(res, texture, GL_RGBA, size);
+			RunBenchmark(SizeName("TexSubImage2D/RGBA", size), backendName, size * size * 4.0, rgba);
+			TexSubImageBench bgra(res, texture, GL_BGRA, size);
+			RunBenchmark(SizeName("TexSubImage2D/BGRA", size), backendName, size * size * 4.0, bgra);
+		}
+		res.DestroyTexture(texture);
+	}
+	BlockCompressor compressor;
+	for (int f = kBlockFormatNone + 1; f < kBlockFormatCount; ++f)
+	{
+		const TextureBlockFormat format = (TextureBlockFormat)f;
+		const std::string name = std::string("UpdateCompressedTexture/") + GetBlockFormatName(format);
+		for (size_t i = 0; i < sizeof(kTextureSizes) / sizeof(kTextureSizes[0]); ++i)
+		{
+			const int size = kTextureSizes[i];
+			void* texture = res.CreateCompressedTexture(format, size, size, 2);
+			if (!texture)
+				break;
+			std::vector<unsigned char> pixels((size_t)size * size * 4);
+			std::vector<unsigned char> blocks(GetBlockCompressedSize(format, size, size));
+			FillSmoothPattern(&pixels[0], size, size, size * 4);
+			compressor.Compress(format, &pixels[0], size, size, size * 4, &blocks[0]);
+			UpdateCompressedTextureBench bench(res, api, texture, format, size, blocks);
+			// Bytes of the uncompressed texture, so the throughput compares with the other uploads
+			RunBenchmark(SizeName(name.c_str(), size), backendName, size * size * 4.0, bench);
+			res.DestroyTexture(texture);
+		}
+	}
+	for (size_t i = 0; i < sizeof(kVertexCounts) / sizeof(kVertexCounts[0]); ++i)
+	{
+		const int count = kVertexCounts[i];
+		void* buffer = res.CreateVertexBuffer(count * kMeshVertexSize, 3);
+		size_t size = 0;
+		// Not every backend flavor can map vertex buffers
+		if (api->BeginModifyVertexBuffer(buffer, &size))
+		{
+			api->EndModifyVertexBuffer(buffer);
+			ModifyVertexBufferBench bench(res, api, buffer);
+			RunBenchmark(SizeName("BeginEndModifyVertexBuffer", count), backendName, count * (double)kMeshVertexSize, bench);
+		}
+		res.DestroyVertexBuffer(buffer);
+	}
+	for (size_t i = 0; i < sizeof(kDrawCounts) / sizeof(kDrawCounts[0]); ++i)
+	{
+		const int count = kDrawCounts[i];
+		DrawTrianglesBench loop(api, count, false);
+		RunBenchmark(SizeName("DrawSimpleTriangles", count), backendName, 0.0, loop);
+		DrawTrianglesBench batch(api, count, true);
+		RunBenchmark(SizeName("DrawSimpleTrianglesBatch", count), backendName, 0.0, batch);
+	}
+	res.Sync();
+
+	api->ProcessDeviceEvent(kUnityGfxDeviceEventShutdown, interfaces);
+	delete api;
+
+	if (res.IsGL())
+	{
+		DeviceStartupBench cold(res, interfaces, true);
+		RunBenchmark("DeviceStartup/ColdShaderCache", backendName, 0.0, cold);
+		DeviceStartupBench warm(res, interfaces, false);
+		RunBenchmark("DeviceStartup/WarmShaderCache", backendName, 0.0, warm);
+	}
+	res.ReleaseRenderTarget();
+}
+
+
+
+// --------------------------------------------------------------------------
+// JSON output
+
+
+static void WriteJSONString(FILE* f, const char* s)
+{
+	fputc('"', f);
+	for (; *s; ++s)
+	{
+		if (*s == '"' || *s == '\\')
+			fprintf(f, "\\%c", *s);
+		else if ((unsigned char)*s < 0x20)
+			fprintf(f, "\\u%04x", *s);
+		else
+			fputc(*s, f);
+	}
+	fputc('"', f);
+}
+
+static void WriteResults(FILE* f, const std::vector<std::pair<std::string, std::string> >& context)
+{
+	fprintf(f, "{\n  \"context\": {\n");
+	for (size_t i = 0; i < context.size(); ++i)
+	{
+		fprintf(f, "    ");
+		WriteJSONString(f, context[i].first.c_str());
+		fprintf(f, ": ");
+		WriteJSONString(f, context[i].second.c_str());
+		fprintf(f, "%s\n", i + 1 < context.size() ? "," : "");
+	}
+	fprintf(f, "  },\n  \"benchmarks\": [\n");
+	for (size_t i = 0; i < s_Results.size(); ++i)
+	{
+		const BenchResult& r = s_Results[i];
+		std::vector<double> sorted = r.nsPerIteration;
+		std::sort(sorted.begin(), sorted.end());
+		const size_t n = sorted.size();
+		double mean = 0.0;
+		for (size_t j = 0; j < n; ++j)
+			mean += sorted[j];
+		mean /= n;
+		double variance = 0.0;
+		for (size_t j = 0; j < n; ++j)
+			variance += (sorted[j] - mean) * (sorted[j] - mean);
+		variance = n > 1 ? variance / (n - 1) : 0.0;
+		const double stddev = sqrt(variance);
+		const double median = n % 2 ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+
+		fprintf(f, "    {\n      \"name\": ");
+		WriteJSONString(f, r.name.c_str());
+		fprintf(f, ",\n      \"backend\": ");
+		WriteJSONString(f, r.backend.c_str());
+		fprintf(f, ",\n      \"repetitions\": %d,\n      \"iterations\": %lld,\n", (int)n, r.iterations);
+		fprintf(f, "      \"bytes_per_iteration\": %.0f,\n", r.bytesPerIteration);
+		fprintf(f, "      \"ns_per_iteration\": { \"mean\": %.3f, \"median\": %.3f, \"stddev\": %.3f, \"variance\": %.3f, \"min\": %.3f, \"max\": %.3f, \"cv\": %.5f },\n",
+			mean, median, stddev, variance, sorted.front(), sorted.back(), mean > 0.0 ? stddev / mean : 0.0);
+		fprintf(f, "      \"bytes_per_second\": %.0f,\n", median > 0.0 ? r.bytesPerIteration * 1e9 / median : 0.0);
+		fprintf(f, "      \"samples_ns\": [");
+		for (size_t j = 0; j < r.nsPerIteration.size(); ++j)
+			fprintf(f, "%s%.3f", j ? ", " : "", r.nsPerIteration[j]);
+		fprintf(f, "]\n    }%s\n", i + 1 < s_Results.size() ? "," : "");
+	}
+	fprintf(f, "  ]\n}\n");
+}
+
+
+
+// --------------------------------------------------------------------------
+// main
+
+
+static void PrintUsage()
+{
+	printf(
+		"Usage: RenderingPluginBench [options]\n"
+		"  --repetitions <n>      timed repetitions per benchmark (default 10)\n"
+		"  --min-time-ms <ms>     minimum duration of one repetition (default 50)\n"
+		"  --backends <list>      comma separated: null,glcore,glcore32,gles2,gles3 (default all)\n"
+		"  --filter <text>        only run benchmarks whose backend/name contains text\n"
+		"  --out <path>           write JSON there instead of stdout\n"
+		"  --shader-cache-dir <d> program binary cache location (default /tmp)\n");
+}
+
+static bool WantBackend(const char* name)
+{
+	return std::find(s_Options.backends.begin(), s_Options.backends.end(), name) != s_Options.backends.end();
+}
+
+int main(int argc, char** argv)
+{
+	s_Options.repetitions = 10;
+	s_Options.minTimeMs = 50.0;
+	s_Options.filter = NULL;
+	s_Options.outPath = NULL;
+	const char* backendList = "null,glcore,glcore32,gles2,gles3";
+	const char* shaderCacheDir = "/tmp";
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+		if (!strcmp(arg, "--help") || !strcmp(arg, "-h"))
+		{
+			PrintUsage();
+			return 0;
+		}
+		if (!value)
+		{
+			PrintUsage();
+			return 1;
+		}
+		++i;
+		if (!strcmp(arg, "--repetitions"))
+			s_Options.repetitions = std::max(atoi(value), 1);
+		else if (!strcmp(arg, "--min-time-ms"))
+			s_Options.minTimeMs = std::max(atof(value), 0.0);
+		else if (!strcmp(arg, "--backends"))
+			backendList = value;
+		else if (!strcmp(arg, "--filter"))
+			s_Options.filter = value;
+		else if (!strcmp(arg, "--out"))
+			s_Options.outPath = value;
+		else if (!strcmp(arg, "--shader-cache-dir"))
+			shaderCacheDir = value;
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+	for (const char* p = backendList; *p; )
+	{
+		const char* end = strchr(p, ',');
+		const size_t len = end ? (size_t)(end - p) : strlen(p);
+		s_Options.backends.push_back(std::string(p, len));
+		p += len + (end ? 1 : 0);
+	}
+
+	std::vector<std::pair<std::string, std::string> > context;
+	context.push_back(std::make_pair(std::string("compiler"), std::string(__VERSION__)));
+	char number[32];
+	snprintf(number, sizeof(number), "%d", s_Options.repetitions);
+	context.push_back(std::make_pair(std::string("repetitions"), std::string(number)));
+	snprintf(number, sizeof(number), "%g", s_Options.minTimeMs);
+	context.push_back(std::make_pair(std::string("min_time_ms"), std::string(number)));
+
+	// Start out on the null device, like the player in batch mode
+	IUnityInterfaces* interfaces = HostInterfacesInit(kUnityGfxRendererNull);
+	UnityPluginLoad(interfaces);
+	SetShaderCacheDirectory(shaderCacheDir);
+
+	RunHelperChecks();
+	RunIngestionBenchmarks();
+	RunCompressionBenchmarks();
+	if (WantBackend("null"))
+		RunBackendBenchmarks("null", kUnityGfxRendererNull, interfaces);
+
+	// Newest core version, and the oldest one the plugin supports
+	static const struct { const char* name; UnityGfxRenderer renderer; int majorVersion, minorVersion; } kGLBackends[] =
+	{
+		{ "glcore", kUnityGfxRendererOpenGLCore, 0, 0 },
+		{ "glcore32", kUnityGfxRendererOpenGLCore, 3, 2 },
+		{ "gles2", kUnityGfxRendererOpenGLES20, 2, 0 },
+		{ "gles3", kUnityGfxRendererOpenGLES30, 3, 0 },
+	};
+	for (size_t i = 0; i < sizeof(kGLBackends) / sizeof(kGLBackends[0]); ++i)
+	{
+		if (!WantBackend(kGLBackends[i].name))
+			continue;
+		if (!CreateHeadlessGLContext(kGLBackends[i].renderer, kGLBackends[i].majorVersion, kGLBackends[i].minorVersion))
+		{
+			fprintf(stderr, "%s: no EGL context, skipped\n", kGLBackends[i].name);
+			context.push_back(std::make_pair(std::string(kGLBackends[i].name) + "_renderer", std::string("unavailable")));
+			continue;
+		}
+		context.push_back(std::make_pair(std::string(kGLBackends[i].name) + "_renderer", std::string(GetHeadlessGLRendererName())));
+		context.push_back(std::make_pair(std::string(kGLBackends[i].name) + "_version", std::string(GetHeadlessGLVersion())));
+		HostSetRenderer(kGLBackends[i].renderer);
+		RunBackendBenchmarks(kGLBackends[i].name, kGLBackends[i].renderer, interfaces);
+		// Back to the null device while the context is still current, so the plugin can release GL objects
+		HostSetRenderer(kUnityGfxRendererNull);
+		DestroyHeadlessGLContext();
+	}
+
+	HostSendDeviceEvent(kUnityGfxDeviceEventShutdown);
+	UnityPluginUnload();
+
+	snprintf(number, sizeof(number), "%d", s_CheckFailures);
+	context.push_back(std::make_pair(std::string("check_failures"), std::string(number)));
+
+	FILE* out = s_Options.outPath ? fopen(s_Options.outPath, "w") : stdout;
+	if (!out)
+	{
+		fprintf(stderr, "Failed to open %s\n", s_Options.outPath);
+		return 1;
+	}
+	WriteResults(out, context);
+	if (out != stdout)
+		fclose(out);
+	return s_CheckFailures ? 2 : 0;
+}
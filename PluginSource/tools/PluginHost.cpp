@@ -0,0 +1,356 @@
+// Standalone host for the rendering plugin: loads libRenderingPlugin.so outside of the Unity player,
+// emulating the bits of IUnityInterfaces / IUnityGraphics the plugin uses, and drives its render
+// event for a number of frames with synthetic textures and meshes. Reports per event timings.
+//
+// Runs with Unity's "null" graphics device, so it needs no GPU; handy for profiling the plugin's
+// CPU side with perf and friends:
+//
+//   ./RenderingPluginHost --frames 1000
+//   perf record -g ./RenderingPluginHost --frames 10000 --texture 1024x1024
+//   ./RenderingPluginHost --capture trace.bin --frames 100
+//   ./RenderingPluginHost --replay trace.bin
+
+#include "HostInterfaces.h"
+
+#include <algorithm>
+#include <chrono>
+#include <dlfcn.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+
+// --------------------------------------------------------------------------
+// Plugin exports used by the host
+
+
+typedef void (UNITY_INTERFACE_API * PluginLoadFunc)(IUnityInterfaces*);
+typedef void (UNITY_INTERFACE_API * PluginUnloadFunc)();
+typedef void (UNITY_INTERFACE_API * SetTimeFunc)(float);
+typedef void (UNITY_INTERFACE_API * SetTextureFunc)(void*, int, int);
+typedef void (UNITY_INTERFACE_API * SetMeshBuffersFunc)(void*, int, float*, float*, float*);
+typedef UnityRenderingEvent (UNITY_INTERFACE_API * GetRenderEventFuncFunc)();
+typedef void (UNITY_INTERFACE_API * RegisterNullBufferFunc)(void*, int);
+typedef int (UNITY_INTERFACE_API * StartCaptureFunc)(const char*);
+typedef void (UNITY_INTERFACE_API * StopCaptureFunc)();
+typedef int (UNITY_INTERFACE_API * CountTraceFramesFunc)(const char*);
+typedef int (UNITY_INTERFACE_API * ReplayFunc)(const char*, void*, float*, int);
+
+struct Plugin
+{
+	void* library;
+	PluginLoadFunc load;
+	PluginUnloadFunc unload;
+	SetTimeFunc setTime;
+	SetTextureFunc setTexture;
+	SetMeshBuffersFunc setMeshBuffers;
+	GetRenderEventFuncFunc getRenderEventFunc;
+	RegisterNullBufferFunc registerNullBuffer;
+	StartCaptureFunc startCapture;
+	StopCaptureFunc stopCapture;
+	CountTraceFramesFunc countTraceFrames;
+	ReplayFunc replay;
+};
+
+template<typename T>
+static bool LoadSymbol(void* library, const char* name, T& outFunc, bool required)
+{
+	outFunc = (T)dlsym(library, name);
+	if (!outFunc && required)
+		fprintf(stderr, "Plugin does not export %s\n", name);
+	return outFunc || !required;
+}
+
+static bool LoadPlugin(const char* path, Plugin& plugin)
+{
+	memset(&plugin, 0, sizeof(plugin));
+	// The plugin expects the player to have the graphics libraries loaded already (it does not link
+	// libGL itself); bind lazily so that running on the null device doesn't need them at all.
+	plugin.library = dlopen(path, RTLD_LAZY | RTLD_LOCAL);
+	if (!plugin.library)
+	{
+		fprintf(stderr, "Failed to load %s: %s\n", path, dlerror());
+		return false;
+	}
+	bool ok = true;
+	ok &= LoadSymbol(plugin.library, "UnityPluginLoad", plugin.load, true);
+	ok &= LoadSymbol(plugin.library, "UnityPluginUnload", plugin.unload, true);
+	ok &= LoadSymbol(plugin.library, "SetTimeFromUnity", plugin.setTime, true);
+	ok &= LoadSymbol(plugin.library, "SetTextureFromUnity", plugin.setTexture, true);
+	ok &= LoadSymbol(plugin.library, "SetMeshBuffersFromUnity", plugin.setMeshBuffers, true);
+	ok &= LoadSymbol(plugin.library, "GetRenderEventFunc", plugin.getRenderEventFunc, true);
+	LoadSymbol(plugin.library, "RegisterNullRendererBuffer", plugin.registerNullBuffer, false);
+	LoadSymbol(plugin.library, "StartFrameTraceCapture", plugin.startCapture, false);
+	LoadSymbol(plugin.library, "StopFrameTraceCapture", plugin.stopCapture, false);
+	LoadSymbol(plugin.library, "CountFrameTraceFrames", plugin.countTraceFrames, false);
+	LoadSymbol(plugin.library, "ReplayFrameTrace", plugin.replay, false);
+	return ok;
+}
+
+
+
+// --------------------------------------------------------------------------
+// Synthetic scene data
+
+
+struct Options
+{
+	const char* pluginPath;
+	const char* capturePath;
+	const char* replayPath;
+	int frames;
+	int eventsPerFrame;
+	int textureWidth;
+	int textureHeight;
+	int gridSize;
+	bool perEvent;
+};
+
+// Same layout as the plugin's MeshVertex
+enum { kMeshVertexSize = (3 + 3 + 4 + 2) * 4 };
+
+struct SyntheticMesh
+{
+	std::vector<float> positions;
+	std::vector<float> normals;
+	std::vector<float> uvs;
+	int vertexCount;
+};
+
+// A flat gridSize x gridSize vertex grid, like the plane mesh the sample scripts use
+static void MakeGridMesh(int gridSize, SyntheticMesh& mesh)
+{
+	mesh.vertexCount = gridSize * gridSize;
+	mesh.positions.resize(mesh.vertexCount * 3);
+	mesh.normals.resize(mesh.vertexCount * 3);
+	mesh.uvs.resize(mesh.vertexCount * 2);
+	for (int y = 0; y < gridSize; ++y)
+	{
+		for (int x = 0; x < gridSize; ++x)
+		{
+			const int i = y * gridSize + x;
+			const float u = gridSize > 1 ? float(x) / (gridSize - 1) : 0.0f;
+			const float v = gridSize > 1 ? float(y) / (gridSize - 1) : 0.0f;
+			mesh.positions[i * 3 + 0] = u * 10.0f - 5.0f;
+			mesh.positions[i * 3 + 1] = 0.0f;
+			mesh.positions[i * 3 + 2] = v * 10.0f - 5.0f;
+			mesh.normals[i * 3 + 0] = 0.0f;
+			mesh.normals[i * 3 + 1] = 1.0f;
+			mesh.normals[i * 3 + 2] = 0.0f;
+			mesh.uvs[i * 2 + 0] = u;
+			mesh.uvs[i * 2 + 1] = v;
+		}
+	}
+}
+
+
+
+// --------------------------------------------------------------------------
+// Timing report
+
+
+static void PrintTimings(const char* label, std::vector<double>& ms)
+{
+	if (ms.empty())
+		return;
+	std::sort(ms.begin(), ms.end());
+	double sum = 0.0;
+	for (size_t i = 0; i < ms.size(); ++i)
+		sum += ms[i];
+	const size_t p95 = std::min(ms.size() - 1, (size_t)ceil(ms.size() * 0.95) - 1);
+	const size_t p99 = std::min(ms.size() - 1, (size_t)ceil(ms.size() * 0.99) - 1);
+	printf("%-12s count %8d  min %9.4f  mean %9.4f  p95 %9.4f  p99 %9.4f  max %9.4f ms\n",
+		label, (int)ms.size(), ms.front(), sum / ms.size(), ms[p95], ms[p99], ms.back());
+}
+
+
+static int RunFrames(const Plugin& plugin, const Options& options)
+{
+	// With the null device, "native" handles are never dereferenced; any unique pointer will do
+	std::vector<unsigned char> textureStandIn(16);
+	std::vector<unsigned char> vertexBufferStandIn(16);
+
+	SyntheticMesh mesh;
+	MakeGridMesh(options.gridSize, mesh);
+
+	if (plugin.registerNullBuffer)
+		plugin.registerNullBuffer(&vertexBufferStandIn[0], mesh.vertexCount * kMeshVertexSize);
+	plugin.setTexture(&textureStandIn[0], options.textureWidth, options.textureHeight);
+	plugin.setMeshBuffers(&vertexBufferStandIn[0], mesh.vertexCount, &mesh.positions[0], &mesh.normals[0], &mesh.uvs[0]);
+
+	UnityRenderingEvent renderEvent = plugin.getRenderEventFunc();
+	std::vector<double> eventMs;
+	std::vector<double> frameMs;
+	eventMs.reserve(options.frames * options.eventsPerFrame);
+	frameMs.reserve(options.frames);
+
+	for (int frame = 0; frame < options.frames; ++frame)
+	{
+		const std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+		plugin.setTime(frame / 60.0f);
+		for (int e = 0; e < options.eventsPerFrame; ++e)
+		{
+			const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			renderEvent(1);
+			const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+			eventMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+			if (options.perEvent)
+				printf("frame %d event %d: %.4f ms\n", frame, e, eventMs.back());
+		}
+		frameMs.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+	}
+
+	printf("%d frames, %d events per frame, texture %dx%d, %d vertices\n",
+		options.frames, options.eventsPerFrame, options.textureWidth, options.textureHeight, mesh.vertexCount);
+	PrintTimings("render event", eventMs);
+	PrintTimings("frame", frameMs);
+
+	// Don't leave dangling handles behind in the plugin
+	plugin.setTexture(NULL, 0, 0);
+	plugin.setMeshBuffers(NULL, 0, NULL, NULL, NULL);
+	if (plugin.registerNullBuffer)
+		plugin.registerNullBuffer(&vertexBufferStandIn[0], 0);
+	return 0;
+}
+
+
+static int RunReplay(const Plugin& plugin, const Options& options)
+{
+	if (!plugin.replay || !plugin.countTraceFrames)
+	{
+		fprintf(stderr, "Plugin does not support trace replay\n");
+		return 1;
+	}
+	// Counting only reads the records; the trace gets replayed once, from the plugin's initial state
+	const int recordedFrames = plugin.countTraceFrames(options.replayPath);
+	if (recordedFrames < 0)
+	{
+		fprintf(stderr, "Failed to open trace %s\n", options.replayPath);
+		return 1;
+	}
+	std::vector<float> frameMs(std::max(recordedFrames, 1));
+	const int frameCount = plugin.replay(options.replayPath, NULL, &frameMs[0], recordedFrames);
+	if (frameCount < 0)
+	{
+		fprintf(stderr, "Failed to open trace %s\n", options.replayPath);
+		return 1;
+	}
+	frameMs.resize(std::min(frameCount, recordedFrames));
+
+	std::vector<double> ms(frameMs.begin(), frameMs.end());
+	if (options.perEvent)
+	{
+		for (int i = 0; i < frameCount; ++i)
+			printf("frame %d: %.4f ms\n", i, ms[i]);
+	}
+	printf("replayed %d frames from %s\n", frameCount, options.replayPath);
+	PrintTimings("frame", ms);
+	return 0;
+}
+
+
+
+// --------------------------------------------------------------------------
+// main
+
+
+static void PrintUsage()
+{
+	printf(
+		"Usage: RenderingPluginHost [options]\n"
+		"  --plugin <path>        plugin library to load (default ./libRenderingPlugin.so)\n"
+		"  --frames <n>           frames to run (default 100)\n"
+		"  --events <n>           render events per frame (default 1)\n"
+		"  --texture <w>x<h>      synthetic texture size (default 256x256)\n"
+		"  --grid <n>             synthetic mesh is an n x n vertex grid (default 64)\n"
+		"  --capture <path>       capture a frame trace while running\n"
+		"  --replay <path>        replay a frame trace instead of synthetic frames\n"
+		"  --verbose              print every event (or replayed frame) timing\n");
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	options.pluginPath = "./libRenderingPlugin.so";
+	options.capturePath = NULL;
+	options.replayPath = NULL;
+	options.frames = 100;
+	options.eventsPerFrame = 1;
+	options.textureWidth = 256;
+	options.textureHeight = 256;
+	options.gridSize = 64;
+	options.perEvent = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+		if (!strcmp(arg, "--verbose"))
+			options.perEvent = true;
+		else if (!strcmp(arg, "--help") || !strcmp(arg, "-h"))
+		{
+			PrintUsage();
+			return 0;
+		}
+		else if (!value)
+		{
+			PrintUsage();
+			return 1;
+		}
+		else
+		{
+			++i;
+			if (!strcmp(arg, "--plugin"))
+				options.pluginPath = value;
+			else if (!strcmp(arg, "--frames"))
+				options.frames = std::max(atoi(value), 1);
+			else if (!strcmp(arg, "--events"))
+				options.eventsPerFrame = std::max(atoi(value), 1);
+			else if (!strcmp(arg, "--texture"))
+			{
+				if (sscanf(value, "%dx%d", &options.textureWidth, &options.textureHeight) != 2)
+				{
+					PrintUsage();
+					return 1;
+				}
+			}
+			else if (!strcmp(arg, "--grid"))
+				options.gridSize = std::max(atoi(value), 1);
+			else if (!strcmp(arg, "--capture"))
+				options.capturePath = value;
+			else if (!strcmp(arg, "--replay"))
+				options.replayPath = value;
+			else
+			{
+				PrintUsage();
+				return 1;
+			}
+		}
+	}
+
+	Plugin plugin;
+	if (!LoadPlugin(options.pluginPath, plugin))
+		return 1;
+
+	// The "device" exists before the plugin gets loaded, like in the player; the plugin
+	// initializes itself from UnityPluginLoad
+	plugin.load(HostInterfacesInit(kUnityGfxRendererNull));
+
+	if (options.capturePath)
+	{
+		if (!plugin.startCapture || !plugin.startCapture(options.capturePath))
+			fprintf(stderr, "Failed to start capture to %s\n", options.capturePath);
+	}
+
+	const int result = options.replayPath ? RunReplay(plugin, options) : RunFrames(plugin, options);
+
+	if (options.capturePath && plugin.stopCapture)
+		plugin.stopCapture();
+
+	HostSendDeviceEvent(kUnityGfxDeviceEventShutdown);
+	plugin.unload();
+	dlclose(plugin.library);
+	return result;
+}
@@ -46,6 +46,14 @@ public class UseRenderingPlugin : MonoBehaviour
 #endif
 	private static extern IntPtr GetRenderEventFunc();
 
+	// Compiled shader programs get cached in this directory between runs.
+#if (UNITY_IOS || UNITY_TVOS || UNITY_WEBGL) && !UNITY_EDITOR
+	[DllImport ("__Internal")]
+#else
+	[DllImport("RenderingPlugin")]
+#endif
+	private static extern void SetShaderCacheDirectoryFromUnity(string path);
+
 #if UNITY_WEBGL && !UNITY_EDITOR
 	[DllImport ("__Internal")]
 	private static extern void RegisterPlugin();
@@ -56,6 +64,7 @@ public class UseRenderingPlugin : MonoBehaviour
 #if UNITY_WEBGL && !UNITY_EDITOR
 		RegisterPlugin();
 #endif
+		SetShaderCacheDirectoryFromUnity(Application.persistentDataPath);
 		CreateTextureAndPassToPlugin();
 		SendMeshBuffersToPlugin();
 		yield return StartCoroutine("CallPluginAtEndOfFrames");